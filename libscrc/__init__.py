@@ -21,3 +21,172 @@ from ._crc24 import *
 from ._crc32 import *
 from ._crc64 import *
 from ._crc82 import *
+
+import array
+
+from . import _crcx, _canx, _crc8, _crc16, _crc24, _crc32, _crc64
+
+def kernels():
+    """ The kernel every family is bound to : 'table', 'sse42', 'pclmul' or 'vpclmul'.
+        The CPU is probed once at import, LIBSCRC_KERNEL=table|sse42|pclmul|vpclmul lowers the tier.
+        Any other LIBSCRC_KERNEL value ( pclmulqdq, PCLMUL ... ) is ignored with a RuntimeWarning at import,
+        check kernels() before trusting an A/B measurement.
+    """
+    result = {}
+    for module in ( _crcx, _canx, _crc8, _crc16, _crc24, _crc32, _crc64 ):
+        result.update( module._kernels() )
+    return result
+
+def gil_threshold( size=None ):
+    """ Buffers of at least size bytes are computed with the GIL released, default 8192 or LIBSCRC_GIL_THRESHOLD.
+        Returns the previous value, size=None only reads it and 0 releases the GIL for every buffer.
+    """
+    size = -1 if size is None else int( size )
+    if size < 0 and size != -1:
+        raise ValueError( 'size must not be negative' )
+    return [ module._gil_threshold( size ) for module in ( _crcx, _canx, _crc8, _crc16, _crc24, _crc32, _crc64 ) ][0]
+
+_PRESETS = {}
+for _module in ( _crcx, _canx, _crc8, _crc16, _crc24, _crc32, _crc64 ):
+    _PRESETS.update( dict.fromkeys( _module._presets(), _module ) )
+
+def combine( name, crc_a, crc_b, len_b ):
+    """ CRC( A || B ) from CRC( A ), CRC( B ) and len( B ) of the preset name, O( log( len_b ) ).
+        libscrc.combine( 'crc32', libscrc.crc32( a ), libscrc.crc32( b ), len( b ) ) == libscrc.crc32( a + b )
+    """
+    if name not in _PRESETS:
+        raise ValueError( 'unknown preset {0!r}'.format( name ) )
+    return _PRESETS[name]._combine( name, crc_a, crc_b, len_b )
+
+def extend_zeros( name, crc, n ):
+    """ CRC( A || n zero bytes ) from CRC( A ) of the preset name, O( log( n ) ) : nothing is read.
+        libscrc.extend_zeros( 'crc32', libscrc.crc32( a ), 1 << 30 ) == libscrc.crc32( a + bytes( 1 << 30 ) )
+    """
+    if name not in _PRESETS:
+        raise ValueError( 'unknown preset {0!r}'.format( name ) )
+    return _PRESETS[name]._extend_zeros( name, crc, n )
+
+def extend_repeat( name, crc, block, count ):
+    """ CRC( A || block * count ) from CRC( A ) of the preset name : one pass over block, then O( log( count ) ).
+        libscrc.extend_repeat( 'crc32', libscrc.crc32( a ), b'\\xff' * 512, 1000 ) == libscrc.crc32( a + b'\\xff' * 512000 )
+    """
+    if name not in _PRESETS:
+        raise ValueError( 'unknown preset {0!r}'.format( name ) )
+    return _PRESETS[name]._extend_repeat( name, crc, block, count )
+
+def update_range( name, old_crc, offset, old_bytes, new_bytes, total_len ):
+    """ CRC of a total_len-byte message of the preset name after old_bytes at offset were rewritten to new_bytes.
+        CRC is linear, only the changed range is read : O( len( old_bytes ) + log( total_len ) ).
+        libscrc.update_range( 'crc32', libscrc.crc32( block ), 4, b'\\x00\\x01', b'\\x00\\x02', len( block ) )
+    """
+    if name not in _PRESETS:
+        raise ValueError( 'unknown preset {0!r}'.format( name ) )
+    return _PRESETS[name]._update_range( name, old_crc, offset, old_bytes, new_bytes, total_len )
+
+def new( name, data=b'' ):
+    """ hashlib-style hasher of the preset name : update() / digest() / hexdigest() / intdigest() / copy().
+        libscrc.new( 'modbus', b'1234' ).intdigest() == libscrc.modbus( b'1234' )
+    """
+    if name not in _PRESETS:
+        raise ValueError( 'unknown preset {0!r}'.format( name ) )
+    hasher = _PRESETS[name]._new( name )
+    if data:
+        hasher.update( data )
+    return hasher
+
+def _integers( values ):
+    try:
+        memoryview( values )
+    except TypeError:
+        values = list( values )
+        try:
+            values = array.array( 'q', values )
+        except OverflowError:
+            values = array.array( 'Q', values )
+    return values
+
+def batch( name, data, out=None, offsets=None, lengths=None, expected=None, rows=False ):
+    """ CRC of the preset name for many buffers in one call, the loop runs in C without the GIL.
+        data is a sequence of bytes-like objects, or one buffer cut by offsets / lengths
+        ( offsets alone holds n + 1 boundaries ). The CRCs go to out, an integer array wide enough
+        for the preset, created when None. Returns out, or a bytearray bitmap when expected is given :
+        bit ( i & 7 ) of byte ( i >> 3 ) is set when CRC i equals expected[i].
+        With rows=True, data is one 2-D buffer ( numpy array, memoryview.cast ... C-contiguous or strided )
+        and every row gets its CRC, out[i] = CRC( data[i] ).
+        libscrc.batch( 'modbus', [ b'1234', b'5678' ] ).tolist() == [ libscrc.modbus( b'1234' ), libscrc.modbus( b'5678' ) ]
+    """
+    if name not in _PRESETS:
+        raise ValueError( 'unknown preset {0!r}'.format( name ) )
+    if offsets is not None:
+        offsets = _integers( offsets )
+        lengths = None if lengths is None else _integers( lengths )
+    if expected is not None:
+        expected = _integers( expected )
+    if out is None:
+        if rows:
+            count = ( memoryview( data ).shape + ( 0, ) )[0]
+        elif offsets is None:
+            data  = data if isinstance( data, ( list, tuple ) ) else list( data )
+            count = len( data )
+        else:
+            count = len( memoryview( offsets ) ) - ( 1 if lengths is None else 0 )
+        width = _PRESETS[name]._new( name ).width
+        code  = [ code for code in 'BHILQ' if array.array( code ).itemsize * 8 >= width ][0]
+        out   = array.array( code, bytes( array.array( code ).itemsize * max( count, 0 ) ) )
+    return _PRESETS[name]._batch( name, data, out, offsets, lengths, expected, bool( rows ) )
+
+def file_crc( path, algorithm ):
+    """ CRC of the file at path with the preset name ( or a libscrc.CRC model ), read in C without the GIL.
+        A regular file is memory-mapped and read ahead, anything else is read on a helper thread
+        into two buffers while the other one is computed.
+        libscrc.file_crc( 'disk.img', 'crc32' ) == libscrc.crc32( open( 'disk.img', 'rb' ).read() )
+    """
+    if isinstance( algorithm, CRC ):
+        return algorithm.file( path )
+    if algorithm not in _PRESETS:
+        raise ValueError( 'unknown preset {0!r}'.format( algorithm ) )
+    return _PRESETS[algorithm]._file( algorithm, path )
+
+def fd_crc( fd, algorithm ):
+    """ CRC of the open file descriptor fd from its current position to the end, see file_crc().
+        The descriptor is left open, positioned at the end of the file.
+    """
+    if not isinstance( fd, int ):
+        fd = fd.fileno()
+    if isinstance( algorithm, CRC ):
+        return algorithm.file( fd )
+    if algorithm not in _PRESETS:
+        raise ValueError( 'unknown preset {0!r}'.format( algorithm ) )
+    return _PRESETS[algorithm]._file( algorithm, fd )
+
+def files_crc( paths, algorithm, threads=0 ):
+    """ ( crc, size ) of every path ( or file descriptor ) with the preset name ( or a libscrc.CRC model ).
+        The files are shared out to threads ( 0 : one per CPU ) in C without the GIL, an idle thread takes
+        the next file, so a large file does not hold back the small ones. A file that fails gives its OSError
+        in place of the tuple.
+        libscrc.files_crc( [ 'a.bin', 'b.bin' ], 'crc32' ) == [ ( libscrc.crc32( a ), len( a ) ), ( libscrc.crc32( b ), len( b ) ) ]
+    """
+    if isinstance( algorithm, CRC ):
+        return algorithm.files( list( paths ), threads )
+    if algorithm not in _PRESETS:
+        raise ValueError( 'unknown preset {0!r}'.format( algorithm ) )
+    return _PRESETS[algorithm]._files( algorithm, list( paths ), threads )
+
+def multi( data, algorithms ):
+    """ CRCs of data with many presets ( or libscrc.CRC models ) in one pass : the buffer is walked in
+        16 KiB blocks and every kernel takes a block while it is in L1 / L2, instead of one pass per preset.
+        'adler32' may be listed too. Returns a dict algorithm -> CRC.
+        libscrc.multi( data, [ 'crc32', 'crc32_c', 'xz64' ] ) == { 'crc32' : libscrc.crc32( data ), ... }
+    """
+    algorithms = list( algorithms )
+    capsules   = []
+    for algorithm in algorithms:
+        if isinstance( algorithm, CRC ):
+            capsules.append( algorithm._capsule() )
+        elif algorithm == 'adler32':
+            capsules.append( _crc32._capsule( algorithm ) )
+        elif algorithm in _PRESETS:
+            capsules.append( _PRESETS[algorithm]._capsule( algorithm ) )
+        else:
+            raise ValueError( 'unknown preset {0!r}'.format( algorithm ) )
+    return dict( zip( algorithms, _crc32._multi( data, capsules ) ) )
@@ -0,0 +1,135 @@
+# -*- coding:utf-8 -*-
+""" Checksum many files with any libscrc preset : python -m libscrc [ -a crc32 ] [ -f cksum|sfv ] files... """
+# !/usr/bin/python
+# Python:   3.5.2+
+# Platform: Windows/Linux/MacOS/ARMv7
+# Program:  Command line of the libscrc file checksums.
+# Package:  pip install libscrc.
+
+import os
+import sys
+import argparse
+
+import libscrc
+
+CHUNK = 4096    # Paths per libscrc.files_crc() call, the output starts before a large tree is walked
+
+def _paths( names, recursive ):
+    for name in names:
+        if recursive and os.path.isdir( name ):
+            for root, dirs, files in os.walk( name ):
+                dirs.sort()
+                for item in sorted( files ):
+                    yield os.path.join( root, item )
+        else:
+            yield name
+
+def _chunks( items ):
+    chunk = []
+    for item in items:
+        chunk.append( item )
+        if len( chunk ) == CHUNK:
+            yield chunk
+            chunk = []
+    if chunk:
+        yield chunk
+
+def _crc( names, algorithm, threads ):
+    """ ( name, crc, size ) or ( name, OSError, None ) in the order of names, '-' is the standard input. """
+    for chunk in _chunks( names ):
+        files = [ sys.stdin.fileno() if name == '-' else name for name in chunk ]
+        for name, result in zip( chunk, libscrc.files_crc( files, algorithm, threads ) ):
+            if isinstance( result, OSError ):
+                yield name, result, None
+            else:
+                yield name, result[0], result[1]
+
+def _cksum( crc, size ):
+    """ POSIX cksum : the length follows the data, least significant byte first, without its zero bytes. """
+    tail = bytearray()
+    while size:
+        tail.append( size & 0xFF )
+        size >>= 8
+    return libscrc.posix( bytes( tail ), crc )
+
+def _sfv( names ):
+    """ ( name, expected ) of every line of the SFV files, ';' starts a comment.
+        A malformed line gives ( 'file:line', ValueError ) in place of the pair.
+    """
+    for sfv in names:
+        handle = sys.stdin if sfv == '-' else open( sfv, 'r' )
+        try:
+            for number, line in enumerate( handle, 1 ):
+                line = line.strip()
+                if ( not line ) or line.startswith( ';' ):
+                    continue
+                name, _, value = line.rpartition( ' ' )
+                name = name.strip()
+                try:
+                    if not name:
+                        raise ValueError( 'no file name' )
+                    expected = int( value, 16 )
+                except ValueError:
+                    yield '{0}:{1}'.format( sfv, number ), ValueError( 'malformed SFV line {0!r}'.format( line ) )
+                    continue
+                if ( sfv != '-' ) and not os.path.isabs( name ):
+                    name = os.path.join( os.path.dirname( sfv ), name )
+                yield name, expected
+        finally:
+            if handle is not sys.stdin:
+                handle.close()
+
+def _error( name, error ):
+    sys.stderr.write( 'libscrc: {0}: {1}\n'.format( name, getattr( error, 'strerror', None ) or error ) )
+
+def main( argv=None ):
+    parser = argparse.ArgumentParser( prog='python -m libscrc', description='Checksum files with a libscrc preset, '
+                                      'computed in C on a thread pool without the GIL.' )
+    parser.add_argument( 'files', nargs='*', default=[ '-' ], help="files to checksum, '-' is the standard input" )
+    parser.add_argument( '-a', '--algorithm', default=None, help="preset name, default 'cksum' ( -f cksum ) or 'crc32' ( -f sfv )" )
+    parser.add_argument( '-f', '--format', default='cksum', choices=[ 'cksum', 'sfv' ], help="'CRC SIZE NAME' or 'NAME HEX'" )
+    parser.add_argument( '-j', '--threads', default=0, type=int, help='worker threads, default one per CPU' )
+    parser.add_argument( '-r', '--recursive', action='store_true', help='walk into directories' )
+    parser.add_argument( '-c', '--check', action='store_true', help='read SFV files and verify the files they list' )
+    args = parser.parse_args( argv )
+
+    algorithm = args.algorithm or ( 'cksum' if ( args.format == 'cksum' ) and not args.check else 'crc32' )
+    if algorithm not in libscrc._PRESETS:
+        parser.error( 'unknown preset {0!r}'.format( algorithm ) )
+    if args.threads < 0:
+        parser.error( 'threads must not be negative' )
+    width = libscrc.new( algorithm ).width
+    status = 0
+
+    if args.check:
+        listed = []
+        for name, expected in _sfv( args.files ):
+            if isinstance( expected, ValueError ):
+                _error( name, expected )
+                status = 1
+            else:
+                listed.append( ( name, expected ) )
+        for ( name, expected ), ( _, crc, size ) in zip( listed, _crc( [ name for name, _ in listed ], algorithm, args.threads ) ):
+            if size is None:
+                _error( name, crc )
+                status = 1
+            elif crc != expected:
+                sys.stdout.write( '{0}: FAILED\n'.format( name ) )
+                status = 1
+            else:
+                sys.stdout.write( '{0}: OK\n'.format( name ) )
+        return status
+
+    for name, crc, size in _crc( _paths( args.files, args.recursive ), algorithm, args.threads ):
+        if size is None:
+            _error( name, crc )
+            status = 1
+        elif args.format == 'sfv':
+            sys.stdout.write( '{0} {1:0{2}X}\n'.format( name, crc, ( width + 3 ) // 4 ) )
+        else:
+            crc = _cksum( crc, size ) if algorithm in ( 'cksum', 'posix' ) else crc
+            sys.stdout.write( '{0} {1}{2}\n'.format( crc, size, '' if name == '-' else ' ' + name ) )
+    return status
+
+if __name__ == '__main__':
+    sys.exit( main() )
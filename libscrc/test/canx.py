@@ -13,10 +13,13 @@ import unittest
 
 import libscrc
 from libscrc import _canx
+from libscrc.test.presets import PresetsTest
 
-class TestCANx( unittest.TestCase ):
+class TestCANx( PresetsTest, unittest.TestCase ):
     """ Test CANx variant.
     """
+    module = _canx
+
     def do_gradually( self , module ):
         """ Test gradually calculating functionality.
             (libscrc >= 1.4)
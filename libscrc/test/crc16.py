@@ -16,10 +16,13 @@ import unittest
 
 import libscrc
 from libscrc import _crc16
+from libscrc.test.presets import PresetsTest
 
-class TestCRC16( unittest.TestCase ):
+class TestCRC16( PresetsTest, unittest.TestCase ):
     """ Test CRC16 variant.
     """
+    module = _crc16
+
 
     def do_gradually( self , module ):
         """ Test gradually calculating functionality.
@@ -155,6 +158,38 @@ class TestCRC16( unittest.TestCase ):
         self.assertEqual( module.hacker16( data=b'123456789', poly=0x8005, init=0xFFFF, xorout=0x0000, refin=False, refout=True,  reinit=True ), 0xE775 )
         self.assertEqual( module.hacker16( data=b'123456789', poly=0x8005, init=0xFFFF, xorout=0x0000, refin=True,  refout=True,  reinit=True ), 0x4B37 )
 
+    def test_folding( self ):
+        """ Carry-less folding of long buffers must match the table calculation of short pieces.
+        """
+        data = bytes( bytearray( ( i * 13 + 5 ) & 0xFF for i in range( 1100 ) ) )
+        for name in ( 'modbus', 'xmodem', 't10_dif', 'x25', 'dnp' ):
+            function = getattr( _crc16, name )
+            for length in ( 128, 129, 143, 144, 191, 192, 255, 256, 257, 1024, 1099 ):
+                crc = function( data[:32] )
+                for i in range( 32, length, 32 ):
+                    crc = function( data[i:min( i+32, length )], crc )
+                self.assertEqual( function( data[:length] ), crc )
+
+    def test_arguments( self ):
+        """ Positional and keyword arguments, and their errors, of every kind of function.
+        """
+        self.assertEqual( _crc16.modbus( data=b'123456789' ), 0x4B37 )
+        self.assertEqual( _crc16.modbus( b'6789', init=_crc16.modbus( b'12345' ) ), 0x4B37 )
+        self.assertEqual( _crc16.modbus( b'123456789', threads=1 ), 0x4B37 )
+        self.assertEqual( _crc16.modbus( b'', 0x1FFFF ), _crc16.modbus( b'', 0xFFFF ) )
+        self.assertEqual( _crc16.sick( data=b'123456789' ), _crc16.sick( b'123456789' ) )
+        self.assertEqual( _crc16.hacker16( b'123456789', 0x8005, 0xFFFF, 0x0000, True, True, True ), 0x4B37 )
+        self.assertEqual( _crc16.hacker16( data=bytearray( b'123456789' ), reinit=True ), 0x4B37 )
+
+        for function in ( _crc16.modbus, _crc16.sick, _crc16.hacker16 ):
+            self.assertRaises( TypeError, function )
+            self.assertRaises( TypeError, function, '123456789' )
+            self.assertRaises( TypeError, function, b'123456789', 1.0 )
+            self.assertRaises( TypeError, function, b'123456789', unknown=1 )
+        self.assertRaises( TypeError, _crc16.modbus, b'123456789', 0xFFFF, 1 )
+        self.assertRaises( TypeError, _crc16.modbus, b'123456789', 0xFFFF, init=0xFFFF )
+        self.assertRaises( TypeError, _crc16.modbus, data=b'123456789', init=None )
+
     def test_basics( self ):
         """ Test basic functionality.
         """
@@ -14,10 +14,13 @@ import unittest
 
 import libscrc
 from libscrc import _crc24
+from libscrc.test.presets import PresetsTest
 
-class TestCRC24( unittest.TestCase ):
+class TestCRC24( PresetsTest, unittest.TestCase ):
     """ Test CRC24 variant.
     """
+    module = _crc24
+
     def do_gradually( self , module ):
         """ Test gradually calculating functionality.
             (libscrc >= 1.4)
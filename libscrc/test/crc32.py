@@ -11,14 +11,25 @@
 #           2020-08-05 Wheel Ver:1.4   [Heyn] New add gradually calculating
 #           2021-06-08 Wheel Ver:1.7   [Heyn] Optimize the code for hacker32
 
+import os
+import sys
+import zlib
+import shutil
+import tempfile
+import subprocess
+import array
 import unittest
+import threading
 
 import libscrc
 from libscrc import _crc32
+from libscrc.test.presets import PresetsTest
 
-class TestCRC32( unittest.TestCase ):
+class TestCRC32( PresetsTest, unittest.TestCase ):
     """ Test CRC32 variant.
     """
+    module = _crc32
+
     def do_gradually( self , module ):
         """ Test gradually calculating functionality.
             (libscrc >= 1.4)
@@ -92,6 +103,312 @@ class TestCRC32( unittest.TestCase ):
         self.assertEqual( module.hacker32( data=b'123456789', poly=0x04C11DB7, init=0xFFFFFFFF, xorout=0xFFFFFFFF, refin=False, refout=True,  reinit=True ), 0x1898913F )
         self.assertEqual( module.hacker32( data=b'123456789', poly=0x04C11DB7, init=0xFFFFFFFF, xorout=0xFFFFFFFF, refin=True,  refout=True,  reinit=True ), 0xCBF43926 )
 
+    def test_slicing( self ):
+        """ Slicing-by-8/16 must match the byte by byte calculation.
+        """
+        data = bytes( bytearray( ( i * 7 + 3 ) & 0xFF for i in range( 67 ) ) )
+        for name in ( 'crc32', 'mpeg2', 'crc32_c', 'posix', 'cdma', 'philips' ):
+            function = getattr( _crc32, name )
+            for length in range( 1, len( data ) ):
+                crc = function( data[:1] )
+                for i in range( 1, length ):
+                    crc = function( data[i:i+1], crc )
+                self.assertEqual( function( data[:length] ), crc )
+
+    def test_folding( self ):
+        """ Folding and interleaved streams on long buffers must match the calculation of short pieces.
+        """
+        data = bytes( bytearray( ( i * 13 + 5 ) & 0xFF for i in range( 3 * 8192 + 100 ) ) )
+        for name in ( 'crc32', 'mpeg2', 'crc32_c', 'posix', 'cdma', 'philips' ):
+            function = getattr( _crc32, name )
+            for length in ( 128, 129, 143, 144, 191, 192, 255, 256, 257, 768, 1024, 1099, 3 * 8192 + 99 ):
+                crc = function( data[:32] )
+                for i in range( 32, length, 32 ):
+                    crc = function( data[i:min( i+32, length )], crc )
+                self.assertEqual( function( data[:length] ), crc )
+
+    def test_kernels( self ):
+        """ Every tier forced by LIBSCRC_KERNEL must give the same CRC, a tier is only ever lowered.
+        """
+        tiers  = ( 'table', 'sse42', 'pclmul', 'vpclmul' )
+        script = ( "import libscrc\n"
+                   "data = bytes( bytearray( ( i * 13 + 5 ) & 0xFF for i in range( 70000 ) ) )\n"
+                   "print( libscrc.kernels()['crc32'], libscrc.kernels()['crc32c'].split( '+' )[-1],"
+                   " [ libscrc.crc32( data[:n] ) for n in ( 100, 1000, 70000 ) ],"
+                   " [ libscrc.crc32_c( data[:n] ) for n in ( 100, 1000, 70000 ) ],"
+                   " [ libscrc.ecma182( data[:n] ) for n in ( 100, 1000, 70000 ) ],"
+                   " [ libscrc.modbus( data[:n] ) for n in ( 100, 1000, 70000 ) ] )\n" )
+        native = libscrc.kernels()
+        self.assertEqual( sorted( native ), [ 'canx', 'crc16', 'crc24', 'crc32', 'crc32c', 'crc64', 'crc8', 'crcx' ] )
+        for kernel in native.values():
+            self.assertTrue( set( kernel.split( '+' ) ) <= set( tiers ) )
+
+        results = set()
+        for tier in tiers:
+            environ = dict( os.environ, LIBSCRC_KERNEL=tier )
+            output  = subprocess.check_output( [ sys.executable, '-c', script ], env=environ ).decode().split( ' ', 2 )
+            self.assertTrue( tiers.index( output[0] ) <= tiers.index( tier ) )
+            self.assertTrue( tiers.index( output[1] ) <= tiers.index( tier ) )
+            results.add( output[2] )
+        self.assertEqual( len( results ), 1 )
+
+        # a misspelled tier is ignored, but never silently
+        for value, warned in ( ( 'pclmulqdq', True ), ( 'pclmul', False ), ( '', False ) ):
+            process = subprocess.Popen( [ sys.executable, '-c', "import libscrc; print( libscrc.kernels()['crc32'] )" ],
+                                        stdout=subprocess.PIPE, stderr=subprocess.PIPE, env=dict( os.environ, LIBSCRC_KERNEL=value ) )
+            stdout, stderr = process.communicate()
+            self.assertEqual( process.returncode, 0 )
+            self.assertEqual( 'RuntimeWarning: LIBSCRC_KERNEL is not one of table, sse42, pclmul, vpclmul' in stderr.decode(), warned, value )
+            if warned:
+                self.assertEqual( stdout.decode().strip(), native['crc32'] )
+        environ = dict( os.environ, LIBSCRC_KERNEL='pclmulqdq' )
+        self.assertNotEqual( subprocess.call( [ sys.executable, '-W', 'error::RuntimeWarning', '-c', 'import libscrc' ], stderr=subprocess.PIPE, env=environ ), 0 )
+
+    def test_threads( self ):
+        """ Threads computing without the GIL must not see each other's gradual state.
+        """
+        data = bytes( bytearray( ( i * 13 + 5 ) & 0xFF for i in range( 1 << 16 ) ) )
+        expected = { name : getattr( libscrc, name )( data ) for name in ( 'crc32', 'mpeg2', 'modbus', 'ecma182', 'crc32_c', 'stm32' ) }
+        errors   = []
+
+        def worker( name ):
+            function = getattr( libscrc, name )
+            for _ in range( 50 ):
+                crc = function( data[:1 << 15] )
+                crc = function( data[1 << 15:], crc )
+                if crc != expected[name] or function( data ) != expected[name]:
+                    errors.append( name )
+
+        previous = libscrc.gil_threshold( 0 )
+        try:
+            self.assertEqual( libscrc.gil_threshold(), 0 )
+            workers = [ threading.Thread( target=worker, args=( name, ) ) for name in expected for _ in range( 2 ) ]
+            for thread in workers:
+                thread.start()
+            for thread in workers:
+                thread.join()
+        finally:
+            libscrc.gil_threshold( previous )
+        self.assertEqual( errors, [] )
+        self.assertEqual( libscrc.gil_threshold(), previous )
+        self.assertRaises( ValueError, libscrc.gil_threshold, -2 )
+
+    def test_parallel( self ):
+        """ threads= beside init=, more threads than the buffer has chunks, and the bounds of threads.
+            Every preset of every family : PresetsTest.test_presets_threads.
+        """
+        data = bytes( bytearray( ( i * 29 + 7 ) & 0xFF for i in range( ( 5 << 20 ) + 4321 ) ) )
+        for name in ( 'crc32', 'mpeg2', 'crc32_c' ):
+            function = getattr( libscrc, name )
+            expected = function( data )
+            self.assertEqual( function( data, threads=64 ), expected )
+            crc = function( data[:1000] )
+            self.assertEqual( function( data[1000:], init=crc, threads=4 ), expected )
+        self.assertRaises( ValueError, libscrc.crc32, data, threads=-1 )
+        self.assertRaises( ValueError, libscrc.crc32, data, threads=1 << 32 )
+
+    def test_combine( self ):
+        """ combine() of the check string and of the bounds of len( B ).
+            Every preset of every family : PresetsTest.test_presets_combine.
+        """
+        self.assertEqual( libscrc.combine( 'crc32', libscrc.crc32( b'12345' ), libscrc.crc32( b'6789' ), 4 ), 0xCBF43926 )
+        self.assertRaises( ValueError, libscrc.combine, 'unknown', 0, 0, 0 )
+        self.assertRaises( ValueError, libscrc.combine, 'crc32', 0, 0, -5 )
+        self.assertRaises( OverflowError, libscrc.combine, 'crc32', 0, 0, ( 1 << 64 ) + 5 )
+
+    def test_hasher( self ):
+        """ The digest bytes of the check string and an unknown preset.
+            Every preset of every family : PresetsTest.test_presets_hasher.
+        """
+        self.assertEqual( libscrc.new( 'crc32', b'123456789' ).digest(), b'\xcb\xf4\x39\x26' )
+        self.assertRaises( ValueError, libscrc.new, 'unknown' )
+
+    def test_batch( self ):
+        """ batch() into a typed out and its argument errors.
+            Every preset of every family : PresetsTest.test_presets_batch.
+        """
+        data = bytes( bytearray( ( i * 29 + 7 ) & 0xFF for i in range( 4000 ) ) )
+        out  = array.array( 'Q', [ 0 ] * 3 )
+        self.assertIs( libscrc.batch( 'crc32', [ b'123456789' ] * 3, out ), out )
+        self.assertEqual( out.tolist(), [ 0xCBF43926 ] * 3 )
+        self.assertRaises( ValueError, libscrc.batch, 'crc32', [ b'1' ], array.array( 'H', [ 0 ] ) )
+        self.assertRaises( ValueError, libscrc.batch, 'crc32', data, offsets=[ 0, len( data ) + 1 ] )
+        self.assertRaises( ValueError, libscrc.batch, 'unknown', [ b'1' ] )
+
+    def test_rows( self ):
+        """ batch( rows=True ) gives the CRC of every row of a 2-D buffer, contiguous or strided, into a typed out.
+        """
+        data   = bytes( bytearray( ( i * 13 + 5 ) & 0xFF for i in range( 300 * 64 ) ) )
+        matrix = memoryview( data ).cast( 'B', ( 300, 64 ) )
+        rows   = [ data[i * 64:( i + 1 ) * 64] for i in range( 300 ) ]
+        for name in ( 'crc32', 'crc32_c', 'modbus', 'xz64', 'crc8', 'crc24' ):
+            function = getattr( libscrc, name )
+            self.assertEqual( libscrc.batch( name, matrix, rows=True ).tolist(), [ function( row ) for row in rows ], name )
+            self.assertEqual( libscrc.batch( name, matrix[::3], rows=True ).tolist(), [ function( row ) for row in rows[::3] ], name )
+            self.assertEqual( libscrc.batch( name, matrix[::-1], rows=True ).tolist(), [ function( row ) for row in rows[::-1] ], name )
+
+        out = array.array( 'H', [ 0 ] * 300 )
+        self.assertIs( libscrc.batch( 'modbus', matrix, out, rows=True ), out )
+        self.assertEqual( out.tolist(), [ libscrc.modbus( row ) for row in rows ] )
+        words = array.array( 'I', range( 64 ) )
+        self.assertEqual( libscrc.batch( 'crc32', memoryview( words ).cast( 'B' ).cast( 'I', ( 8, 8 ) ), rows=True ).tolist(),
+                          [ libscrc.crc32( words[i * 8:( i + 1 ) * 8].tobytes() ) for i in range( 8 ) ] )
+        self.assertRaises( ValueError, libscrc.batch, 'modbus', matrix, array.array( 'B', [ 0 ] * 300 ), rows=True )
+        self.assertRaises( ValueError, libscrc.batch, 'crc32', data, rows=True )
+        self.assertRaises( TypeError, libscrc.batch, 'crc32', matrix, offsets=[ 0, 1 ], rows=True )
+
+        try:
+            import numpy
+        except ImportError:
+            return
+        records = numpy.frombuffer( data, dtype=numpy.uint8 ).reshape( 300, 64 )
+        out     = numpy.zeros( 300, dtype=numpy.uint32 )
+        libscrc.batch( 'crc32', records[:, ::2], out, rows=True )
+        self.assertEqual( out.tolist(), [ libscrc.crc32( row[::2] ) for row in rows ] )
+
+    def test_extend( self ):
+        """ extend_zeros() of 1 TiB and the bounds of the count.
+            Every preset of every family : PresetsTest.test_presets_extend, a model : TestHacker.test_model.
+        """
+        head = b'123456789'
+        # 1 TiB of zeros, checked against combine() of the same length
+        zeros = libscrc.extend_zeros( 'crc32', libscrc.crc32( b'' ), 1 << 40 )
+        self.assertEqual( libscrc.extend_zeros( 'crc32', libscrc.crc32( head ), 1 << 40 ), libscrc.combine( 'crc32', libscrc.crc32( head ), zeros, 1 << 40 ) )
+        self.assertRaises( ValueError, libscrc.extend_repeat, 'unknown', 0, b'1', 1 )
+        self.assertRaises( ValueError, libscrc.extend_repeat, 'crc32', 0, b'1', -1 )
+        self.assertRaises( OverflowError, libscrc.extend_zeros, 'crc32', 0, ( 1 << 64 ) + 3 )
+
+    def test_update_range( self ):
+        """ update_range() of a 1 GiB message and the bounds of the range.
+            Every preset of every family : PresetsTest.test_presets_update_range, a model : TestHacker.test_model.
+        """
+        data = b'123456789'
+        message = libscrc.extend_zeros( 'crc32', libscrc.crc32( data ), ( 1 << 30 ) - len( data ) )
+        self.assertEqual( libscrc.update_range( 'crc32', message, 0, data, bytes( len( data ) ), 1 << 30 ),
+                          libscrc.extend_zeros( 'crc32', libscrc.crc32( b'' ), 1 << 30 ) )
+        self.assertRaises( ValueError, libscrc.update_range, 'crc32', 0, 0, b'a', b'bc', 5 )
+        self.assertRaises( ValueError, libscrc.update_range, 'crc32', 0, 4, b'ab', b'cd', 5 )
+        self.assertRaises( ValueError, libscrc.update_range, 'crc32', 0, -1, b'ab', b'cd', 5 )
+        self.assertRaises( OverflowError, libscrc.update_range, 'crc32', 0, 0, b'ab', b'cd', ( 1 << 64 ) + 5 )
+
+    def test_multi( self ):
+        """ multi() gives the same CRCs as one call per preset, across the block boundaries and the modules.
+        """
+        data  = bytes( bytearray( ( i * 17 + 11 ) & 0xFF for i in range( 100003 ) ) )
+        names = [ 'crc32', 'crc32_c', 'xz64', 'modbus', 'crc8', 'crc24', 'can15', 'crc12_3gpp' ]
+        model = libscrc.CRC( 12, 0x80F, 0, False, True, 0 )
+        for size in ( 0, 1, 16383, 16384, 16385, len( data ) ):
+            expected = dict( ( name, getattr( libscrc, name )( data[:size] ) ) for name in names )
+            expected[model] = model( data[:size] )
+            self.assertEqual( libscrc.multi( data[:size], names + [ model ] ), expected, size )
+        self.assertEqual( libscrc.multi( memoryview( data ), [] ), {} )
+        self.assertRaises( ValueError, libscrc.multi, data, [ 'crc32', 'adler33' ] )
+
+    def test_multi_adler32( self ):
+        """ adler32 in multi() matches zlib, the sums are carried across the 16 KiB blocks and the 5552 byte reductions.
+        """
+        data = bytes( bytearray( 0xFF if i % 7 else ( i & 0xFF ) for i in range( 70001 ) ) )
+        for size in ( 0, 1, 5551, 5552, 5553, 16384, 16385, 5552 * 3 + 1, len( data ) ):
+            crcs = libscrc.multi( data[:size], [ 'adler32', 'crc32' ] )
+            self.assertEqual( crcs['adler32'], zlib.adler32( data[:size] ) & 0xFFFFFFFF, size )
+            self.assertEqual( crcs['crc32'], libscrc.crc32( data[:size] ), size )
+        self.assertEqual( libscrc.multi( data[:4096], [ 'adler32' ] )['adler32'], libscrc.adler32( data[:4096] ) )
+
+    def test_file( self ):
+        """ file_crc() maps a regular file, fd_crc() reads from the current position, a pipe goes through the reader thread.
+        """
+        data = bytes( bytearray( ( i * 31 + 3 ) & 0xFF for i in range( 3 * 1024 * 1024 + 7 ) ) )
+        handle, path = tempfile.mkstemp()
+        try:
+            os.write( handle, data )
+            os.close( handle )
+            for name in ( 'crc32', 'crc32_c', 'modbus', 'ecma182', 'crc8', 'can15' ):
+                self.assertEqual( libscrc.file_crc( path, name ), libscrc.new( name, data ).intdigest(), name )
+            model = libscrc.CRC( 12, 0x80F, 0, False, True, 0 )
+            self.assertEqual( libscrc.file_crc( path, model ), model( data ) )
+
+            with open( path, 'rb' ) as stream:
+                stream.seek( 4097 )
+                self.assertEqual( libscrc.fd_crc( stream, 'crc32' ), libscrc.crc32( data[4097:] ) )
+                self.assertEqual( stream.tell(), len( data ) )
+                self.assertEqual( libscrc.fd_crc( stream.fileno(), 'crc32' ), libscrc.crc32( b'' ) )
+
+            reader, writer = os.pipe()
+            worker = threading.Thread( target=lambda: ( os.write( writer, data[:200000] ), os.close( writer ) ) )
+            worker.start()
+            self.assertEqual( libscrc.fd_crc( reader, 'crc32' ), libscrc.crc32( data[:200000] ) )
+            worker.join()
+            os.close( reader )
+        finally:
+            os.remove( path )
+
+        # procfs reports a size of 0 for files that do have content
+        if os.path.isfile( '/proc/version' ):
+            with open( '/proc/version', 'rb' ) as stream:
+                content = stream.read()
+            self.assertTrue( len( content ) > 0 )
+            self.assertEqual( libscrc.file_crc( '/proc/version', 'crc32' ), libscrc.crc32( content ) )
+            self.assertEqual( libscrc.files_crc( [ '/proc/version' ], 'cksum' ), [ ( libscrc.cksum( content ), len( content ) ) ] )
+
+        self.assertRaises( OSError, libscrc.file_crc, path, 'crc32' )
+        self.assertRaises( ValueError, libscrc.file_crc, __file__, 'unknown' )
+        self.assertRaises( ValueError, libscrc.fd_crc, -1, 'crc32' )
+
+    def test_files( self ):
+        """ files_crc() on a thread pool keeps the order and reports a failing file in place, the command line matches POSIX cksum.
+        """
+        folder = tempfile.mkdtemp()
+        try:
+            blobs = [ bytes( bytearray( ( i * 7 + n ) & 0xFF for i in range( n * 5003 ) ) ) for n in range( 12 ) ]
+            paths = []
+            for n, blob in enumerate( blobs ):
+                paths.append( os.path.join( folder, 'f{0:02d}'.format( n ) ) )
+                with open( paths[-1], 'wb' ) as stream:
+                    stream.write( blob )
+
+            for threads in ( 0, 1, 3, 100 ):
+                results = libscrc.files_crc( paths + [ os.path.join( folder, 'missing' ) ], 'crc32', threads )
+                self.assertEqual( results[:-1], [ ( libscrc.crc32( blob ), len( blob ) ) for blob in blobs ] )
+                self.assertTrue( isinstance( results[-1], OSError ) )
+            model = libscrc.CRC( 12, 0x80F, 0, False, True, 0 )
+            self.assertEqual( libscrc.files_crc( paths, model ), [ ( model( blob ), len( blob ) ) for blob in blobs ] )
+            self.assertEqual( libscrc.files_crc( [], 'modbus' ), [] )
+
+            # cksum of 'hello world\n' is 3733384285 12
+            env = dict( os.environ )
+            env['PYTHONPATH'] = os.pathsep.join( [ os.path.dirname( os.path.dirname( os.path.abspath( libscrc.__file__ ) ) ) ] + ( [ env['PYTHONPATH'] ] if env.get( 'PYTHONPATH' ) else [] ) )
+            with open( paths[0], 'wb' ) as stream:
+                stream.write( b'hello world\n' )
+            output = subprocess.check_output( [ sys.executable, '-m', 'libscrc', paths[0], paths[1] ], env=env ).decode().splitlines()
+            self.assertEqual( output[0], '3733384285 12 ' + paths[0] )
+            self.assertEqual( output[1].split()[1:], [ str( len( blobs[1] ) ), paths[1] ] )
+
+            sfv = os.path.join( folder, 'list.sfv' )
+            with open( sfv, 'w' ) as stream:
+                stream.write( subprocess.check_output( [ sys.executable, '-m', 'libscrc', '-f', 'sfv', '-j', '2', 'f01', 'f02' ], cwd=folder, env=env ).decode() )
+            self.assertEqual( subprocess.call( [ sys.executable, '-m', 'libscrc', '-c', sfv ], stdout=subprocess.PIPE, env=env ), 0 )
+            with open( paths[2], 'ab' ) as stream:
+                stream.write( b'!' )
+            self.assertEqual( subprocess.call( [ sys.executable, '-m', 'libscrc', '-c', sfv ], stdout=subprocess.PIPE, env=env ), 1 )
+
+            # a malformed line is reported with its file and line, the other entries are still checked
+            with open( sfv, 'a' ) as stream:
+                stream.write( 'f01 not-a-crc\n' )
+            process = subprocess.Popen( [ sys.executable, '-m', 'libscrc', '-c', sfv ], stdout=subprocess.PIPE, stderr=subprocess.PIPE, env=env )
+            stdout, stderr = process.communicate()
+            self.assertEqual( process.returncode, 1 )
+            self.assertEqual( stdout.decode().splitlines(), [ os.path.join( folder, 'f01' ) + ': OK', os.path.join( folder, 'f02' ) + ': FAILED' ] )
+            self.assertTrue( stderr.decode().startswith( 'libscrc: {0}:3: malformed SFV line'.format( sfv ) ), stderr )
+            self.assertFalse( 'Traceback' in stderr.decode() )
+        finally:
+            shutil.rmtree( folder )
+
+        self.assertRaises( ValueError, libscrc.files_crc, [ __file__ ], 'unknown' )
+        self.assertRaises( ValueError, libscrc.files_crc, [ -1 ], 'crc32' )
+        self.assertRaises( ValueError, libscrc.files_crc, [ __file__ ], 'crc32', -1 )
+        self.assertRaises( ValueError, libscrc.files_crc, [ __file__ ], 'crc32', 1 << 32 )
+        self.assertRaises( ValueError, libscrc.files_crc, [ __file__ ], libscrc.CRC( 12, 0x80F ), -1 )
+
     def test_basics( self ):
         """ Test basic functionality.
         """
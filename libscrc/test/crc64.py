@@ -16,10 +16,13 @@ import unittest
 import libscrc
 
 from libscrc import _crc64
+from libscrc.test.presets import PresetsTest
 
-class TestCRC64( unittest.TestCase ):
+class TestCRC64( PresetsTest, unittest.TestCase ):
     """ Test CRC64 IOS ECMA182 GSM40 WE XZ64 variant.
     """
+    module = _crc64
+
     def do_gradually( self , module ):
         """ Test gradually calculating functionality.
             (libscrc >= 1.4)
@@ -80,6 +83,30 @@ class TestCRC64( unittest.TestCase ):
         self.do_gradually( _crc64 )
         self.do_basics( _crc64 )
 
+    def test_slicing( self ):
+        """ Slicing-by-8/16 must match the byte by byte calculation.
+        """
+        data = bytes( bytearray( ( i * 7 + 3 ) & 0xFF for i in range( 67 ) ) )
+        for name in ( 'iso', 'ecma182', 'we', 'xz64', 'gsm40' ):
+            function = getattr( _crc64, name )
+            for length in range( 1, len( data ) ):
+                crc = function( data[:1] )
+                for i in range( 1, length ):
+                    crc = function( data[i:i+1], crc )
+                self.assertEqual( function( data[:length] ), crc )
+
+    def test_folding( self ):
+        """ Carry-less folding of long buffers must match the table calculation of short pieces.
+        """
+        data = bytes( bytearray( ( i * 13 + 5 ) & 0xFF for i in range( 1100 ) ) )
+        for name in ( 'iso', 'ecma182', 'we', 'xz64', 'gsm40' ):
+            function = getattr( _crc64, name )
+            for length in ( 128, 129, 143, 144, 191, 192, 255, 256, 257, 1024, 1099 ):
+                crc = function( data[:32] )
+                for i in range( 32, length, 32 ):
+                    crc = function( data[i:min( i+32, length )], crc )
+                self.assertEqual( function( data[:length] ), crc )
+
     def test_big_chunks( self ):
         """ Test calculation of CRC on big chunks of data.
         """
@@ -18,10 +18,13 @@ import unittest
 
 import libscrc
 from libscrc import _crc8
+from libscrc.test.presets import PresetsTest
 
-class TestCRC8( unittest.TestCase ):
+class TestCRC8( PresetsTest, unittest.TestCase ):
     """ Test CRC8 variant.
     """
+    module = _crc8
+
     def do_gradually( self , module ):
         """ Test gradually calculating functionality.
             (libscrc >= 1.4)
@@ -13,10 +13,13 @@ import unittest
 
 import libscrc
 from libscrc import _crcx
+from libscrc.test.presets import PresetsTest
 
-class TestCRCx( unittest.TestCase ):
+class TestCRCx( PresetsTest, unittest.TestCase ):
     """ Test CRCx variant.
     """
+    module = _crcx
+
     def do_gradually( self , module ):
         """ Test gradually calculating functionality.
             (libscrc >= 1.4)
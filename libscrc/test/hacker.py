@@ -12,6 +12,7 @@
 #           2021-06-08 Wheel Ver:1.7   [Heyn] If the polynomial changes, you need to set reinit=True
 
 import unittest
+import threading
 
 import libscrc
 from libscrc import _crc8
@@ -78,6 +79,99 @@ class TestHacker( unittest.TestCase ):
         self.assertEqual( module.hacker64(b'123456789', poly=0x42F0E1EBA9EA3693, init=0, xorout=0, refin=False, refout=True,  reinit=True ), 0xE2CE92D0FAFB0236 )
         self.assertEqual( module.hacker64(b'123456789', poly=0x42F0E1EBA9EA3693, init=0, xorout=0, refin=True,  refout=True,  reinit=True ), 0x2B9C7EE4E2780C8A )
 
+    def test_threads( self ):
+        """ Calls with different parameters in parallel, without the GIL, must not see each other's tables.
+            Nothing is kept between calls : the defaults apply to every argument left out.
+        """
+        data = bytes( bytearray( ( i * 7 + 1 ) & 0xFF for i in range( 1 << 15 ) ) )
+        jobs = [ dict( poly=0x8005, init=0xFFFF, xorout=0x0000, refin=True,  refout=True  ),
+                 dict( poly=0x1021, init=0xFFFF, xorout=0x0000, refin=False, refout=False ),
+                 dict( poly=0x1021, init=0x0000, xorout=0x0000, refin=True,  refout=True  ),
+                 dict( poly=0x8005, init=0x0000, xorout=0x0000, refin=False, refout=True  ) ]
+        expected = [ _crc16.hacker16( data, reinit=True, **job ) for job in jobs ]
+        failures = []
+
+        def worker( index ):
+            for _ in range( 20 ):
+                job = jobs[( index + _ ) % len( jobs )]
+                if _crc16.hacker16( data, **job ) != expected[jobs.index( job )]:
+                    failures.append( job )
+
+        previous = libscrc.gil_threshold( 0 )
+        try:
+            workers = [ threading.Thread( target=worker, args=( i, ) ) for i in range( 8 ) ]
+            for thread in workers:
+                thread.start()
+            for thread in workers:
+                thread.join()
+        finally:
+            libscrc.gil_threshold( previous )
+
+        self.assertEqual( failures, [] )
+        _crc16.hacker16( b'123456789', poly=0x1021, refin=False, refout=False )
+        self.assertEqual( _crc16.hacker16( b'123456789' ), 0x4B37 )
+        self.assertEqual( _crc16.hacker16( b'123456789', poly=0x8005 ), _crc16.modbus( b'123456789' ) )
+
+    def test_rotate( self ):
+        """ Switching models without reinit, with more keys than the table cache keeps.
+        """
+        data  = b'123456789' * 37
+        polys = [ 0x04C11DB7, 0x1EDC6F41, 0x741B8CD7, 0x814141AB, 0x32583499, 0xA833982B, 0x000000AF, 0xF4ACFB13,
+                  0x5D6DCB51, 0x8F6E37A0, 0x2D3DD0AE, 0x1F1C1B1A, 0x00400007, 0x9960034C, 0xBA0DC66B, 0x3D65ABCD,
+                  0x04C11DB6, 0x1EDC6F40, 0x741B8CD6, 0x814141AA ]
+        models = [ ( poly, refin ) for poly in polys for refin in ( False, True ) ]
+        expected = [ _crc32.hacker32( data, poly=poly, refin=refin, refout=refin, reinit=True ) for poly, refin in models ]
+        for _ in range( 3 ):
+            self.assertEqual( [ _crc32.hacker32( data, poly=poly, refin=refin, refout=refin ) for poly, refin in models ], expected )
+            self.assertEqual( [ _crc32.hacker32( data, poly=poly, refin=refin, refout=refin ) for poly, refin in models[:8] ], expected[:8] )
+        for poly in ( 0x07, 0x31, 0x9B, 0x1D, 0x2F, 0xD5 ):
+            self.assertEqual( _crc8.hacker8( data, poly=poly ), _crc8.hacker8( data, poly=poly, reinit=True ) )
+        self.assertEqual( _crc32.hacker32( b'123456789' ), 0xCBF43926 )
+
+    def test_model( self ):
+        """ libscrc.CRC( width, poly, init, refin, refout, xorout ) against the catalogue check values.
+        """
+        models = [ ( ( 3,  0x3,                0x0,                0,     0,     0x7                ), 0x4                ),
+                   ( ( 5,  0x05,               0x1F,               True,  True,  0x1F               ), 0x19               ),
+                   ( ( 7,  0x09,               0x00,               False, False, 0x00               ), 0x75               ),
+                   ( ( 10, 0x233,              0x000,              False, False, 0x000              ), 0x199              ),
+                   ( ( 12, 0x80F,              0x000,              False, True,  0x000              ), 0xDAF              ),
+                   ( ( 31, 0x04C11DB7,         0x7FFFFFFF,         False, False, 0x7FFFFFFF         ), 0x0CE9E46C         ),
+                   ( ( 32, 0x04C11DB7,         0xFFFFFFFF,         True,  True,  0xFFFFFFFF         ), 0xCBF43926         ),
+                   ( ( 40, 0x0004820009,       0x0000000000,       False, False, 0xFFFFFFFFFF       ), 0xD4164FC646       ),
+                   ( ( 64, 0x42F0E1EBA9EA3693, 0xFFFFFFFFFFFFFFFF, True,  True,  0xFFFFFFFFFFFFFFFF ), 0x995DC9BBDF1939FA ) ]
+        data = bytes( bytearray( ( i * 13 + 5 ) & 0xFF for i in range( 70000 ) ) )
+        for args, check in models:
+            model = libscrc.CRC( *args )
+            self.assertEqual( model( b'123456789' ), check )
+            self.assertEqual( model.check, check )
+            self.assertEqual( model( b'56789', model( b'1234' ) ), check )
+            self.assertEqual( model.combine( model( b'1234' ), model( b'56789' ), 5 ), check )
+            self.assertEqual( model.new( b'1234' ).intdigest(), model( b'1234' ) )
+            self.assertEqual( model( data, threads=4 ), model( data ) )
+            self.assertEqual( model.extend_zeros( model( b'1234' ), 4097 ), model( b'1234' + bytes( 4097 ) ) )
+            self.assertEqual( model.extend_repeat( model( b'1234' ), b'56789', 77 ), model( b'1234' + b'56789' * 77 ) )
+            self.assertEqual( model.update_range( model( data[:500] ), 10, data[10:13], b'abc', 500 ), model( data[:10] + b'abc' + data[13:500] ) )
+
+        model = libscrc.CRC( width=16, poly=0x8005, init=0xFFFF, refin=True, refout=True )
+        self.assertEqual( model( b'123456789' ), libscrc.modbus( b'123456789' ) )
+        self.assertEqual( ( model.width, model.poly, model.init, model.refin, model.refout, model.xorout ), ( 16, 0x8005, 0xFFFF, True, True, 0 ) )
+        hasher = model.new()
+        hasher.update( b'1234' )
+        hasher.update( b'56789' )
+        self.assertEqual( hasher.intdigest(), libscrc.modbus( b'123456789' ) )
+
+        self.assertRaises( ValueError, libscrc.CRC, 0, 0x1 )
+        self.assertRaises( ValueError, libscrc.CRC, 65, 0x1 )
+        self.assertRaises( ValueError, libscrc.CRC, 8, 0x107 )
+        self.assertRaises( ValueError, libscrc.CRC, 8, 0x07, 0x100 )
+        self.assertRaises( ValueError, libscrc.CRC( 12, 0x80F ).combine, 0xFFFFF, 0, 3 )
+        self.assertRaises( ValueError, libscrc.CRC( 12, 0x80F ).combine, 0, 0, -3 )
+        self.assertRaises( ValueError, libscrc.CRC( 12, 0x80F ).extend_zeros, 0x1000, 1 )
+        self.assertRaises( ValueError, libscrc.CRC( 12, 0x80F ).extend_repeat, 0x1000, b'1', 1 )
+        self.assertRaises( ValueError, libscrc.CRC( 12, 0x80F ).extend_zeros, 0, -1 )
+        self.assertRaises( ValueError, libscrc.CRC( 12, 0x80F ).update_range, 0x1000, 0, b'a', b'b', 5 )
+
     def test_basics( self ):
         """ Test basic functionality.
         """
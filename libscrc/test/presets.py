@@ -0,0 +1,101 @@
+# -*- coding:utf-8 -*-
+""" Tests shared by the family test modules """
+# !/usr/bin/python
+# Python:   3.5.2+
+# Platform: Windows/Linux/MacOS/ARMv7
+# Program:  Every named preset of one family module against its own one shot function.
+# Package:  pip install libscrc.
+
+import libscrc
+
+class PresetsTest( object ):
+    """ Mixed into the TestCase of a family, module is the extension module ( _crc8, _crc16 ... ) under test.
+    """
+    module = None
+
+    def presets( self ):
+        """ ( name, function ) of every named preset of the module.
+        """
+        return [ ( name, getattr( libscrc, name ) ) for name in self.module._presets() ]
+
+    def test_presets_threads( self ):
+        """ threads= must give the serial result, gradually too.
+        """
+        data = bytes( bytearray( ( i * 29 + 7 ) & 0xFF for i in range( ( 3 << 20 ) + 4321 ) ) )
+        for name, function in self.presets():
+            expected = function( data )
+            for threads in ( 0, 2, 3 ):
+                self.assertEqual( function( data, threads=threads ), expected, name )
+            self.assertEqual( function( data[1000:], function( data[:1000] ), threads=4 ), expected, name )
+            self.assertRaises( ValueError, function, data, threads=-1 )
+
+    def test_presets_combine( self ):
+        """ combine( name, CRC( A ), CRC( B ), len( B ) ) must be CRC( A || B ), a CRC wider than the preset is refused.
+        """
+        data = bytes( bytearray( ( i * 31 + 11 ) & 0xFF for i in range( 70000 ) ) )
+        for name, function in self.presets():
+            for split, end in ( ( 0, 0 ), ( 0, 9 ), ( 9, 9 ), ( 1, 2 ), ( 13, 213 ), ( 1000, 70000 ) ):
+                crc = libscrc.combine( name, function( data[:split] ), function( data[split:end] ), end - split )
+                self.assertEqual( crc, function( data[:end] ), name )
+            width = libscrc.new( name ).width
+            self.assertRaises( ( ValueError, OverflowError ), libscrc.combine, name, 1 << width, 0, 1 )
+            self.assertRaises( ( ValueError, OverflowError ), libscrc.combine, name, 0, 1 << width, 1 )
+            self.assertRaises( ValueError, libscrc.combine, name, 0, 0, -1 )
+
+    def test_presets_hasher( self ):
+        """ new( name ).update() over pieces must give the preset function of the whole buffer.
+        """
+        data = bytes( bytearray( ( i * 17 + 3 ) & 0xFF for i in range( 3000 ) ) )
+        for name, function in self.presets():
+            hasher = libscrc.new( name )
+            self.assertEqual( hasher.intdigest(), function( b'' ), name )
+            for start, end in ( ( 0, 1 ), ( 1, 17 ), ( 17, 300 ), ( 300, 3000 ) ):
+                hasher.update( data[start:end] )
+            clone = hasher.copy()
+            clone.update( b'123' )
+            self.assertEqual( hasher.intdigest(), function( data ), name )
+            self.assertEqual( clone.intdigest(),  function( data + b'123' ), name )
+            self.assertEqual( hasher.name, name )
+            self.assertEqual( hasher.digest_size, ( hasher.width + 7 ) // 8 )
+            self.assertEqual( hasher.hexdigest(), '{0:0{1}x}'.format( function( data ), 2 * hasher.digest_size ) )
+
+    def test_presets_batch( self ):
+        """ batch() over a list, over offsets / lengths and against expected CRCs must match the preset function.
+        """
+        data    = bytes( bytearray( ( i * 29 + 7 ) & 0xFF for i in range( 4000 ) ) )
+        pieces  = [ data[i * i:( i + 1 ) * ( i + 1 )] for i in range( 60 ) ]
+        offsets = [ i * i for i in range( 61 ) ]
+        for name, function in self.presets():
+            expected = [ function( piece ) for piece in pieces ]
+            self.assertEqual( libscrc.batch( name, pieces ).tolist(), expected, name )
+            self.assertEqual( libscrc.batch( name, data, offsets=offsets ).tolist(), expected, name )
+            self.assertEqual( libscrc.batch( name, data, offsets=offsets[:-1], lengths=[ len( piece ) for piece in pieces ] ).tolist(), expected, name )
+            expected[5] ^= 1
+            self.assertEqual( bytes( libscrc.batch( name, pieces, expected=expected ) ), b'\xdf' + b'\xff' * 6 + b'\x0f', name )
+
+    def test_presets_extend( self ):
+        """ extend_zeros() / extend_repeat() must match the CRC of the materialised data, a CRC wider than the preset is refused.
+        """
+        head  = b'123456789'
+        block = bytes( bytearray( range( 7, 44 ) ) )
+        for name, function in self.presets():
+            for n in ( 0, 1, 15, 1000 ):
+                self.assertEqual( libscrc.extend_zeros( name, function( head ), n ), function( head + bytes( n ) ), name )
+            for count in ( 0, 1, 6, 301 ):
+                self.assertEqual( libscrc.extend_repeat( name, function( head ), block, count ), function( head + block * count ), name )
+            self.assertEqual( libscrc.extend_repeat( name, function( head ), b'', 99 ), function( head ), name )
+            width = libscrc.new( name ).width
+            self.assertRaises( ( ValueError, OverflowError ), libscrc.extend_zeros, name, 1 << width, 1 )
+            self.assertRaises( ( ValueError, OverflowError ), libscrc.extend_repeat, name, 1 << width, b'1', 1 )
+
+    def test_presets_update_range( self ):
+        """ update_range() after rewriting a range must match the CRC of the new message, at both ends and in the middle.
+        """
+        block = bytes( bytearray( ( i * 23 + 1 ) & 0xFF for i in range( 5000 ) ) )
+        for name, function in self.presets():
+            for offset, new in ( ( 0, b'\x01\x02\x03' ), ( 2500, b'\xff' * 16 ), ( 4996, b'tail' ), ( 100, b'' ) ):
+                patched = block[:offset] + new + block[offset + len( new ):]
+                self.assertEqual( libscrc.update_range( name, function( block ), offset, block[offset:offset + len( new )], new, len( block ) ),
+                                  function( patched ), name )
+            width = libscrc.new( name ).width
+            self.assertRaises( ( ValueError, OverflowError ), libscrc.update_range, name, 1 << width, 0, b'a', b'b', 5 )
@@ -2,7 +2,9 @@
 """ Setup script for CRC8/CRC16/CRC24/CRC32/CRC64/CRC82 library. """
 from os import path
 from setuptools import setup, find_packages, Extension
+from setuptools.command.build_ext import build_ext
 from codecs import open
+import sys
 
 # !/usr/bin/python
 # Python:   3.5.2+
@@ -28,6 +30,22 @@ with open(path.join(here, 'README.rst'), encoding='utf-8') as f:
     long_description = f.read()
     long_description = long_description.replace("\r", "")
 
+sys.path.insert( 0, path.join( here, 'src', 'common' ) )
+import gentables
+
+
+class hexin_build_ext( build_ext ):
+    """ Write _<family>presets.h ( static const tables of the named presets ) before compiling. """
+    def build_extension( self, ext ):
+        family = ext.name.rsplit( '._', 1 )[-1]
+        target = path.join( self.build_temp, 'presets' )
+        gentables.generate( family, path.join( here, 'src' ), target )
+        if target not in ext.include_dirs:
+            ext.include_dirs.append( target )
+        ext.depends = list( ext.depends ) + [ path.join( 'src', 'common', 'gentables.py' ) ]
+        build_ext.build_extension( self, ext )
+
+
 setup(
     name='libscrc',
     version='1.8.1',
@@ -79,12 +97,14 @@ setup(
 
     include_package_data=True,
 
-    ext_modules=[Extension('libscrc._crcx',  sources=['src/crcx/_crcxmodule.c',   'src/crcx/_crcxtables.c'], include_dirs=['src/crcx' ]),
-                 Extension('libscrc._canx',  sources=['src/canx/_canxmodule.c',   'src/canx/_canxtables.c'], include_dirs=['src/canx' ]),
-                 Extension('libscrc._crc8',  sources=['src/crc8/_crc8module.c',   'src/crc8/_crc8tables.c'], include_dirs=['src/crc8' ]),
-                 Extension('libscrc._crc16', sources=['src/crc16/_crc16module.c', 'src/crc16/_crc16tables.c'], include_dirs=['src/crc16' ]),
-                 Extension('libscrc._crc24', sources=['src/crc24/_crc24module.c', 'src/crc24/_crc24tables.c'], include_dirs=['src/crc24' ]),
-                 Extension('libscrc._crc32', sources=['src/crc32/_crc32module.c', 'src/crc32/_crc32tables.c'], include_dirs=['src/crc32' ]),
-                 Extension('libscrc._crc64', sources=['src/crc64/_crc64module.c', 'src/crc64/_crc64tables.c'], include_dirs=['src/crc64' ]),
+    cmdclass={ 'build_ext' : hexin_build_ext },
+
+    ext_modules=[Extension('libscrc._crcx',  sources=['src/crcx/_crcxmodule.c',   'src/crcx/_crcxtables.c', 'src/common/_clmulfold.c', 'src/common/_dispatch.c', 'src/common/_combine.c', 'src/common/_parallel.c', 'src/common/_hasher.c', 'src/common/_batch.c', 'src/common/_fastcall.c', 'src/common/_hacker.c', 'src/common/_file.c', 'src/common/_multi.c'], include_dirs=['src/crcx', 'src/common' ]),
+                 Extension('libscrc._canx',  sources=['src/canx/_canxmodule.c',   'src/canx/_canxtables.c', 'src/common/_clmulfold.c', 'src/common/_dispatch.c', 'src/common/_combine.c', 'src/common/_parallel.c', 'src/common/_hasher.c', 'src/common/_batch.c', 'src/common/_fastcall.c', 'src/common/_hacker.c', 'src/common/_file.c', 'src/common/_multi.c'], include_dirs=['src/canx', 'src/common' ]),
+                 Extension('libscrc._crc8',  sources=['src/crc8/_crc8module.c',   'src/crc8/_crc8tables.c', 'src/common/_clmulfold.c', 'src/common/_dispatch.c', 'src/common/_combine.c', 'src/common/_parallel.c', 'src/common/_hasher.c', 'src/common/_batch.c', 'src/common/_fastcall.c', 'src/common/_hacker.c', 'src/common/_file.c', 'src/common/_multi.c'], include_dirs=['src/crc8', 'src/common' ]),
+                 Extension('libscrc._crc16', sources=['src/crc16/_crc16module.c', 'src/crc16/_crc16tables.c', 'src/common/_clmulfold.c', 'src/common/_dispatch.c', 'src/common/_combine.c', 'src/common/_parallel.c', 'src/common/_hasher.c', 'src/common/_batch.c', 'src/common/_fastcall.c', 'src/common/_hacker.c', 'src/common/_file.c', 'src/common/_multi.c'], include_dirs=['src/crc16', 'src/common' ]),
+                 Extension('libscrc._crc24', sources=['src/crc24/_crc24module.c', 'src/crc24/_crc24tables.c', 'src/common/_clmulfold.c', 'src/common/_dispatch.c', 'src/common/_combine.c', 'src/common/_parallel.c', 'src/common/_hasher.c', 'src/common/_batch.c', 'src/common/_fastcall.c', 'src/common/_hacker.c', 'src/common/_file.c', 'src/common/_multi.c'], include_dirs=['src/crc24', 'src/common' ]),
+                 Extension('libscrc._crc32', sources=['src/crc32/_crc32module.c', 'src/crc32/_crc32tables.c', 'src/crc32/_crc32sse42.c', 'src/common/_clmulfold.c', 'src/common/_dispatch.c', 'src/common/_combine.c', 'src/common/_parallel.c', 'src/common/_hasher.c', 'src/common/_batch.c', 'src/common/_fastcall.c', 'src/common/_hacker.c', 'src/common/_file.c', 'src/common/_multi.c'], include_dirs=['src/crc32', 'src/common' ]),
+                 Extension('libscrc._crc64', sources=['src/crc64/_crc64module.c', 'src/crc64/_crc64tables.c', 'src/common/_clmulfold.c', 'src/common/_dispatch.c', 'src/common/_combine.c', 'src/common/_parallel.c', 'src/common/_hasher.c', 'src/common/_batch.c', 'src/common/_fastcall.c', 'src/common/_hacker.c', 'src/common/_file.c', 'src/common/_multi.c'], include_dirs=['src/crc64', 'src/common' ]),
                 ],
 )
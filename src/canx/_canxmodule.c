@@ -19,135 +19,474 @@
 
 #define PY_SSIZE_T_CLEAN
 #include <Python.h>
+#include <string.h>
 #include "_canxtables.h"
+#include "_canxpresets.h"
+#include "_hasher.h"
+#include "_batch.h"
+#include "_file.h"
+#include "_multi.h"
+#include "_fastcall.h"
 
-static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, PyObject *args, struct _hexin_canx *param )
+static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, HEXIN_FASTCALL_PARAMS, const struct _hexin_canx *preset, unsigned int *result )
 {
+    struct _hexin_canx local = *preset;       /* Per-call state, the preset is shared by every thread */
+    struct _hexin_canx *param = &local;
     Py_buffer data = { NULL, NULL };
-    unsigned int init = param->init;
+    unsigned long long value = param->init;     /* Fixed Issues #4  */
+    unsigned int threads = 1;
+    int is_gradual = hexin_fastcall_preset( HEXIN_FASTCALL_ARGS, &data, &value, &threads );
+    unsigned int init = ( unsigned int )value;
 
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTuple( args, "y*|I", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
-    }
-#else
-    if ( !PyArg_ParseTuple( args, "s*|I", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
+    if ( is_gradual < 0 ) {
         return FALSE;
     }
-#endif /* PY_MAJOR_VERSION */
 
     /* Fixed Issues #4  */
-    param->is_gradual = ( unsigned int )PyTuple_Size( args );   // Fixed warning C4244
+    param->is_gradual = ( unsigned int )is_gradual;
     if ( HEXIN_GRADUAL_CALCULATE_IS_TRUE( param ) ) {
         init = ( init ^ param->xorout );
     }
 
-    param->result = hexin_canx_compute( (const unsigned char *)data.buf, (unsigned int)data.len, param, init );
-
-    if ( data.obj )
-       PyBuffer_Release( &data );
+    if ( hexin_parallel_threads( ( size_t )data.len, threads ) > 1 ) {
+        Py_BEGIN_ALLOW_THREADS
+        *result = hexin_canx_compute_parallel( (const unsigned char *)data.buf, (size_t)data.len, param, init, threads );
+        Py_END_ALLOW_THREADS
+    } else if ( ( size_t )data.len < hexin_gil_threshold() ) {
+        *result = hexin_canx_compute( (const unsigned char *)data.buf, (size_t)data.len, param, init );
+    } else {
+        Py_BEGIN_ALLOW_THREADS
+        *result = hexin_canx_compute( (const unsigned char *)data.buf, (size_t)data.len, param, init );
+        Py_END_ALLOW_THREADS
+    }
 
+    PyBuffer_Release( &data );
     return TRUE;
 }
 
-static PyObject * _canx_can15( PyObject *self, PyObject *args )
+#if PY_MAJOR_VERSION >= 3
+static const struct _hexin_canx canx_param_can15 = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                               .width  = 15,
+                                               .poly   = CAN15_POLYNOMIAL_00004599,
+                                               .init   = 0x00000000L,
+                                               .refin  = FALSE,
+                                               .refout = FALSE,
+                                               .xorout = 0x00000000L,
+                                               .table  = hexin_crc15_table_4599_normal,
+                                               .clmul  = &hexin_crc15_clmul_4599,
+                                               .combine= &hexin_crc15_combine_4599 };
+#else
+static const struct _hexin_canx canx_param_can15 = { HEXIN_TABLE_IS_NORMAL,
+                                               FALSE,
+                                               15,
+                                               CAN15_POLYNOMIAL_00004599,
+                                               0x00000000L,
+                                               FALSE,
+                                               FALSE,
+                                               0x00000000L,
+                                               0,
+                                               hexin_crc15_table_4599_normal,
+                                               &hexin_crc15_clmul_4599,
+                                               &hexin_crc15_combine_4599 };
+#endif  /* PY_MAJOR_VERSION */
+
+static PyObject * _canx_can15( PyObject *self, HEXIN_FASTCALL_PARAMS )
+{
+    unsigned int result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &canx_param_can15 , &result ) ) {
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLong( (unsigned short)( result & 0x00007FFF ) );
+}
+
+#if PY_MAJOR_VERSION >= 3
+static const struct _hexin_canx canx_param_can17 = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                               .width  = 17,
+                                               .poly   = CAN17_POLYNOMIAL_0001685B,
+                                               .init   = 0x00000000L,
+                                               .refin  = FALSE,
+                                               .refout = FALSE,
+                                               .xorout = 0x00000000L,
+                                               .table  = hexin_crc17_table_1685B_normal,
+                                               .clmul  = &hexin_crc17_clmul_1685B,
+                                               .combine= &hexin_crc17_combine_1685B };
+#else
+static const struct _hexin_canx canx_param_can17 = { HEXIN_TABLE_IS_NORMAL,
+                                               FALSE,
+                                               17,
+                                               CAN17_POLYNOMIAL_0001685B,
+                                               0x00000000L,
+                                               FALSE,
+                                               FALSE,
+                                               0x00000000L,
+                                               0,
+                                               hexin_crc17_table_1685B_normal,
+                                               &hexin_crc17_clmul_1685B,
+                                               &hexin_crc17_combine_1685B };
+#endif /* PY_MAJOR_VERSION */
+
+static PyObject * _canx_can17( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
+    unsigned int result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &canx_param_can17 , &result ) ) {
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLong( (result & 0x1FFFF) );
+}
+
 #if PY_MAJOR_VERSION >= 3
-    static struct _hexin_canx canx_param_can15 = { .is_initial=FALSE,
-                                                   .width  = 15,
-                                                   .poly   = CAN15_POLYNOMIAL_00004599,
-                                                   .init   = 0x00000000L,
-                                                   .refin  = FALSE,
-                                                   .refout = FALSE,
-                                                   .xorout = 0x00000000L,
-                                                   .result = 0 };
+static const struct _hexin_canx canx_param_can21 = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                               .width  = 21,
+                                               .poly   = CAN21_POLYNOMIAL_00102899,
+                                               .init   = 0x00000000L,
+                                               .refin  = FALSE,
+                                               .refout = FALSE,
+                                               .xorout = 0x00000000L,
+                                               .table  = hexin_crc21_table_102899_normal,
+                                               .clmul  = &hexin_crc21_clmul_102899,
+                                               .combine= &hexin_crc21_combine_102899 };
 #else
-    static struct _hexin_canx canx_param_can15 = { FALSE,
-                                                   15,
-                                                   CAN15_POLYNOMIAL_00004599,
-                                                   0x00000000L,
-                                                   FALSE,
-                                                   FALSE,
-                                                   0x00000000L,
-                                                   0 };
+static const struct _hexin_canx canx_param_can21 = { HEXIN_TABLE_IS_NORMAL,
+                                               FALSE,
+                                               21,
+                                               CAN21_POLYNOMIAL_00102899,
+                                               0x00000000L,
+                                               FALSE,
+                                               FALSE,
+                                               0x00000000L,
+                                               0,
+                                               hexin_crc21_table_102899_normal,
+                                               &hexin_crc21_clmul_102899,
+                                               &hexin_crc21_combine_102899 };
 #endif  /* PY_MAJOR_VERSION */
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &canx_param_can15 ) ) {
+static PyObject * _canx_can21( PyObject *self, HEXIN_FASTCALL_PARAMS )
+{
+    unsigned int result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &canx_param_can21 , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", (unsigned short)( canx_param_can15.result & 0x00007FFF ) );
+    return PyLong_FromUnsignedLong( (result & 0x001FFFFF) );
+}
+
+/* Named presets, the method names of the table below */
+static struct {
+    const char          *name;
+    const struct _hexin_canx *param;
+} _canx_presets[] = {
+    { "can15",&canx_param_can15 },
+    { "can17",&canx_param_can17 },
+    { "can21",&canx_param_can21 },
+    { NULL, NULL }
+};
+
+static const struct _hexin_canx *hexin_canx_preset( const char *name )
+{
+    unsigned int i = 0;
+
+    for ( i=0; _canx_presets[i].name != NULL; i++ ) {
+        if ( 0 == strcmp( _canx_presets[i].name, name ) ) {
+            return _canx_presets[i].param;
+        }
+    }
+    return NULL;
 }
 
-static PyObject * _canx_can17( PyObject *self, PyObject *args )
+static PyObject * _canx_presets_list( PyObject *self, PyObject *args )
 {
+    unsigned int i = 0;
+    PyObject *names = PyList_New( 0 );
+
+    for ( i=0; ( names != NULL ) && ( _canx_presets[i].name != NULL ); i++ ) {
+        PyObject *name = Py_BuildValue( "s", _canx_presets[i].name );
+        if ( ( name == NULL ) || ( PyList_Append( names, name ) < 0 ) ) {
+            Py_XDECREF( name );
+            Py_DECREF( names );
+            return NULL;
+        }
+        Py_DECREF( name );
+    }
+    return names;
+}
+
+static PyObject * _canx_combine( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    unsigned long long crc_a = 0, crc_b = 0, len_b = 0, mask = 0;
+    const struct _hexin_canx *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "sO&O&O&", &name, hexin_PyArg_count, &crc_a, hexin_PyArg_count, &crc_b, hexin_PyArg_count, &len_b ) ) {
+        return NULL;
+    }
+
+    param = hexin_canx_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+
+    mask = ( param->width >= 64 ) ? ~0ULL : ( ( 1ULL << param->width ) - 1 );
+    if ( ( crc_a | crc_b ) & ~mask ) {
+        PyErr_Format( PyExc_ValueError, "%s is a %u-bit CRC", name, ( unsigned int )param->width );
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLongLong( hexin_canx_combine( param, ( unsigned int )crc_a, ( unsigned int )crc_b, len_b ) );
+}
+
+static PyObject * _canx_extend_zeros( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    unsigned long long crc = 0, len = 0, mask = 0;
+    const struct _hexin_canx *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "sO&O&", &name, hexin_PyArg_count, &crc, hexin_PyArg_count, &len ) ) {
+        return NULL;
+    }
+
+    param = hexin_canx_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+
+    mask = ( param->width >= 64 ) ? ~0ULL : ( ( 1ULL << param->width ) - 1 );
+    if ( crc & ~mask ) {
+        PyErr_Format( PyExc_ValueError, "%s is a %u-bit CRC", name, ( unsigned int )param->width );
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLongLong( hexin_canx_extend_zeros( param, ( unsigned int )crc, len ) );
+}
+
+static PyObject * _canx_extend_repeat( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    unsigned long long crc = 0, count = 0, mask = 0;
+    const struct _hexin_canx *param = NULL;
+    Py_buffer data = { NULL, NULL };
+    unsigned int result = 0;
+
 #if PY_MAJOR_VERSION >= 3
-    static struct _hexin_canx canx_param_can17 = { .is_initial=FALSE,
-                                                   .width  = 17,
-                                                   .poly   = CAN17_POLYNOMIAL_0001685B,
-                                                   .init   = 0x00000000L,
-                                                   .refin  = FALSE,
-                                                   .refout = FALSE,
-                                                   .xorout = 0x00000000L,
-                                                   .result = 0 };
+    if ( !PyArg_ParseTuple( args, "sO&y*O&", &name, hexin_PyArg_count, &crc, &data, hexin_PyArg_count, &count ) ) {
 #else
-    static struct _hexin_canx canx_param_can17 = { FALSE,
-                                                   17,
-                                                   CAN17_POLYNOMIAL_0001685B,
-                                                   0x00000000L,
-                                                   FALSE,
-                                                   FALSE,
-                                                   0x00000000L,
-                                                   0 };
+    if ( !PyArg_ParseTuple( args, "sO&s*O&", &name, hexin_PyArg_count, &crc, &data, hexin_PyArg_count, &count ) ) {
 #endif /* PY_MAJOR_VERSION */
+        return NULL;
+    }
+
+    param = hexin_canx_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        PyBuffer_Release( &data );
+        return NULL;
+    }
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &canx_param_can17 ) ) {
+    mask = ( param->width >= 64 ) ? ~0ULL : ( ( 1ULL << param->width ) - 1 );
+    if ( crc & ~mask ) {
+        PyErr_Format( PyExc_ValueError, "%s is a %u-bit CRC", name, ( unsigned int )param->width );
+        PyBuffer_Release( &data );
         return NULL;
     }
 
-    return Py_BuildValue( "I", (canx_param_can17.result & 0x1FFFF) );
+    if ( ( size_t )data.len < hexin_gil_threshold() ) {
+        result = hexin_canx_extend_repeat( param, ( unsigned int )crc, ( const unsigned char * )data.buf, ( size_t )data.len, count );
+    } else {
+        Py_BEGIN_ALLOW_THREADS
+        result = hexin_canx_extend_repeat( param, ( unsigned int )crc, ( const unsigned char * )data.buf, ( size_t )data.len, count );
+        Py_END_ALLOW_THREADS
+    }
+    PyBuffer_Release( &data );
+    return PyLong_FromUnsignedLongLong( result );
 }
 
-static PyObject * _canx_can21( PyObject *self, PyObject *args )
+static PyObject * _canx_update_range( PyObject *self, PyObject *args )
 {
+    const char *name = NULL;
+    unsigned long long crc = 0, offset = 0, total = 0, mask = 0;
+    const struct _hexin_canx *param = NULL;
+    Py_buffer before = { NULL, NULL }, after = { NULL, NULL };
+    PyObject *result = NULL;
+
 #if PY_MAJOR_VERSION >= 3
-    static struct _hexin_canx canx_param_can21= { .is_initial=FALSE,
-                                                   .width  = 21,
-                                                   .poly   = CAN21_POLYNOMIAL_00102899,
-                                                   .init   = 0x00000000L,
-                                                   .refin  = FALSE,
-                                                   .refout = FALSE,
-                                                   .xorout = 0x00000000L,
-                                                   .result = 0 };
+    if ( !PyArg_ParseTuple( args, "sO&O&y*y*O&", &name, hexin_PyArg_count, &crc, hexin_PyArg_count, &offset, &before, &after, hexin_PyArg_count, &total ) ) {
 #else
-    static struct _hexin_canx canx_param_can21 = { FALSE,
-                                                   21,
-                                                   CAN21_POLYNOMIAL_00102899,
-                                                   0x00000000L,
-                                                   FALSE,
-                                                   FALSE,
-                                                   0x00000000L,
-                                                   0 };
-#endif  /* PY_MAJOR_VERSION */
+    if ( !PyArg_ParseTuple( args, "sO&O&s*s*O&", &name, hexin_PyArg_count, &crc, hexin_PyArg_count, &offset, &before, &after, hexin_PyArg_count, &total ) ) {
+#endif /* PY_MAJOR_VERSION */
+        return NULL;
+    }
+
+    param = hexin_canx_preset( name );
+    mask  = ( ( param == NULL ) || ( param->width >= 64 ) ) ? ~0ULL : ( ( 1ULL << param->width ) - 1 );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+    } else if ( crc & ~mask ) {
+        PyErr_Format( PyExc_ValueError, "%s is a %u-bit CRC", name, ( unsigned int )param->width );
+    } else if ( before.len != after.len ) {
+        PyErr_SetString( PyExc_ValueError, "old_bytes and new_bytes differ in length" );
+    } else if ( ( offset > total ) || ( ( unsigned long long )before.len > total - offset ) ) {
+        PyErr_SetString( PyExc_ValueError, "the range is out of the message" );
+    } else {
+        result = PyLong_FromUnsignedLongLong( hexin_canx_update_range( param, ( unsigned int )crc, ( const unsigned char * )before.buf, ( const unsigned char * )after.buf,
+                                                                       ( size_t )before.len, total - offset - ( unsigned long long )before.len ) );
+    }
+    PyBuffer_Release( &before );
+    PyBuffer_Release( &after );
+    return result;
+}
+
+static unsigned long long hexin_canx_hasher_begin( const void *param )
+{
+    struct _hexin_canx local = *( const struct _hexin_canx * )param;
+
+    local.is_gradual = FALSE;
+    return hexin_canx_compute_begin( &local, local.init );
+}
+
+static unsigned long long hexin_canx_hasher_update( const void *param, unsigned long long crc, const unsigned char *pSrc, size_t len )
+{
+    return hexin_canx_compute_update( ( const struct _hexin_canx * )param, ( unsigned int )crc, pSrc, len );
+}
+
+static unsigned long long hexin_canx_hasher_end( const void *param, unsigned long long crc )
+{
+    return hexin_canx_compute_end( ( const struct _hexin_canx * )param, ( unsigned int )crc );
+}
+
+static const struct _hexin_hasher_ops canx_hasher_ops = { hexin_canx_hasher_begin, hexin_canx_hasher_update, hexin_canx_hasher_end };
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &canx_param_can21 ) ) {
+static PyObject * _canx_new( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    const struct _hexin_canx *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "s", &name ) ) {
+        return NULL;
+    }
+
+    param = hexin_canx_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+    return hexin_hasher_new( &canx_hasher_ops, param, name, param->width, NULL );
+}
+
+static PyObject * _canx_batch( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    PyObject *data = NULL, *out = NULL, *offsets = Py_None, *lengths = Py_None, *expected = Py_None;
+    int rows = 0;
+    const struct _hexin_canx *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "sOO|OOOi", &name, &data, &out, &offsets, &lengths, &expected, &rows ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", (canx_param_can21.result & 0x001FFFFF) );
+    param = hexin_canx_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+    return hexin_batch_compute( &canx_hasher_ops, param, param->width, data, out,
+                                ( offsets  == Py_None ) ? NULL : offsets,
+                                ( lengths  == Py_None ) ? NULL : lengths,
+                                ( expected == Py_None ) ? NULL : expected, rows );
+}
+
+static PyObject * _canx_file( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    PyObject *file = NULL;
+    const struct _hexin_canx *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "sO", &name, &file ) ) {
+        return NULL;
+    }
+
+    param = hexin_canx_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+    return hexin_file_compute( &canx_hasher_ops, param, file );
+}
+
+static PyObject * _canx_files( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    PyObject *files = NULL;
+    unsigned int threads = 0;
+    const struct _hexin_canx *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "sO|O&", &name, &files, hexin_PyArg_threads, &threads ) ) {
+        return NULL;
+    }
+
+    param = hexin_canx_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+    return hexin_file_compute_many( &canx_hasher_ops, param, files, threads );
+}
+
+static PyObject * _canx_capsule( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    const struct _hexin_canx *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "s", &name ) ) {
+        return NULL;
+    }
+
+    param = hexin_canx_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+    return hexin_multi_capsule( &canx_hasher_ops, param, NULL );
+}
+
+static PyObject * _canx_kernels( PyObject *self, PyObject *args )
+{
+    return Py_BuildValue( "{s:s}", "canx", hexin_clmul_kernel() );
+}
+
+static PyObject * _canx_gil_threshold( PyObject *self, PyObject *args )
+{
+    Py_ssize_t threshold = -1;
+
+    if ( !PyArg_ParseTuple( args, "|n", &threshold ) ) {
+        return NULL;
+    }
+    return PyLong_FromSize_t( hexin_set_gil_threshold( ( threshold < 0 ) ? ( size_t )-1 : ( size_t )threshold ) );
 }
 
 /* method table */
 static PyMethodDef _canxMethods[] = {
-    { "can15",      (PyCFunction)_canx_can15, METH_VARARGS, "Calculate CAN15 [Poly=0x004599, Init=0 Xorout=0 Refin=FALSE Refout=FALSE]"   },
-    { "can17",      (PyCFunction)_canx_can17, METH_VARARGS, "Calculate CAN17 [Poly=0x01685B, Init=0 Xorout=0 Refin=FALSE Refout=FALSE]"  },
-    { "can21",      (PyCFunction)_canx_can21, METH_VARARGS, "Calculate CAN21 [Poly=0x102899, Init=0 Xorout=0 Refin=FALSE Refout=FALSE]" },
+    { "can15",      (PyCFunction)_canx_can15, HEXIN_METH_FASTCALL, "Calculate CAN15 [Poly=0x004599, Init=0 Xorout=0 Refin=FALSE Refout=FALSE]"   },
+    { "can17",      (PyCFunction)_canx_can17, HEXIN_METH_FASTCALL, "Calculate CAN17 [Poly=0x01685B, Init=0 Xorout=0 Refin=FALSE Refout=FALSE]"  },
+    { "can21",      (PyCFunction)_canx_can21, HEXIN_METH_FASTCALL, "Calculate CAN21 [Poly=0x102899, Init=0 Xorout=0 Refin=FALSE Refout=FALSE]" },
+    { "_kernels",    (PyCFunction)_canx_kernels, METH_NOARGS, "The kernel tier every family of this module is bound to." },
+    { "_gil_threshold", (PyCFunction)_canx_gil_threshold, METH_VARARGS, "Release the GIL for buffers of at least this many bytes, returns the previous value." },
+    { "_presets",    (PyCFunction)_canx_presets_list, METH_NOARGS, "The names of the presets of this module." },
+    { "_combine",    (PyCFunction)_canx_combine, METH_VARARGS, "CRC( A || B ) of a preset : _combine( name, crc_a, crc_b, len_b )" },
+    { "_extend_zeros",  (PyCFunction)_canx_extend_zeros,  METH_VARARGS, "CRC( A || n zero bytes ) : _extend_zeros( name, crc, n )" },
+    { "_extend_repeat", (PyCFunction)_canx_extend_repeat, METH_VARARGS, "CRC( A || block * count ) : _extend_repeat( name, crc, block, count )" },
+    { "_update_range",  (PyCFunction)_canx_update_range,  METH_VARARGS, "CRC after a range was rewritten : _update_range( name, crc, offset, old, new, total_len )" },
+    { "_new",        (PyCFunction)_canx_new, METH_VARARGS, "A hashlib-style hasher of a preset : _new( name )" },
+    { "_batch",      (PyCFunction)_canx_batch, METH_VARARGS, "CRC of many buffers into an integer array : _batch( name, data, out, offsets, lengths, expected, rows )" },
+    { "_file",       (PyCFunction)_canx_file, METH_VARARGS, "CRC of a file without the GIL : _file( name, path or fd )" },
+    { "_files",      (PyCFunction)_canx_files, METH_VARARGS, "( crc, size ) of many files on a thread pool : _files( name, files, threads=0 )" },
+    { "_capsule",    (PyCFunction)_canx_capsule, METH_VARARGS, "The kernel of a preset for _multi : _capsule( name )" },
+    { "_multi",      (PyCFunction)hexin_multi_compute, METH_VARARGS, "Many CRCs of data in one pass : _multi( data, capsules )" },
     { NULL, NULL, 0, NULL }        /* Sentinel */
 };
 
@@ -184,9 +523,28 @@ PyInit__canx( void )
         return NULL;
     }
 
+    if ( hexin_hasher_ready( m ) < 0 ) {
+        Py_DECREF( m );
+        return NULL;
+    }
+
     PyModule_AddStringConstant( m, "__version__", "1.7"   );
     PyModule_AddStringConstant( m, "__author__",  "Heyn"  );
 
+    /* Probe the CPU once and pick the kernel tier ( AVX-512 / PCLMULQDQ / tables ), LIBSCRC_KERNEL may lower it. */
+    hexin_clmul_level();
+    hexin_gil_threshold();
+
+    if ( !hexin_kernel_is_known() && ( PyErr_WarnEx( PyExc_RuntimeWarning, HEXIN_KERNEL_UNKNOWN, 1 ) < 0 ) ) {
+        Py_DECREF( m );
+        return NULL;
+    }
+
+#ifdef Py_GIL_DISABLED
+    /* The presets are read-only and every call keeps its state on the stack. */
+    PyUnstable_Module_SetGIL( m, Py_MOD_GIL_NOT_USED );
+#endif
+
     return m;
 }
 
@@ -196,7 +554,11 @@ PyInit__canx( void )
 PyMODINIT_FUNC
 init_canx( void )
 {
-    (void) Py_InitModule3( "_canx", _canxMethods, _canx_doc );
+    PyObject *m = Py_InitModule3( "_canx", _canxMethods, _canx_doc );
+
+    if ( m != NULL ) {
+        hexin_hasher_ready( m );
+    }
 }
 
 #endif /* PY_MAJOR_VERSION */
@@ -27,68 +27,246 @@ static unsigned int hexin_canx_reverse32( unsigned int data )
     return t;
 }
 
-static unsigned int hexin_canx_compute_init_table( struct _hexin_canx *param )
+unsigned int hexin_canx_compute_init_table( struct _hexin_canx *param, unsigned int (*table)[MAX_TABLE_ARRAY], struct _hexin_clmul *clmul )
 {
     unsigned int i = 0, j = 0;
     unsigned int crc = 0x00000000L;
     unsigned int c   = 0x00000000L;
+    unsigned int poly = ( param->poly << ( HEXIN_CANX_WIDTH - param->width ) );
+    unsigned int rpoly = ( hexin_canx_reverse32( param->poly ) >> ( HEXIN_CANX_WIDTH - param->width ) );
+
+    param->table = ( const unsigned int (*)[MAX_TABLE_ARRAY] )table;
+    param->clmul = clmul;
 
     if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
         for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
             crc = i;
             for ( j=0; j<8; j++ ) {
-                if ( crc & 0x00000001L ) crc = ( crc >> 1 ) ^ param->poly;
+                if ( crc & 0x00000001L ) crc = ( crc >> 1 ) ^ rpoly;
                 else                     crc = ( crc >> 1 );
             }
-            param->table[i] = crc;
+            table[0][i] = crc;
+        }
+        /* Slicing tables : table[k][i] is the CRC of byte i followed by k zero bytes. */
+        for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
+            crc = table[0][i];
+            for ( j=1; j<MAX_SLICING_ARRAY; j++ ) {
+                crc = ( crc >> 8 ) ^ table[0][ crc & 0xFF ];
+                table[j][i] = crc;
+            }
         }
     } else {
         for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
             crc = 0;
             c	= ( ( unsigned int )i ) << 24;
             for ( j=0; j<8; j++ ) {
-                if ( ( crc ^ c ) & 0x80000000L )  crc = ( crc << 1 ) ^ param->poly;
+                if ( ( crc ^ c ) & 0x80000000L )  crc = ( crc << 1 ) ^ poly;
                 else                              crc = ( crc << 1 );
                 c = c << 1;
             }
-            param->table[i] = crc;
+            table[0][i] = crc;
+        }
+        for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
+            crc = table[0][i];
+            for ( j=1; j<MAX_SLICING_ARRAY; j++ ) {
+                crc = ( crc << 8 ) ^ table[0][ crc >> 24 ];
+                table[j][i] = crc;
+            }
         }
     }
-    return TRUE;
+
+    /* The folding kernel takes the polynomial left-aligned, whatever the table orientation. */
+    hexin_clmul_init( clmul, ( unsigned long long )poly << 32 );
+
+    return HEXIN_REFIN_REFOUT_IS_TRUE( param ) ? HEXIN_TABLE_IS_REFLECTED : HEXIN_TABLE_IS_NORMAL;
 }
 
-static unsigned int hexin_canx_compute_char( unsigned int crcx, unsigned char c, struct _hexin_canx *param )
+static unsigned int hexin_canx_compute_char( unsigned int crcx, unsigned char c, const struct _hexin_canx *param )
 {
     unsigned int crc = crcx;
 
     if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
-        crc = (crc >> 8) ^ param->table[ ((crc >> 0 ) ^ (0x000000FFL & (unsigned int)c)) & 0xFF ];
+        crc = (crc >> 8) ^ param->table[0][ ((crc >> 0 ) ^ (0x000000FFL & (unsigned int)c)) & 0xFF ];
     } else {
-        crc = (crc << 8) ^ param->table[ ((crc >> 24) ^ (0x000000FFL & (unsigned int)c)) & 0xFF ];
+        crc = (crc << 8) ^ param->table[0][ ((crc >> 24) ^ (0x000000FFL & (unsigned int)c)) & 0xFF ];
     }
 
     return crc;
 }
 
-unsigned int hexin_canx_compute( const unsigned char *pSrc, unsigned int len, struct _hexin_canx *param, unsigned int init )
+static unsigned int hexin_canx_compute_slicing16( unsigned int crc, const unsigned char *p, const unsigned int (*table)[MAX_TABLE_ARRAY] )
+{
+    crc ^= ( ( unsigned int )p[0] << 24 ) | ( ( unsigned int )p[1] << 16 ) | ( ( unsigned int )p[2] << 8 ) | p[3];
+    return table[15][ crc >> 24 ] ^ table[14][ ( crc >> 16 ) & 0xFF ] ^ table[13][ ( crc >> 8 ) & 0xFF ] ^ table[12][ crc & 0xFF ]
+         ^ table[11][ p[4]  ] ^ table[10][ p[5]  ] ^ table[9][ p[6]  ] ^ table[8][ p[7]  ]
+         ^ table[7][  p[8]  ] ^ table[6][  p[9]  ] ^ table[5][ p[10] ] ^ table[4][ p[11] ]
+         ^ table[3][  p[12] ] ^ table[2][  p[13] ] ^ table[1][ p[14] ] ^ table[0][ p[15] ];
+}
+
+static unsigned int hexin_canx_compute_slicing16_reflected( unsigned int crc, const unsigned char *p, const unsigned int (*table)[MAX_TABLE_ARRAY] )
+{
+    crc ^= ( ( unsigned int )p[3] << 24 ) | ( ( unsigned int )p[2] << 16 ) | ( ( unsigned int )p[1] << 8 ) | p[0];
+    return table[15][ crc & 0xFF ] ^ table[14][ ( crc >> 8 ) & 0xFF ] ^ table[13][ ( crc >> 16 ) & 0xFF ] ^ table[12][ crc >> 24 ]
+         ^ table[11][ p[4]  ] ^ table[10][ p[5]  ] ^ table[9][ p[6]  ] ^ table[8][ p[7]  ]
+         ^ table[7][  p[8]  ] ^ table[6][  p[9]  ] ^ table[5][ p[10] ] ^ table[4][ p[11] ]
+         ^ table[3][  p[12] ] ^ table[2][  p[13] ] ^ table[1][ p[14] ] ^ table[0][ p[15] ];
+}
+
+/*
+ * Carry-less multiplication folding over the 16-byte aligned bulk, when the CPU supports PCLMULQDQ.
+ * The reflected register is already right-aligned.
+ */
+static unsigned int hexin_canx_compute_clmul( unsigned int crc, const unsigned char *pSrc, size_t len, const struct _hexin_canx *param )
+{
+    if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
+        return ( unsigned int )hexin_clmul_compute( param->clmul, crc, pSrc, len, TRUE );
+    }
+    return ( unsigned int )( hexin_clmul_compute( param->clmul, ( unsigned long long )crc << 32, pSrc, len, FALSE ) >> 32 );
+}
+
+/*
+ * The register of a new calculation, or of a gradual one ( is_gradual, init = crc ^ xorout ).
+ */
+unsigned int hexin_canx_compute_begin( const struct _hexin_canx *param, unsigned int init )
 {
-    unsigned int i = 0, result = 0;
-    unsigned int crc  = ( init << ( HEXIN_CANX_WIDTH - param->width ) );
+    return ( init << ( HEXIN_CANX_WIDTH - param->width ) );
+}
+
+/*
+ * Feed the register, no fix-up between two calls.
+ */
+unsigned int hexin_canx_compute_update( const struct _hexin_canx *param, unsigned int crc, const unsigned char *pSrc, size_t len )
+{
+    size_t i = 0;
+
+    if ( ( len >= HEXIN_CLMUL_MIN_LENGTH ) && hexin_clmul_is_supported() ) {
+        crc   = hexin_canx_compute_clmul( crc, pSrc, len & ~( size_t )15, param );
+        pSrc += len & ~( size_t )15;
+        len  &= 15U;
+    }
 
-    if ( param->is_initial == FALSE ) {
+    /* Slicing-by-16 over the bulk of the buffer, the byte loop for the tail. */
+    for ( ; len >= 16; len -= 16, pSrc += 16 ) {
         if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
-            param->poly = ( hexin_canx_reverse32( param->poly ) >> ( HEXIN_CANX_WIDTH - param->width ) );
+            crc = hexin_canx_compute_slicing16_reflected( crc, pSrc, param->table );
         } else {
-            param->poly = ( param->poly << ( HEXIN_CANX_WIDTH - param->width ) );
+            crc = hexin_canx_compute_slicing16( crc, pSrc, param->table );
         }
-        param->is_initial = hexin_canx_compute_init_table( param );
     }
 
 	for ( i=0; i<len; i++ ) {
 		crc = hexin_canx_compute_char( crc, pSrc[i], param );
 	}
+    return crc;
+}
+
+/*
+ * The CRC of the register : refout and xorout.
+ */
+unsigned int hexin_canx_compute_end( const struct _hexin_canx *param, unsigned int crc )
+{
+    return ( ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ? crc : ( crc >> ( HEXIN_CANX_WIDTH - param->width ) ) ) ^ param->xorout );
+}
+
+unsigned int hexin_canx_compute( const unsigned char *pSrc, size_t len, const struct _hexin_canx *param, unsigned int init )
+{
+    unsigned int crc = hexin_canx_compute_begin( param, init );
 
-    result = ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) ? crc : ( crc >> ( HEXIN_CANX_WIDTH - param->width ) );
-    
-	return ( result ^ param->xorout ); 
+    crc = hexin_canx_compute_update( param, crc, pSrc, len );
+    return hexin_canx_compute_end( param, crc );
+}
+
+static unsigned long long hexin_canx_compute_chunk( const void *param, const unsigned char *pSrc, size_t len, unsigned long long init )
+{
+    return hexin_canx_compute( pSrc, len, ( const struct _hexin_canx * )param, ( unsigned int )init );
+}
+
+/*
+ * Split the buffer over threads ( 0 : every CPU ), the result is the same as hexin_canx_compute().
+ */
+unsigned int hexin_canx_compute_parallel( const unsigned char *pSrc, size_t len, const struct _hexin_canx *param, unsigned int init, unsigned int threads )
+{
+    struct _hexin_canx rest = *param;
+    struct _hexin_parallel job = { .compute = hexin_canx_compute_chunk,
+                                   .first   = param,
+                                   .rest    = &rest,
+                                   .combine = param->combine,
+                                   .init    = init,
+                                   .reinit  = param->init,
+                                   .width   = param->width,
+                                   .poly    = param->poly,
+                                   .refout  = param->refout };
+
+    rest.is_gradual = FALSE;
+    return ( unsigned int )hexin_parallel_compute( &job, pSrc, len, threads );
+}
+
+/*
+ * CRC( A || B ) from CRC( A ), CRC( B ) and len( B ), O( log( len_b ) ).
+ */
+unsigned int hexin_canx_combine( const struct _hexin_canx *param, unsigned int crc_a, unsigned int crc_b, unsigned long long len_b )
+{
+    struct _hexin_canx local = *param;
+    struct _hexin_combine combine;
+    unsigned int empty = 0;
+
+    local.is_gradual = FALSE;
+    empty = hexin_canx_compute( ( const unsigned char * )"", 0, &local, local.init );
+
+    if ( param->combine == NULL ) {
+        hexin_combine_init( &combine, param->width, param->poly );
+    }
+    return ( unsigned int )hexin_combine( ( param->combine != NULL ) ? param->combine : &combine, param->refout, crc_a, crc_b, len_b, empty );
+}
+
+/*
+ * CRC( A || len zero bytes ) from CRC( A ), O( log( len ) ).
+ */
+unsigned int hexin_canx_extend_zeros( const struct _hexin_canx *param, unsigned int crc, unsigned long long len )
+{
+    struct _hexin_combine combine;
+
+    if ( param->combine == NULL ) {
+        hexin_combine_init( &combine, param->width, param->poly );
+    }
+    return ( unsigned int )hexin_combine_zeros( ( param->combine != NULL ) ? param->combine : &combine, param->refout, crc, len, param->xorout );
+}
+
+/*
+ * CRC( A || count copies of block ) from CRC( A ), one pass over the block and O( log( count ) ).
+ */
+unsigned int hexin_canx_extend_repeat( const struct _hexin_canx *param, unsigned int crc, const unsigned char *pBlock, size_t len, unsigned long long count )
+{
+    struct _hexin_canx local = *param;
+    struct _hexin_combine combine;
+    unsigned int empty = 0, block = 0;
+
+    local.is_gradual = FALSE;
+    empty = hexin_canx_compute( ( const unsigned char * )"", 0, &local, local.init );
+    block = hexin_canx_compute( pBlock, len, &local, local.init );
+
+    if ( param->combine == NULL ) {
+        hexin_combine_init( &combine, param->width, param->poly );
+    }
+    return ( unsigned int )hexin_combine_repeat( ( param->combine != NULL ) ? param->combine : &combine, param->refout, crc, block, len, count, empty );
+}
+
+/*
+ * CRC( A ) after len bytes of A, followed by len_after bytes, were rewritten from pOld to pNew, O( len + log( len_after ) ).
+ */
+unsigned int hexin_canx_update_range( const struct _hexin_canx *param, unsigned int crc, const unsigned char *pOld, const unsigned char *pNew,
+                                      size_t len, unsigned long long len_after )
+{
+    struct _hexin_canx local = *param;
+    struct _hexin_combine combine;
+    unsigned int crc_old = 0, crc_new = 0;
+
+    local.is_gradual = FALSE;
+    crc_old = hexin_canx_compute( pOld, len, &local, local.init );
+    crc_new = hexin_canx_compute( pNew, len, &local, local.init );
+
+    if ( param->combine == NULL ) {
+        hexin_combine_init( &combine, param->width, param->poly );
+    }
+    return ( unsigned int )hexin_combine_patch( ( param->combine != NULL ) ? param->combine : &combine, param->refout, crc, crc_old, crc_new, len_after );
 }
@@ -18,6 +18,9 @@
 #ifndef __CANX_TABLES_H__
 #define __CANX_TABLES_H__
 
+#include "_clmulfold.h"
+#include "_parallel.h"
+
 #ifndef TRUE
 #define                 TRUE                                    1
 #endif
@@ -30,9 +33,15 @@
 #define                 MAX_TABLE_ARRAY                         256
 #endif
 
+#ifndef MAX_SLICING_ARRAY
+#define                 MAX_SLICING_ARRAY                       16      /* Slicing-by-16 (table[0] is the classic table) */
+#endif
+
 #define                 HEXIN_CANX_WIDTH                        32
 #define                 HEXIN_REFIN_REFOUT_IS_TRUE(x)           ( ( x->refin == TRUE ) && ( x->refout == TRUE ) )
 #define                 HEXIN_GRADUAL_CALCULATE_IS_TRUE(x)      ( x->is_gradual == 2 )
+#define                 HEXIN_TABLE_IS_NORMAL                   1       /* is_initial : MSB-first table */
+#define                 HEXIN_TABLE_IS_REFLECTED                2       /* is_initial : LSB-first table ( refin == refout == TRUE ) */
 
 #define                 CAN15_POLYNOMIAL_00004599               0x00004599L
 #define                 CAN17_POLYNOMIAL_0001685B               0x0001685BL
@@ -47,10 +56,20 @@ struct _hexin_canx {
     unsigned int  refin;
     unsigned int  refout;
     unsigned int  xorout;
-    unsigned int  result;
-    unsigned int  table[MAX_TABLE_ARRAY];
+    const unsigned int (*table)[MAX_TABLE_ARRAY];        /* static const presets, see _canxpresets.h */
+    const struct _hexin_clmul *clmul;
+    const struct _hexin_combine *combine;                /* x^( 8 * 2^k ) mod P(x), see _combine.h */
 };
 
-unsigned int hexin_canx_compute( const unsigned char *pSrc, unsigned int len, struct _hexin_canx *param, unsigned int init );
+unsigned int hexin_canx_compute_init_table( struct _hexin_canx *param, unsigned int (*table)[MAX_TABLE_ARRAY], struct _hexin_clmul *clmul );
+unsigned int hexin_canx_compute_begin(  const struct _hexin_canx *param, unsigned int init );
+unsigned int hexin_canx_compute_update( const struct _hexin_canx *param, unsigned int crc, const unsigned char *pSrc, size_t len );
+unsigned int hexin_canx_compute_end(    const struct _hexin_canx *param, unsigned int crc );
+unsigned int hexin_canx_compute( const unsigned char *pSrc, size_t len, const struct _hexin_canx *param, unsigned int init );
+unsigned int hexin_canx_compute_parallel( const unsigned char *pSrc, size_t len, const struct _hexin_canx *param, unsigned int init, unsigned int threads );
+unsigned int hexin_canx_combine( const struct _hexin_canx *param, unsigned int crc_a, unsigned int crc_b, unsigned long long len_b );
+unsigned int hexin_canx_extend_zeros(  const struct _hexin_canx *param, unsigned int crc, unsigned long long len );
+unsigned int hexin_canx_extend_repeat( const struct _hexin_canx *param, unsigned int crc, const unsigned char *pBlock, size_t len, unsigned long long count );
+unsigned int hexin_canx_update_range(  const struct _hexin_canx *param, unsigned int crc, const unsigned char *pOld, const unsigned char *pNew, size_t len, unsigned long long len_after );
 
 #endif //__CANX_TABLES_H__
@@ -0,0 +1,338 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2017-2022, Hexin
+*                                           All Rights Reserved
+* File    : _batch.c
+* Version : V1.7
+*
+*********************************************************************************************************
+*/
+
+#define PY_SSIZE_T_CLEAN
+#include "_batch.h"
+#include "_dispatch.h"
+
+struct _hexin_batch_item {
+    const unsigned char *pSrc;
+    size_t               len;
+};
+
+/* Integer arrays : array.array, numpy, memoryview ... of any signed / unsigned integer format. */
+static int hexin_batch_get_integers( PyObject *object, Py_buffer *view, int flags, const char *what )
+{
+    const char *format = NULL;
+
+    if ( PyObject_GetBuffer( object, view, flags | PyBUF_FORMAT | PyBUF_C_CONTIGUOUS ) < 0 ) {
+        return -1;
+    }
+
+    format = ( view->format != NULL ) ? view->format : "B";
+    if ( ( *format == '@' ) || ( *format == '=' ) || ( *format == '<' ) || ( *format == '>' ) || ( *format == '!' ) ) {
+        format++;
+    }
+    if ( ( format[0] == '\0' ) || ( format[1] != '\0' ) || ( strchr( "bBhHiIlLqQnN", format[0] ) == NULL )
+      || ( ( view->itemsize != 1 ) && ( view->itemsize != 2 ) && ( view->itemsize != 4 ) && ( view->itemsize != 8 ) ) ) {
+        PyErr_Format( PyExc_TypeError, "%s must be an array of integers", what );
+        PyBuffer_Release( view );
+        return -1;
+    }
+    return 0;
+}
+
+static int hexin_batch_is_signed( const Py_buffer *view )
+{
+    const char *format = ( view->format != NULL ) ? view->format : "B";
+
+    return ( strpbrk( format, "bhilqn" ) != NULL );
+}
+
+/* FALSE when the value is negative. */
+static int hexin_batch_read( const Py_buffer *view, int is_signed, Py_ssize_t i, unsigned long long *value )
+{
+    const unsigned char *p = ( const unsigned char * )view->buf + i * view->itemsize;
+    long long s = 0;
+
+    switch ( view->itemsize ) {
+        case 1 : s = is_signed ? ( long long )*( const signed char * )p : ( long long )*p; break;
+        case 2 : s = is_signed ? ( long long )*( const short * )p : ( long long )*( const unsigned short * )p; break;
+        case 4 : s = is_signed ? ( long long )*( const int * )p : ( long long )*( const unsigned int * )p; break;
+        default:
+            *value = *( const unsigned long long * )p;
+            return !( is_signed && ( ( long long )*value < 0 ) );
+    }
+    *value = ( unsigned long long )s;
+    return ( s >= 0 );
+}
+
+static void hexin_batch_write( Py_buffer *view, Py_ssize_t i, unsigned long long value )
+{
+    unsigned char *p = ( unsigned char * )view->buf + i * view->itemsize;
+
+    switch ( view->itemsize ) {
+        case 1 : *p = ( unsigned char )value;                          break;
+        case 2 : *( unsigned short * )p = ( unsigned short )value;     break;
+        case 4 : *( unsigned int * )p = ( unsigned int )value;         break;
+        default: *( unsigned long long * )p = value;                   break;
+    }
+}
+
+/* Fill items[] from the sequence of buffers, views[] keeps them pinned. */
+static Py_ssize_t hexin_batch_sequence( PyObject *data, struct _hexin_batch_item **items, Py_buffer **views, size_t *total )
+{
+    Py_ssize_t i = 0, count = 0;
+    PyObject *sequence = PySequence_Fast( data, "data must be a sequence of bytes-like objects" );
+
+    if ( sequence == NULL ) {
+        return -1;
+    }
+
+    count  = PySequence_Fast_GET_SIZE( sequence );
+    *items = ( struct _hexin_batch_item * )PyMem_Malloc( ( count + 1 ) * sizeof( struct _hexin_batch_item ) );
+    *views = ( Py_buffer * )PyMem_Malloc( ( count + 1 ) * sizeof( Py_buffer ) );
+    if ( ( *items == NULL ) || ( *views == NULL ) ) {
+        Py_DECREF( sequence );
+        PyErr_NoMemory();
+        return -1;
+    }
+
+    for ( i=0; i<count; i++ ) {
+        if ( PyObject_GetBuffer( PySequence_Fast_GET_ITEM( sequence, i ), &( *views )[i], PyBUF_SIMPLE ) < 0 ) {
+            while ( i-- > 0 ) {
+                PyBuffer_Release( &( *views )[i] );
+            }
+            Py_DECREF( sequence );
+            return -1;
+        }
+        ( *items )[i].pSrc = ( const unsigned char * )( *views )[i].buf;
+        ( *items )[i].len  = ( size_t )( *views )[i].len;
+        *total += ( *items )[i].len;
+    }
+
+    Py_DECREF( sequence );
+    return count;
+}
+
+/* Cut one buffer by offsets[] and lengths[], or by n + 1 boundaries in offsets[] alone. */
+static Py_ssize_t hexin_batch_slices( const Py_buffer *buffer, PyObject *offsets, PyObject *lengths, struct _hexin_batch_item **items )
+{
+    Py_buffer starts = { NULL, NULL }, sizes = { NULL, NULL };
+    Py_ssize_t i = 0, count = 0;
+    unsigned long long start = 0, size = 0;
+    int signed_starts = 0, signed_sizes = 0;
+
+    if ( hexin_batch_get_integers( offsets, &starts, PyBUF_SIMPLE, "offsets" ) < 0 ) {
+        return -1;
+    }
+    if ( ( lengths != NULL ) && ( hexin_batch_get_integers( lengths, &sizes, PyBUF_SIMPLE, "lengths" ) < 0 ) ) {
+        PyBuffer_Release( &starts );
+        return -1;
+    }
+
+    count = starts.len / starts.itemsize;
+    if ( lengths == NULL ) {
+        count = ( count > 0 ) ? ( count - 1 ) : 0;
+    } else if ( sizes.len / sizes.itemsize != count ) {
+        PyErr_SetString( PyExc_ValueError, "offsets and lengths differ in size" );
+        count = -1;
+    }
+
+    signed_starts = hexin_batch_is_signed( &starts );
+    signed_sizes  = ( lengths != NULL ) ? hexin_batch_is_signed( &sizes ) : 0;
+
+    *items = ( count >= 0 ) ? ( struct _hexin_batch_item * )PyMem_Malloc( ( count + 1 ) * sizeof( struct _hexin_batch_item ) ) : NULL;
+    if ( ( count >= 0 ) && ( *items == NULL ) ) {
+        PyErr_NoMemory();
+        count = -1;
+    }
+
+    for ( i=0; i<count; i++ ) {
+        if ( !hexin_batch_read( &starts, signed_starts, i, &start )
+          || !( ( lengths != NULL ) ? hexin_batch_read( &sizes, signed_sizes, i, &size )
+                                    : hexin_batch_read( &starts, signed_starts, i + 1, &size ) ) ) {
+            PyErr_Format( PyExc_ValueError, "negative offset or length at %zd", i );
+            count = -1;
+            break;
+        }
+        if ( lengths == NULL ) {
+            size = ( size >= start ) ? ( size - start ) : ( unsigned long long )-1;
+        }
+        if ( ( start > ( unsigned long long )buffer->len ) || ( size > ( unsigned long long )buffer->len - start ) ) {
+            PyErr_Format( PyExc_ValueError, "slice %zd is out of the buffer", i );
+            count = -1;
+            break;
+        }
+        ( *items )[i].pSrc = ( const unsigned char * )buffer->buf + start;
+        ( *items )[i].len  = ( size_t )size;
+    }
+
+    PyBuffer_Release( &starts );
+    if ( lengths != NULL ) {
+        PyBuffer_Release( &sizes );
+    }
+    return count;
+}
+
+/*
+ * One item per row of a 2-D buffer ( PEP 3118, any strides ). A row whose items are not next to
+ * each other is gathered into a scratch buffer by the batch loop, *gather holds its column stride.
+ */
+static Py_ssize_t hexin_batch_rows( const Py_buffer *matrix, struct _hexin_batch_item **items, Py_ssize_t *gather )
+{
+    Py_ssize_t i = 0;
+
+    if ( ( matrix->ndim != 2 ) || ( matrix->shape == NULL ) || ( matrix->strides == NULL ) ) {
+        PyErr_SetString( PyExc_ValueError, "rows needs a 2-D buffer" );
+        return -1;
+    }
+
+    *gather = ( matrix->strides[1] == matrix->itemsize ) ? 0 : matrix->strides[1];
+    *items  = ( struct _hexin_batch_item * )PyMem_Malloc( ( matrix->shape[0] + 1 ) * sizeof( struct _hexin_batch_item ) );
+    if ( *items == NULL ) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    for ( i=0; i<matrix->shape[0]; i++ ) {
+        ( *items )[i].pSrc = ( const unsigned char * )matrix->buf + i * matrix->strides[0];
+        ( *items )[i].len  = ( size_t )( matrix->shape[1] * matrix->itemsize );
+    }
+    return matrix->shape[0];
+}
+
+/* A strided row, item by item, into scratch. */
+static const unsigned char *hexin_batch_gather( const struct _hexin_batch_item *item, Py_ssize_t stride,
+                                                Py_ssize_t itemsize, unsigned char *scratch )
+{
+    size_t i = 0;
+
+    for ( i=0; i<item->len; i+=( size_t )itemsize ) {
+        memcpy( scratch + i, item->pSrc + ( Py_ssize_t )( i / ( size_t )itemsize ) * stride, ( size_t )itemsize );
+    }
+    return scratch;
+}
+
+/* The batch loop, run without the GIL : no Python object is touched. */
+static void hexin_batch_run( const struct _hexin_hasher_ops *ops, const void *param, unsigned long long begin,
+                             const struct _hexin_batch_item *items, Py_ssize_t count,
+                             Py_ssize_t gather, Py_ssize_t itemsize, unsigned char *scratch,
+                             Py_buffer *results, const Py_buffer *checks, unsigned char *bits )
+{
+    const unsigned char *pSrc = NULL;
+    unsigned long long crc = 0, value = 0;
+    Py_ssize_t i = 0;
+    int is_signed = ( bits != NULL ) ? hexin_batch_is_signed( checks ) : 0;
+
+    for ( i=0; i<count; i++ ) {
+        pSrc = ( gather != 0 ) ? hexin_batch_gather( &items[i], gather, itemsize, scratch ) : items[i].pSrc;
+        crc  = ops->end( param, ops->update( param, begin, pSrc, items[i].len ) );
+        hexin_batch_write( results, i, crc );
+        if ( ( bits != NULL ) && hexin_batch_read( checks, is_signed, i, &value ) && ( value == crc ) ) {
+            bits[i >> 3] |= ( unsigned char )( 1U << ( i & 7 ) );
+        }
+    }
+}
+
+PyObject *hexin_batch_compute( const struct _hexin_hasher_ops *ops, const void *param, unsigned int width,
+                               PyObject *data, PyObject *out, PyObject *offsets, PyObject *lengths, PyObject *expected, int rows )
+{
+    struct _hexin_batch_item *items = NULL;
+    Py_buffer *views = NULL;
+    Py_buffer buffer = { NULL, NULL }, results = { NULL, NULL }, checks = { NULL, NULL };
+    PyObject *bitmap = NULL, *result = NULL;
+    unsigned char *bits = NULL, *scratch = NULL;
+    unsigned long long begin = 0;
+    Py_ssize_t i = 0, count = -1, gather = 0;
+    size_t total = 0;
+
+    if ( rows ) {
+        if ( ( offsets != NULL ) || ( lengths != NULL ) ) {
+            PyErr_SetString( PyExc_TypeError, "rows takes no offsets or lengths" );
+            return NULL;
+        }
+        if ( PyObject_GetBuffer( data, &buffer, PyBUF_STRIDES ) < 0 ) {
+            return NULL;
+        }
+        count = hexin_batch_rows( &buffer, &items, &gather );
+        total = ( count > 0 ) ? ( size_t )count * items[0].len : 0;
+        if ( ( gather != 0 ) && ( count > 0 ) ) {
+            scratch = ( unsigned char * )PyMem_Malloc( items[0].len + 1 );
+            if ( scratch == NULL ) {
+                PyErr_NoMemory();
+                count = -1;
+            }
+        }
+    } else if ( offsets != NULL ) {
+        if ( PyObject_GetBuffer( data, &buffer, PyBUF_SIMPLE ) < 0 ) {
+            return NULL;
+        }
+        count = hexin_batch_slices( &buffer, offsets, lengths, &items );
+        total = ( size_t )buffer.len;
+    } else if ( lengths != NULL ) {
+        PyErr_SetString( PyExc_TypeError, "lengths needs offsets" );
+    } else {
+        count = hexin_batch_sequence( data, &items, &views, &total );
+    }
+    if ( count < 0 ) {
+        goto done;
+    }
+
+    if ( hexin_batch_get_integers( out, &results, PyBUF_WRITABLE, "out" ) < 0 ) {
+        goto release;
+    }
+    if ( ( results.itemsize * 8 < ( Py_ssize_t )width ) || ( results.len / results.itemsize < count ) ) {
+        PyErr_Format( PyExc_ValueError, "out must hold %zd integers of %u bits", count, width );
+        goto release;
+    }
+
+    if ( expected != NULL ) {
+        if ( hexin_batch_get_integers( expected, &checks, PyBUF_SIMPLE, "expected" ) < 0 ) {
+            goto release;
+        }
+        if ( checks.len / checks.itemsize < count ) {
+            PyErr_Format( PyExc_ValueError, "expected must hold %zd integers", count );
+            goto release;
+        }
+        bitmap = PyByteArray_FromStringAndSize( NULL, ( count + 7 ) / 8 );
+        if ( bitmap == NULL ) {
+            goto release;
+        }
+        bits = ( unsigned char * )PyByteArray_AS_STRING( bitmap );
+        memset( bits, 0, ( size_t )( count + 7 ) / 8 );
+    }
+
+    begin = ops->begin( param );
+    if ( total >= hexin_gil_threshold() ) {
+        Py_BEGIN_ALLOW_THREADS
+        hexin_batch_run( ops, param, begin, items, count, gather, buffer.itemsize, scratch, &results, &checks, bits );
+        Py_END_ALLOW_THREADS
+    } else {
+        hexin_batch_run( ops, param, begin, items, count, gather, buffer.itemsize, scratch, &results, &checks, bits );
+    }
+
+    if ( bitmap != NULL ) {
+        result = bitmap;
+        bitmap = NULL;
+    } else {
+        result = out;
+        Py_INCREF( out );
+    }
+
+release:
+    Py_XDECREF( bitmap );
+    if ( results.obj != NULL ) {
+        PyBuffer_Release( &results );
+    }
+    if ( checks.obj != NULL ) {
+        PyBuffer_Release( &checks );
+    }
+    for ( i=0; ( views != NULL ) && ( i < count ); i++ ) {
+        PyBuffer_Release( &views[i] );
+    }
+done:
+    PyMem_Free( scratch );
+    PyMem_Free( items );
+    PyMem_Free( views );
+    if ( buffer.obj != NULL ) {
+        PyBuffer_Release( &buffer );
+    }
+    return result;
+}
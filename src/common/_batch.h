@@ -0,0 +1,24 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2017-2022, Hexin
+*                                           All Rights Reserved
+* File    : _batch.h
+* Version : V1.7
+*
+*   The CRC of many buffers in one call : a sequence of bytes-like objects, or one buffer cut by
+*   offsets / lengths. The results go to the caller's integer array in one loop without the GIL,
+*   the expected CRCs, when given, turn into a pass / fail bitmap ( bit i of byte i / 8 ).
+*   With rows, data is one 2-D buffer ( PEP 3118, C-contiguous or strided ) and every row is an item.
+*
+*********************************************************************************************************
+*/
+
+#ifndef __HEXIN_BATCH_H__
+#define __HEXIN_BATCH_H__
+
+#include "_hasher.h"
+
+PyObject *hexin_batch_compute( const struct _hexin_hasher_ops *ops, const void *param, unsigned int width,
+                               PyObject *data, PyObject *out, PyObject *offsets, PyObject *lengths, PyObject *expected, int rows );
+
+#endif //__HEXIN_BATCH_H__
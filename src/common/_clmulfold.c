@@ -0,0 +1,362 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2017-2022, Hexin
+*                                           All Rights Reserved
+* File    : _clmulfold.c
+* Version : V1.7
+*
+*   Folding by 4x128 bits, then 128 bits, then Barrett reduction from 128 to 64 bits.
+*   See "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction" (Intel, 2009).
+*   With AVX-512 VPCLMULQDQ the bulk is folded by 4x512 bits first.
+*
+*********************************************************************************************************
+*/
+
+#include "_clmulfold.h"
+
+#if defined( HEXIN_CLMUL_X86_64 )
+#if defined( _MSC_VER )
+#include <intrin.h>
+#define HEXIN_CLMUL_TARGET
+#define HEXIN_VPCLMUL_TARGET
+#else
+#define HEXIN_CLMUL_TARGET      __attribute__( ( target( "pclmul,ssse3,sse4.1" ) ) )
+#define HEXIN_VPCLMUL_TARGET    __attribute__( ( target( "pclmul,ssse3,sse4.1,avx512f,avx512bw,vpclmulqdq" ) ) )
+#endif
+#include <immintrin.h>
+
+#if ( defined( __GNUC__ ) && ( __GNUC__ >= 8 ) ) || ( defined( __clang_major__ ) && ( __clang_major__ >= 6 ) ) || ( defined( _MSC_VER ) && ( _MSC_VER >= 1920 ) )
+#define HEXIN_CLMUL_AVX512      1
+#endif
+#endif
+
+static unsigned long long hexin_clmul_reverse64( unsigned long long data )
+{
+    unsigned int i = 0;
+    unsigned long long t = 0;
+    for ( i=0; i<64; i++ ) {
+        t |= ( ( data >> i ) & 0x01 ) << ( 63-i );
+    }
+    return t;
+}
+
+/* x^n mod P(x), P(x) = x^64 + poly */
+static unsigned long long hexin_clmul_xpow( unsigned int n, unsigned long long poly )
+{
+    unsigned long long r = 0;
+
+    if ( n < 64 ) {
+        return 1ULL << n;
+    }
+
+    for ( r = 1ULL << 63, n -= 63; n > 0; n-- ) {
+        r = ( r & 0x8000000000000000ULL ) ? ( ( r << 1 ) ^ poly ) : ( r << 1 );
+    }
+    return r;
+}
+
+/* floor( x^128 / P(x) ), the implicit x^64 term is dropped */
+static unsigned long long hexin_clmul_mu( unsigned long long poly )
+{
+    unsigned int i = 0;
+    unsigned long long q = 0, hi = poly;            /* x^128 - x^64 * P(x), only the upper half matters */
+
+    for ( i=64; i>0; i-- ) {
+        if ( ( hi >> ( i-1 ) ) & 0x01 ) {
+            q  |= 1ULL << ( i-1 );
+            hi ^= 1ULL << ( i-1 );
+            hi ^= ( i-1 ) ? ( poly >> ( 65-i ) ) : 0;
+        }
+    }
+    return q;
+}
+
+/*
+ * Constants to fold a 128-bit block forward by n bits : x^n for the low qword, x^(n+64) for the high one.
+ * A reflected product carries one extra x, hence x^(n-1), and the low qword holds the higher degree.
+ */
+static void hexin_clmul_init_keys( unsigned long long *keys, unsigned int n, unsigned long long poly )
+{
+    keys[0] = hexin_clmul_xpow( n,      poly );
+    keys[1] = hexin_clmul_xpow( n + 64, poly );
+}
+
+static void hexin_clmul_init_keys_reflect( unsigned long long *keys, unsigned int n, unsigned long long poly )
+{
+    keys[0] = hexin_clmul_reverse64( hexin_clmul_xpow( n + 63, poly ) );
+    keys[1] = hexin_clmul_reverse64( hexin_clmul_xpow( n - 1,  poly ) );
+}
+
+unsigned int hexin_clmul_init( struct _hexin_clmul *clmul, unsigned long long polynomial )
+{
+    hexin_clmul_init_keys( clmul->normal.fold16, 2048, polynomial );
+    hexin_clmul_init_keys( clmul->normal.fold4,  512,  polynomial );
+    hexin_clmul_init_keys( clmul->normal.fold3,  384,  polynomial );
+    hexin_clmul_init_keys( clmul->normal.fold2,  256,  polynomial );
+    hexin_clmul_init_keys( clmul->normal.fold1,  128,  polynomial );
+    clmul->normal.mu   = hexin_clmul_mu( polynomial );
+    clmul->normal.poly = polynomial;
+
+    hexin_clmul_init_keys_reflect( clmul->reflect.fold16, 2048, polynomial );
+    hexin_clmul_init_keys_reflect( clmul->reflect.fold4,  512,  polynomial );
+    hexin_clmul_init_keys_reflect( clmul->reflect.fold3,  384,  polynomial );
+    hexin_clmul_init_keys_reflect( clmul->reflect.fold2,  256,  polynomial );
+    hexin_clmul_init_keys_reflect( clmul->reflect.fold1,  128,  polynomial );
+    clmul->reflect.mu   = hexin_clmul_reverse64( clmul->normal.mu );
+    clmul->reflect.poly = hexin_clmul_reverse64( polynomial );
+
+    return TRUE;
+}
+
+#if defined( HEXIN_CLMUL_X86_64 )
+
+static int __hexin_clmul_level = -1;
+
+/*
+ * Bind the folding kernel to the tier picked by the dispatch layer, once.
+ */
+unsigned int hexin_clmul_level( void )
+{
+    unsigned int tier  = 0;
+    int          level = HEXIN_CLMUL_LEVEL_TABLE;
+
+    if ( __hexin_clmul_level >= 0 ) {
+        return ( unsigned int )__hexin_clmul_level;
+    }
+
+    tier = hexin_kernel_tier();
+    if ( tier >= HEXIN_KERNEL_PCLMUL ) {
+        level = HEXIN_CLMUL_LEVEL_PCLMUL;
+    }
+#if defined( HEXIN_CLMUL_AVX512 )
+    if ( tier >= HEXIN_KERNEL_VPCLMUL ) {
+        level = HEXIN_CLMUL_LEVEL_VPCLMUL;
+    }
+#endif
+
+    __hexin_clmul_level = level;
+    return ( unsigned int )level;
+}
+
+HEXIN_CLMUL_TARGET
+static __m128i hexin_clmul_load( const unsigned char *p, unsigned int reflect )
+{
+    __m128i x = _mm_loadu_si128( ( const __m128i * )p );
+    if ( reflect ) {
+        return x;
+    }
+    return _mm_shuffle_epi8( x, _mm_set_epi8( 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 ) );
+}
+
+HEXIN_CLMUL_TARGET
+static __m128i hexin_clmul_fold( __m128i x, __m128i k )
+{
+    return _mm_xor_si128( _mm_clmulepi64_si128( x, k, 0x00 ), _mm_clmulepi64_si128( x, k, 0x11 ) );
+}
+
+HEXIN_CLMUL_TARGET
+static __m128i hexin_clmul_keys( const unsigned long long *keys )
+{
+    return _mm_set_epi64x( ( long long )keys[1], ( long long )keys[0] );
+}
+
+/*
+ * Fold the remaining 16-byte blocks into x0, then reduce it to the 64-bit register.
+ */
+HEXIN_CLMUL_TARGET
+static unsigned long long hexin_clmul_finish( const struct _hexin_clmul_keys *keys, __m128i x0,
+                                              const unsigned char *pSrc, size_t len, unsigned int reflect )
+{
+    __m128i k1 = hexin_clmul_keys( keys->fold1 );
+    __m128i t;
+    unsigned long long hi = 0, lo = 0, q = 0;
+
+    while ( len >= 16 ) {
+        x0 = _mm_xor_si128( hexin_clmul_fold( x0, k1 ), hexin_clmul_load( pSrc, reflect ) );
+        pSrc += 16;
+        len  -= 16;
+    }
+
+    if ( reflect ) {
+        /* 128 -> 128 bits : lo * x^128 + hi * x^64 */
+        t  = _mm_xor_si128( _mm_clmulepi64_si128( x0, k1, 0x10 ), _mm_srli_si128( x0, 8 ) );
+        lo = ( unsigned long long )_mm_cvtsi128_si64( t );
+        hi = ( unsigned long long )_mm_extract_epi64( t, 1 );
+
+        /* Barrett reduction in the bit-reflected domain */
+        t  = _mm_clmulepi64_si128( _mm_cvtsi64_si128( ( long long )lo ), _mm_cvtsi64_si128( ( long long )keys->mu ), 0x00 );
+        q  = lo ^ ( ( unsigned long long )_mm_cvtsi128_si64( t ) << 1 );
+        t  = _mm_clmulepi64_si128( _mm_cvtsi64_si128( ( long long )q ), _mm_cvtsi64_si128( ( long long )keys->poly ), 0x00 );
+        return hi ^ ( ( ( unsigned long long )_mm_extract_epi64( t, 1 ) << 1 ) | ( ( unsigned long long )_mm_cvtsi128_si64( t ) >> 63 ) );
+    }
+
+    /* 128 -> 128 bits : hi * x^128 + lo * x^64 */
+    t  = _mm_xor_si128( _mm_clmulepi64_si128( x0, k1, 0x01 ), _mm_slli_si128( x0, 8 ) );
+    lo = ( unsigned long long )_mm_cvtsi128_si64( t );
+    hi = ( unsigned long long )_mm_extract_epi64( t, 1 );
+
+    /* Barrett reduction : q = floor( T / P ), R = T - q * P */
+    t  = _mm_clmulepi64_si128( _mm_cvtsi64_si128( ( long long )hi ), _mm_cvtsi64_si128( ( long long )keys->mu ), 0x00 );
+    q  = hi ^ ( unsigned long long )_mm_extract_epi64( t, 1 );
+    t  = _mm_clmulepi64_si128( _mm_cvtsi64_si128( ( long long )q ), _mm_cvtsi64_si128( ( long long )keys->poly ), 0x00 );
+    return lo ^ ( unsigned long long )_mm_cvtsi128_si64( t );
+}
+
+HEXIN_CLMUL_TARGET
+static unsigned long long hexin_clmul_compute_pclmul( const struct _hexin_clmul_keys *keys, unsigned long long crc,
+                                                      const unsigned char *pSrc, size_t len, unsigned int reflect )
+{
+    __m128i k4 = hexin_clmul_keys( keys->fold4 );
+    __m128i k1 = hexin_clmul_keys( keys->fold1 );
+    __m128i x0, x1, x2, x3, t;
+
+    /* The register is the leading 64 bits of the message. */
+    t  = reflect ? _mm_set_epi64x( 0, ( long long )crc ) : _mm_set_epi64x( ( long long )crc, 0 );
+    x0 = _mm_xor_si128( hexin_clmul_load( pSrc, reflect ), t );
+
+    if ( len < 64 ) {
+        return hexin_clmul_finish( keys, x0, pSrc + 16, len - 16, reflect );
+    }
+
+    x1 = hexin_clmul_load( pSrc + 16, reflect );
+    x2 = hexin_clmul_load( pSrc + 32, reflect );
+    x3 = hexin_clmul_load( pSrc + 48, reflect );
+    pSrc += 64;
+    len  -= 64;
+
+    while ( len >= 64 ) {
+        x0 = _mm_xor_si128( hexin_clmul_fold( x0, k4 ), hexin_clmul_load( pSrc,      reflect ) );
+        x1 = _mm_xor_si128( hexin_clmul_fold( x1, k4 ), hexin_clmul_load( pSrc + 16, reflect ) );
+        x2 = _mm_xor_si128( hexin_clmul_fold( x2, k4 ), hexin_clmul_load( pSrc + 32, reflect ) );
+        x3 = _mm_xor_si128( hexin_clmul_fold( x3, k4 ), hexin_clmul_load( pSrc + 48, reflect ) );
+        pSrc += 64;
+        len  -= 64;
+    }
+
+    x1 = _mm_xor_si128( hexin_clmul_fold( x0, k1 ), x1 );
+    x2 = _mm_xor_si128( hexin_clmul_fold( x1, k1 ), x2 );
+    x0 = _mm_xor_si128( hexin_clmul_fold( x2, k1 ), x3 );
+
+    return hexin_clmul_finish( keys, x0, pSrc, len, reflect );
+}
+
+#if defined( HEXIN_CLMUL_AVX512 )
+
+HEXIN_VPCLMUL_TARGET
+static __m512i hexin_vpclmul_load( const unsigned char *p, unsigned int reflect )
+{
+    __m512i x = _mm512_loadu_si512( ( const void * )p );
+    if ( reflect ) {
+        return x;
+    }
+    return _mm512_shuffle_epi8( x, _mm512_broadcast_i32x4( _mm_set_epi8( 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 ) ) );
+}
+
+HEXIN_VPCLMUL_TARGET
+static __m512i hexin_vpclmul_fold( __m512i x, __m512i k )
+{
+    return _mm512_xor_si512( _mm512_clmulepi64_epi128( x, k, 0x00 ), _mm512_clmulepi64_epi128( x, k, 0x11 ) );
+}
+
+HEXIN_VPCLMUL_TARGET
+static unsigned long long hexin_clmul_compute_vpclmul( const struct _hexin_clmul_keys *keys, unsigned long long crc,
+                                                       const unsigned char *pSrc, size_t len, unsigned int reflect )
+{
+    __m512i k16 = _mm512_broadcast_i32x4( hexin_clmul_keys( keys->fold16 ) );
+    __m512i k4  = _mm512_broadcast_i32x4( hexin_clmul_keys( keys->fold4  ) );
+    __m512i z0, z1, z2, z3, k;
+    __m128i t;
+
+    /* The register is the leading 64 bits of the message. */
+    t  = reflect ? _mm_set_epi64x( 0, ( long long )crc ) : _mm_set_epi64x( ( long long )crc, 0 );
+    z0 = _mm512_xor_si512( hexin_vpclmul_load( pSrc, reflect ), _mm512_maskz_mov_epi64( 0x03, _mm512_castsi128_si512( t ) ) );
+    z1 = hexin_vpclmul_load( pSrc + 64,  reflect );
+    z2 = hexin_vpclmul_load( pSrc + 128, reflect );
+    z3 = hexin_vpclmul_load( pSrc + 192, reflect );
+    pSrc += 256;
+    len  -= 256;
+
+    while ( len >= 256 ) {
+        z0 = _mm512_xor_si512( hexin_vpclmul_fold( z0, k16 ), hexin_vpclmul_load( pSrc,       reflect ) );
+        z1 = _mm512_xor_si512( hexin_vpclmul_fold( z1, k16 ), hexin_vpclmul_load( pSrc + 64,  reflect ) );
+        z2 = _mm512_xor_si512( hexin_vpclmul_fold( z2, k16 ), hexin_vpclmul_load( pSrc + 128, reflect ) );
+        z3 = _mm512_xor_si512( hexin_vpclmul_fold( z3, k16 ), hexin_vpclmul_load( pSrc + 192, reflect ) );
+        pSrc += 256;
+        len  -= 256;
+    }
+
+    z1 = _mm512_xor_si512( hexin_vpclmul_fold( z0, k4 ), z1 );
+    z2 = _mm512_xor_si512( hexin_vpclmul_fold( z1, k4 ), z2 );
+    z0 = _mm512_xor_si512( hexin_vpclmul_fold( z2, k4 ), z3 );
+
+    while ( len >= 64 ) {
+        z0 = _mm512_xor_si512( hexin_vpclmul_fold( z0, k4 ), hexin_vpclmul_load( pSrc, reflect ) );
+        pSrc += 64;
+        len  -= 64;
+    }
+
+    /* 512 -> 128 bits : the four lanes are folded by 384, 256 and 128 bits onto the last one. */
+    k  = _mm512_inserti32x4( _mm512_setzero_si512(), hexin_clmul_keys( keys->fold3 ), 0 );
+    k  = _mm512_inserti32x4( k, hexin_clmul_keys( keys->fold2 ), 1 );
+    k  = _mm512_inserti32x4( k, hexin_clmul_keys( keys->fold1 ), 2 );
+    z1 = hexin_vpclmul_fold( z0, k );
+    t  = _mm512_extracti32x4_epi32( z0, 3 );
+    t  = _mm_xor_si128( t, _mm512_extracti32x4_epi32( z1, 0 ) );
+    t  = _mm_xor_si128( t, _mm512_extracti32x4_epi32( z1, 1 ) );
+    t  = _mm_xor_si128( t, _mm512_extracti32x4_epi32( z1, 2 ) );
+
+    return hexin_clmul_finish( keys, t, pSrc, len, reflect );
+}
+
+#endif
+
+unsigned int hexin_clmul_is_supported( void )
+{
+    return ( hexin_clmul_level() >= HEXIN_CLMUL_LEVEL_PCLMUL ) ? TRUE : FALSE;
+}
+
+const char *hexin_clmul_kernel( void )
+{
+    static const char *names[] = { "table", "pclmul", "vpclmul" };
+    return names[ hexin_clmul_level() ];
+}
+
+unsigned long long hexin_clmul_compute( const struct _hexin_clmul *clmul, unsigned long long crc,
+                                        const unsigned char *pSrc, size_t len, unsigned int reflect )
+{
+    const struct _hexin_clmul_keys *keys = reflect ? &clmul->reflect : &clmul->normal;
+
+    len &= ~( size_t )15;
+#if defined( HEXIN_CLMUL_AVX512 )
+    if ( ( len >= HEXIN_VPCLMUL_MIN_LENGTH ) && ( __hexin_clmul_level == HEXIN_CLMUL_LEVEL_VPCLMUL ) ) {
+        return hexin_clmul_compute_vpclmul( keys, crc, pSrc, len, reflect );
+    }
+#endif
+    return hexin_clmul_compute_pclmul( keys, crc, pSrc, len, reflect );
+}
+
+#else
+
+unsigned int hexin_clmul_level( void )
+{
+    return HEXIN_CLMUL_LEVEL_TABLE;
+}
+
+unsigned int hexin_clmul_is_supported( void )
+{
+    return FALSE;
+}
+
+const char *hexin_clmul_kernel( void )
+{
+    return "table";
+}
+
+unsigned long long hexin_clmul_compute( const struct _hexin_clmul *clmul, unsigned long long crc,
+                                        const unsigned char *pSrc, size_t len, unsigned int reflect )
+{
+    ( void )clmul; ( void )pSrc; ( void )len; ( void )reflect;
+    return crc;
+}
+
+#endif
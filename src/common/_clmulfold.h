@@ -0,0 +1,69 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2017-2022, Hexin
+*                                           All Rights Reserved
+* File    : _clmulfold.h
+* Version : V1.7
+*
+*   Carry-less multiplication (PCLMULQDQ) folding kernel.
+*
+*   The kernel works on a 64-bit register. Narrower CRCs are left-aligned into it
+*   ( P(x) * x^(64-width) ) when refin is FALSE, or right-aligned ( reflected ) when refin is TRUE,
+*   so the same constants and code serve every width from 1 to 64 bits.
+*
+*********************************************************************************************************
+*/
+
+#ifndef __CLMUL_FOLD_H__
+#define __CLMUL_FOLD_H__
+
+#include <stddef.h>
+#include "_dispatch.h"
+
+#ifndef TRUE
+#define                 TRUE                                    1
+#endif
+
+#ifndef FALSE
+#define                 FALSE                                   0
+#endif
+
+#if defined( __x86_64__ ) || defined( _M_X64 )
+#define                 HEXIN_CLMUL_X86_64                      1
+#endif
+
+#define                 HEXIN_CLMUL_MIN_LENGTH                  128     /* Shorter buffers stay on the slicing tables */
+#define                 HEXIN_VPCLMUL_MIN_LENGTH                256     /* Shorter buffers stay on the 128-bit kernel */
+
+#define                 HEXIN_CLMUL_LEVEL_TABLE                 0       /* Slicing tables only */
+#define                 HEXIN_CLMUL_LEVEL_PCLMUL                1       /* PCLMULQDQ, fold 4x128 bits */
+#define                 HEXIN_CLMUL_LEVEL_VPCLMUL               2       /* AVX-512 VPCLMULQDQ, fold 4x512 bits */
+
+struct _hexin_clmul_keys {
+    unsigned long long  fold16[2];      /* Fold 2048 bits : x^2048, x^2112 ( lo, hi ) */
+    unsigned long long  fold4[2];       /* Fold  512 bits : x^512, x^576 */
+    unsigned long long  fold3[2];       /* Fold  384 bits : x^384, x^448 */
+    unsigned long long  fold2[2];       /* Fold  256 bits : x^256, x^320 */
+    unsigned long long  fold1[2];       /* Fold  128 bits : x^128, x^192 */
+    unsigned long long  mu;             /* Barrett : floor( x^128 / P(x) ) without x^64 */
+    unsigned long long  poly;           /* P(x) without x^64 */
+};
+
+struct _hexin_clmul {
+    struct _hexin_clmul_keys normal;    /* MSB-first register, big-endian data */
+    struct _hexin_clmul_keys reflect;   /* LSB-first register, bit-reflected constants */
+};
+
+unsigned int hexin_clmul_level( void );
+unsigned int hexin_clmul_is_supported( void );
+const char  *hexin_clmul_kernel( void );          /* "table", "pclmul" or "vpclmul" */
+unsigned int hexin_clmul_init( struct _hexin_clmul *clmul, unsigned long long polynomial );
+
+/*
+ * Process len & ~15 bytes ( at least 16 ) and return the new register.
+ * crc : left-aligned register when reflect is FALSE, right-aligned reflected register otherwise.
+ */
+unsigned long long hexin_clmul_compute( const struct _hexin_clmul *clmul, unsigned long long crc,
+                                        const unsigned char *pSrc, size_t len, unsigned int reflect );
+
+#endif //__CLMUL_FOLD_H__
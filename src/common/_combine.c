@@ -0,0 +1,155 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2017-2022, Hexin
+*                                           All Rights Reserved
+* File    : _combine.c
+* Version : V1.7
+*
+*********************************************************************************************************
+*/
+
+#include "_combine.h"
+
+static unsigned long long hexin_combine_mask( unsigned int width )
+{
+    return ( width >= 64 ) ? ~0ULL : ( ( 1ULL << width ) - 1 );
+}
+
+static unsigned long long hexin_combine_reverse( unsigned long long data, unsigned int width )
+{
+    unsigned int i = 0;
+    unsigned long long result = 0;
+
+    for ( i=0; i<width; i++ ) {
+        result = ( result << 1 ) | ( data & 1 );
+        data >>= 1;
+    }
+    return result;
+}
+
+/*
+ * a * b mod P(x), MSB-first ( Horner over the bits of b ).
+ */
+static unsigned long long hexin_combine_multiply( const struct _hexin_combine *combine, unsigned long long a, unsigned long long b )
+{
+    unsigned int i = 0;
+    unsigned long long top    = 1ULL << ( combine->width - 1 );
+    unsigned long long mask   = hexin_combine_mask( combine->width );
+    unsigned long long result = 0;
+
+    for ( i=0; i<combine->width; i++ ) {
+        result = ( result & top ) ? ( ( ( result << 1 ) ^ combine->poly ) & mask ) : ( ( result << 1 ) & mask );
+        if ( b & ( top >> i ) ) {
+            result ^= a;
+        }
+    }
+    return result;
+}
+
+void hexin_combine_init( struct _hexin_combine *combine, unsigned int width, unsigned long long poly )
+{
+    unsigned int i = 0;
+    unsigned long long mask = hexin_combine_mask( width );
+    unsigned long long top  = 1ULL << ( width - 1 );
+    unsigned long long x8   = ( width > 0 ) ? 1 : 0;
+
+    combine->width = width;
+    combine->poly  = poly & mask;
+
+    for ( i=0; i<8; i++ ) {                                     /* x^8 mod P(x) */
+        x8 = ( x8 & top ) ? ( ( ( x8 << 1 ) ^ combine->poly ) & mask ) : ( ( x8 << 1 ) & mask );
+    }
+
+    combine->power[0] = x8;
+    for ( i=1; i<HEXIN_COMBINE_POWERS; i++ ) {
+        combine->power[i] = hexin_combine_multiply( combine, combine->power[i-1], combine->power[i-1] );
+    }
+}
+
+/*
+ * The register behind crc, advanced over len zero bytes.
+ */
+unsigned long long hexin_combine_shift( const struct _hexin_combine *combine, unsigned long long crc, unsigned long long len, unsigned int reflect )
+{
+    unsigned int k = 0;
+
+    if ( reflect ) {
+        crc = hexin_combine_reverse( crc, combine->width );
+    }
+
+    for ( k=0; ( len != 0 ) && ( k < HEXIN_COMBINE_POWERS ); k++, len >>= 1 ) {
+        if ( len & 1 ) {
+            crc = hexin_combine_multiply( combine, crc, combine->power[k] );
+        }
+    }
+
+    if ( reflect ) {
+        crc = hexin_combine_reverse( crc, combine->width );
+    }
+    return crc;
+}
+
+/*
+ * empty : the CRC of the empty message, init and xorout as the preset computes them.
+ */
+unsigned long long hexin_combine( const struct _hexin_combine *combine, unsigned int reflect, unsigned long long crc_a,
+                                  unsigned long long crc_b, unsigned long long len_b, unsigned long long empty )
+{
+    return crc_b ^ hexin_combine_shift( combine, crc_a ^ empty, len_b, reflect );
+}
+
+/*
+ * crc followed by len zero bytes : the register out( crc ^ xorout ) advanced, O( log( len ) ).
+ */
+unsigned long long hexin_combine_zeros( const struct _hexin_combine *combine, unsigned int reflect, unsigned long long crc,
+                                        unsigned long long len, unsigned long long xorout )
+{
+    return hexin_combine_shift( combine, crc ^ xorout, len, reflect ) ^ xorout;
+}
+
+/*
+ * crc followed by count copies of a block, crc_block = CRC( block ). One copy maps u = crc ^ empty
+ * to y * u + d with y = x^( 8 * len( block ) ) and d = crc_block ^ empty, so count copies give
+ *      u' = y^count * u + ( 1 + y + ... + y^( count - 1 ) ) * d
+ * y^count and the sum are built together over the bits of count, O( log( count ) + log( len ) ).
+ */
+unsigned long long hexin_combine_repeat( const struct _hexin_combine *combine, unsigned int reflect, unsigned long long crc,
+                                         unsigned long long crc_block, unsigned long long len_block, unsigned long long count,
+                                         unsigned long long empty )
+{
+    unsigned long long y  = hexin_combine_shift( combine, 1, len_block, 0 );
+    unsigned long long u  = crc ^ empty, d = crc_block ^ empty;
+    unsigned long long ym = 1, sum = 0;                         /* y^m and 1 + ... + y^( m - 1 ), m = 0 */
+    int k = 0;
+
+    if ( reflect ) {
+        u = hexin_combine_reverse( u, combine->width );
+        d = hexin_combine_reverse( d, combine->width );
+    }
+
+    for ( k=63; k>=0; k-- ) {
+        sum = hexin_combine_multiply( combine, sum, ym ^ 1 );   /* m -> 2m */
+        ym  = hexin_combine_multiply( combine, ym, ym );
+        if ( ( count >> k ) & 1 ) {                             /* m -> m + 1 */
+            sum ^= ym;
+            ym   = hexin_combine_multiply( combine, ym, y );
+        }
+    }
+
+    u = hexin_combine_multiply( combine, ym, u ) ^ hexin_combine_multiply( combine, sum, d );
+    if ( reflect ) {
+        u = hexin_combine_reverse( u, combine->width );
+    }
+    return u ^ empty;
+}
+
+/*
+ * crc after a range of the message was rewritten, crc_old / crc_new : the CRCs of the range before and
+ * after, len_after : the bytes that follow the range. init and xorout cancel out between two messages of
+ * the same length, so the change is CRC( new ) ^ CRC( old ) advanced over len_after zero bytes.
+ */
+unsigned long long hexin_combine_patch( const struct _hexin_combine *combine, unsigned int reflect, unsigned long long crc,
+                                        unsigned long long crc_old, unsigned long long crc_new, unsigned long long len_after )
+{
+    return crc ^ hexin_combine_shift( combine, crc_old ^ crc_new, len_after, reflect );
+}
@@ -0,0 +1,48 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2017-2022, Hexin
+*                                           All Rights Reserved
+* File    : _combine.h
+* Version : V1.7
+*
+*   CRC( A || B ) from CRC( A ), CRC( B ) and len( B ). Every preset computes
+*       crc = out( register ) ^ xorout,   out() is the identity or the bit reversal ( refout )
+*   so the register of A, advanced over len( B ) zero bytes, is the only missing term :
+*       CRC( A || B ) = CRC( B ) ^ shift( CRC( A ) ^ CRC( "" ), len( B ) )
+*   shift() multiplies by x^( 8 * len ) mod P(x) with the x^( 8 * 2^k ) powers, O( log( len ) ).
+*   The powers of the named presets are generated at build time ( hexin_crcN_combine_POLY ).
+*   The same powers append zero bytes or repeated blocks without reading them.
+*
+*********************************************************************************************************
+*/
+
+#ifndef __HEXIN_COMBINE_H__
+#define __HEXIN_COMBINE_H__
+
+#define                 HEXIN_COMBINE_POWERS                    64
+
+struct _hexin_combine {
+    unsigned int        width;                          /* 1 ... 64 */
+    unsigned long long  poly;                           /* P(x) without x^width, MSB-first */
+    unsigned long long  power[HEXIN_COMBINE_POWERS];    /* x^( 8 * 2^k ) mod P(x) */
+};
+
+void hexin_combine_init( struct _hexin_combine *combine, unsigned int width, unsigned long long poly );
+
+/* reflect : refout, the CRC is bit-reflected */
+unsigned long long hexin_combine_shift( const struct _hexin_combine *combine, unsigned long long crc, unsigned long long len, unsigned int reflect );
+unsigned long long hexin_combine( const struct _hexin_combine *combine, unsigned int reflect, unsigned long long crc_a,
+                                  unsigned long long crc_b, unsigned long long len_b, unsigned long long empty );
+
+/* CRC( A || len zero bytes ) and CRC( A || count copies of a block ) from CRC( A ), O( log ). */
+unsigned long long hexin_combine_zeros( const struct _hexin_combine *combine, unsigned int reflect, unsigned long long crc,
+                                        unsigned long long len, unsigned long long xorout );
+unsigned long long hexin_combine_repeat( const struct _hexin_combine *combine, unsigned int reflect, unsigned long long crc,
+                                         unsigned long long crc_block, unsigned long long len_block, unsigned long long count,
+                                         unsigned long long empty );
+
+/* CRC( A ) after a range of A was rewritten, from the CRCs of the old and the new range, O( log( len_after ) ). */
+unsigned long long hexin_combine_patch( const struct _hexin_combine *combine, unsigned int reflect, unsigned long long crc,
+                                        unsigned long long crc_old, unsigned long long crc_new, unsigned long long len_after );
+
+#endif //__HEXIN_COMBINE_H__
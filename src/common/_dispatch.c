@@ -0,0 +1,205 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2017-2022, Hexin
+*                                           All Rights Reserved
+* File    : _dispatch.c
+* Version : V1.7
+*
+*********************************************************************************************************
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "_dispatch.h"
+
+#if defined( HEXIN_DISPATCH_X86_64 )
+#if defined( _MSC_VER )
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+static const char *__hexin_kernel_names[] = { "table", "sse42", "pclmul", "vpclmul" };
+
+static int __hexin_cpu_features = -1;
+static int __hexin_kernel_tier  = -1;
+
+static size_t __hexin_gil_threshold = ( size_t )-1;
+
+#if defined( HEXIN_DISPATCH_X86_64 )
+
+static void hexin_cpuid( unsigned int leaf, unsigned int *regs )
+{
+#if defined( _MSC_VER )
+    int info[4] = { 0 };
+    __cpuidex( info, ( int )leaf, 0 );
+    regs[0] = ( unsigned int )info[0]; regs[1] = ( unsigned int )info[1];
+    regs[2] = ( unsigned int )info[2]; regs[3] = ( unsigned int )info[3];
+#else
+    if ( ( __get_cpuid_max( 0, 0 ) < leaf ) ) {
+        regs[0] = regs[1] = regs[2] = regs[3] = 0;
+        return;
+    }
+    __cpuid_count( leaf, 0, regs[0], regs[1], regs[2], regs[3] );
+#endif
+}
+
+static unsigned long long hexin_xgetbv( void )
+{
+#if defined( _MSC_VER )
+    return ( unsigned long long )_xgetbv( 0 );
+#else
+    unsigned int eax = 0, edx = 0;
+    __asm__ __volatile__ ( "xgetbv" : "=a"( eax ), "=d"( edx ) : "c"( 0 ) );
+    return ( ( unsigned long long )edx << 32 ) | eax;
+#endif
+}
+
+static unsigned int hexin_cpu_probe( void )
+{
+    unsigned int leaf1[4] = { 0 }, leaf7[4] = { 0 };
+    unsigned int features = 0;
+    unsigned long long xcr0 = 0;
+
+    hexin_cpuid( 1, leaf1 );
+    hexin_cpuid( 7, leaf7 );
+
+    if ( leaf1[2] & 0x00100000 ) {                              /* SSE4.2(ECX 20) */
+        features |= HEXIN_CPU_SSE42;
+    }
+    if ( ( leaf1[2] & 0x00080202 ) == 0x00080202 ) {            /* PCLMULQDQ(ECX 1), SSSE3(9), SSE4.1(19) */
+        features |= HEXIN_CPU_PCLMUL;
+    }
+
+    /* OSXSAVE(ECX 27) and AVX(ECX 28), then ask the OS which register states it saves. */
+    if ( ( leaf1[2] & 0x18000000 ) != 0x18000000 ) {
+        return features;
+    }
+    xcr0 = hexin_xgetbv();
+
+    if ( ( ( xcr0 & 0x06 ) == 0x06 ) && ( leaf7[1] & 0x00000020 ) ) {                  /* XMM, YMM, AVX2(EBX 5) */
+        features |= HEXIN_CPU_AVX2;
+    }
+    if ( ( ( xcr0 & 0xE6 ) == 0xE6 ) && ( ( leaf7[1] & 0x40010000 ) == 0x40010000 ) ) { /* + opmask, ZMM, AVX512F(EBX 16), AVX512BW(EBX 30) */
+        features |= HEXIN_CPU_AVX512;
+    }
+    if ( ( ( xcr0 & 0x06 ) == 0x06 ) && ( leaf7[2] & 0x00000400 ) ) {                  /* VPCLMULQDQ(ECX 10) */
+        features |= HEXIN_CPU_VPCLMUL;
+    }
+
+    return features;
+}
+
+#else
+
+static unsigned int hexin_cpu_probe( void )
+{
+    return 0;
+}
+
+#endif
+
+unsigned int hexin_cpu_features( void )
+{
+    if ( __hexin_cpu_features < 0 ) {
+        __hexin_cpu_features = ( int )hexin_cpu_probe();
+    }
+    return ( unsigned int )__hexin_cpu_features;
+}
+
+/*
+ * The highest tier the CPU runs, lowered by LIBSCRC_KERNEL when it names a known tier.
+ */
+unsigned int hexin_kernel_tier( void )
+{
+    unsigned int i = 0, features = 0;
+    unsigned int tier = HEXIN_KERNEL_TABLE;
+    const char *force = NULL;
+
+    if ( __hexin_kernel_tier >= 0 ) {
+        return ( unsigned int )__hexin_kernel_tier;
+    }
+
+    features = hexin_cpu_features();
+    if ( features & HEXIN_CPU_SSE42 ) {
+        tier = HEXIN_KERNEL_SSE42;
+    }
+    if ( features & HEXIN_CPU_PCLMUL ) {
+        tier = HEXIN_KERNEL_PCLMUL;
+        if ( ( features & ( HEXIN_CPU_AVX512 | HEXIN_CPU_VPCLMUL ) ) == ( HEXIN_CPU_AVX512 | HEXIN_CPU_VPCLMUL ) ) {
+            tier = HEXIN_KERNEL_VPCLMUL;
+        }
+    }
+
+    force = getenv( HEXIN_KERNEL_ENVIRON );
+    for ( i=0; ( force != NULL ) && ( i < sizeof( __hexin_kernel_names ) / sizeof( __hexin_kernel_names[0] ) ); i++ ) {
+        if ( ( 0 == strcmp( force, __hexin_kernel_names[i] ) ) && ( i < tier ) ) {
+            tier = i;
+        }
+    }
+
+    __hexin_kernel_tier = ( int )tier;
+    return tier;
+}
+
+/*
+ * FALSE when LIBSCRC_KERNEL is set to a name that is no tier, hexin_kernel_tier() then ignores it.
+ */
+unsigned int hexin_kernel_is_known( void )
+{
+    unsigned int i = 0;
+    const char *force = getenv( HEXIN_KERNEL_ENVIRON );
+
+    if ( ( force == NULL ) || ( *force == '\0' ) ) {
+        return 1;
+    }
+    for ( i=0; i < sizeof( __hexin_kernel_names ) / sizeof( __hexin_kernel_names[0] ); i++ ) {
+        if ( 0 == strcmp( force, __hexin_kernel_names[i] ) ) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+const char *hexin_kernel_name( unsigned int tier )
+{
+    if ( tier >= sizeof( __hexin_kernel_names ) / sizeof( __hexin_kernel_names[0] ) ) {
+        return "unknown";
+    }
+    return __hexin_kernel_names[tier];
+}
+
+size_t hexin_gil_threshold( void )
+{
+    const char *value = NULL;
+    char *end = NULL;
+    unsigned long long threshold = 0;
+
+    if ( __hexin_gil_threshold != ( size_t )-1 ) {
+        return __hexin_gil_threshold;
+    }
+
+    __hexin_gil_threshold = HEXIN_GIL_THRESHOLD;
+    value = getenv( HEXIN_GIL_ENVIRON );
+    if ( ( value != NULL ) && ( *value != '\0' ) ) {
+        threshold = strtoull( value, &end, 10 );
+        if ( ( *end == '\0' ) && ( threshold < ( size_t )-1 ) ) {
+            __hexin_gil_threshold = ( size_t )threshold;
+        }
+    }
+    return __hexin_gil_threshold;
+}
+
+/*
+ * Returns the previous threshold, 0 releases the GIL for every buffer.
+ */
+size_t hexin_set_gil_threshold( size_t threshold )
+{
+    size_t previous = hexin_gil_threshold();
+
+    if ( threshold != ( size_t )-1 ) {
+        __hexin_gil_threshold = threshold;
+    }
+    return previous;
+}
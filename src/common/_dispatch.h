@@ -0,0 +1,53 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2017-2022, Hexin
+*                                           All Rights Reserved
+* File    : _dispatch.h
+* Version : V1.7
+*
+*   CPU feature probe shared by every family. The features are read once, when the module is
+*   imported, and give the highest kernel tier the families may bind to. LIBSCRC_KERNEL lowers
+*   that tier ( table / sse42 / pclmul / vpclmul ), a tier the CPU lacks is never selected. Any
+*   other value is ignored with a RuntimeWarning when a module is imported.
+*
+*   Buffers of at least hexin_gil_threshold() bytes are computed with the GIL released.
+*   LIBSCRC_GIL_THRESHOLD sets the first value, hexin_set_gil_threshold() changes it later.
+*
+*********************************************************************************************************
+*/
+
+#ifndef __HEXIN_DISPATCH_H__
+#define __HEXIN_DISPATCH_H__
+
+#include <stddef.h>
+
+#if defined( __x86_64__ ) || defined( _M_X64 )
+#define                 HEXIN_DISPATCH_X86_64                   1
+#endif
+
+#define                 HEXIN_CPU_SSE42                         0x00000001      /* crc32 instruction */
+#define                 HEXIN_CPU_PCLMUL                        0x00000002      /* PCLMULQDQ, SSSE3, SSE4.1 */
+#define                 HEXIN_CPU_AVX2                          0x00000004
+#define                 HEXIN_CPU_AVX512                        0x00000008      /* AVX512F, AVX512BW, ZMM state saved by the OS */
+#define                 HEXIN_CPU_VPCLMUL                       0x00000010      /* VPCLMULQDQ */
+
+#define                 HEXIN_KERNEL_TABLE                      0               /* Slicing-by-16 tables */
+#define                 HEXIN_KERNEL_SSE42                      1               /* + crc32 instruction ( CRC-32C ) */
+#define                 HEXIN_KERNEL_PCLMUL                     2               /* + fold 4x128 bits */
+#define                 HEXIN_KERNEL_VPCLMUL                    3               /* + fold 4x512 bits */
+
+#define                 HEXIN_KERNEL_ENVIRON                    "LIBSCRC_KERNEL"
+#define                 HEXIN_KERNEL_UNKNOWN                    "LIBSCRC_KERNEL is not one of table, sse42, pclmul, vpclmul : ignored, the highest tier of the CPU is used"
+
+#define                 HEXIN_GIL_THRESHOLD                     8192            /* Releasing the GIL costs about a 1 KiB table pass */
+#define                 HEXIN_GIL_ENVIRON                       "LIBSCRC_GIL_THRESHOLD"
+
+unsigned int hexin_cpu_features( void );
+unsigned int hexin_kernel_tier( void );
+unsigned int hexin_kernel_is_known( void );
+const char  *hexin_kernel_name( unsigned int tier );
+
+size_t       hexin_gil_threshold( void );
+size_t       hexin_set_gil_threshold( size_t threshold );
+
+#endif //__HEXIN_DISPATCH_H__
@@ -0,0 +1,235 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2017-2022, Hexin
+*                                           All Rights Reserved
+* File    : _fastcall.c
+* Version : V1.7
+*
+*********************************************************************************************************
+*/
+
+#define PY_SSIZE_T_CLEAN
+#include "_fastcall.h"
+
+static const char *const __hexin_preset_kwlist[] = { "data", "init", "threads", NULL };
+
+#if PY_MAJOR_VERSION >= 3
+#define                 HEXIN_PRESET_POSITIONAL                 2               /* threads is keyword-only */
+#else
+#define                 HEXIN_PRESET_POSITIONAL                 3
+#endif /* PY_MAJOR_VERSION */
+
+static Py_ssize_t hexin_fastcall_keyword( PyObject *key, const char *const *kwlist )
+{
+    Py_ssize_t i = 0;
+
+    for ( i=0; kwlist[i] != NULL; i++ ) {
+#if PY_MAJOR_VERSION >= 3
+        if ( PyUnicode_Check( key ) && ( 0 == PyUnicode_CompareWithASCIIString( key, kwlist[i] ) ) ) {
+#else
+        if ( PyString_Check( key ) && ( 0 == strcmp( PyString_AS_STRING( key ), kwlist[i] ) ) ) {
+#endif /* PY_MAJOR_VERSION */
+            return i;
+        }
+    }
+    return -1;
+}
+
+static int hexin_fastcall_set( PyObject *key, PyObject *value, const char *const *kwlist, PyObject **values )
+{
+    Py_ssize_t i = hexin_fastcall_keyword( key, kwlist );
+
+    if ( i < 0 ) {
+        PyErr_Format( PyExc_TypeError, "'%S' is an invalid keyword argument for this function", key );
+        return -1;
+    }
+    if ( values[i] != NULL ) {
+        PyErr_Format( PyExc_TypeError, "argument for function given by name ('%s') and position", kwlist[i] );
+        return -1;
+    }
+    values[i] = value;
+    return 0;
+}
+
+Py_ssize_t hexin_fastcall_parse( HEXIN_FASTCALL_PARAMS, const char *const *kwlist,
+                                 Py_ssize_t required, Py_ssize_t positional, PyObject **values )
+{
+    Py_ssize_t i = 0, count = 0;
+
+#if defined( HEXIN_FASTCALL )
+    count = nargs;
+#else
+    Py_ssize_t pos = 0;
+    PyObject *key = NULL, *value = NULL;
+
+    count = PyTuple_GET_SIZE( args );
+#endif
+
+    for ( i=0; kwlist[i] != NULL; i++ ) {
+        values[i] = NULL;
+    }
+    if ( count > positional ) {
+        PyErr_Format( PyExc_TypeError, "function takes at most %zd positional arguments (%zd given)", positional, count );
+        return -1;
+    }
+
+#if defined( HEXIN_FASTCALL )
+    for ( i=0; i<count; i++ ) {
+        values[i] = args[i];
+    }
+    for ( i=0; ( kwnames != NULL ) && ( i < PyTuple_GET_SIZE( kwnames ) ); i++ ) {
+        if ( hexin_fastcall_set( PyTuple_GET_ITEM( kwnames, i ), args[count + i], kwlist, values ) < 0 ) {
+            return -1;
+        }
+    }
+#else
+    for ( i=0; i<count; i++ ) {
+        values[i] = PyTuple_GET_ITEM( args, i );
+    }
+    while ( ( kws != NULL ) && PyDict_Next( kws, &pos, &key, &value ) ) {
+        if ( hexin_fastcall_set( key, value, kwlist, values ) < 0 ) {
+            return -1;
+        }
+    }
+#endif
+
+    for ( i=0; i<required; i++ ) {
+        if ( values[i] == NULL ) {
+            PyErr_Format( PyExc_TypeError, "function missing required argument '%s' (pos %zd)", kwlist[i], i + 1 );
+            return -1;
+        }
+    }
+    return count;
+}
+
+int hexin_fastcall_buffer( PyObject *object, Py_buffer *view )
+{
+#if PY_MAJOR_VERSION >= 3
+    if ( PyUnicode_Check( object ) ) {
+        PyErr_Format( PyExc_TypeError, "a bytes-like object is required, not '%.100s'", Py_TYPE( object )->tp_name );
+        return -1;
+    }
+    return PyObject_GetBuffer( object, view, PyBUF_SIMPLE );
+#else
+    return PyArg_Parse( object, "s*", view ) ? 0 : -1;
+#endif /* PY_MAJOR_VERSION */
+}
+
+int hexin_fastcall_mask( PyObject *object, unsigned long long *value )
+{
+    if ( PyFloat_Check( object ) ) {
+        PyErr_SetString( PyExc_TypeError, "integer argument expected, got float" );
+        return -1;
+    }
+#if PY_MAJOR_VERSION >= 3
+    *value = PyLong_AsUnsignedLongLongMask( object );
+#else
+    *value = PyInt_AsUnsignedLongLongMask( object );
+#endif /* PY_MAJOR_VERSION */
+    return ( ( *value == ( unsigned long long )-1 ) && PyErr_Occurred() ) ? -1 : 0;
+}
+
+int hexin_fastcall_count( PyObject *object, unsigned long long *value )
+{
+    PyObject *number = NULL, *zero = NULL;
+    long long sign = 0;
+    int negative = 0;
+
+    if ( PyFloat_Check( object ) ) {
+        PyErr_SetString( PyExc_TypeError, "integer argument expected, got float" );
+        return -1;
+    }
+#if PY_MAJOR_VERSION >= 3
+    number = PyNumber_Index( object );
+#else
+    number = PyNumber_Long( object );
+#endif /* PY_MAJOR_VERSION */
+    if ( number == NULL ) {
+        return -1;
+    }
+
+    sign = PyLong_AsLongLong( number );
+    if ( ( sign == -1 ) && PyErr_Occurred() ) {                 /* Beyond 63 bits */
+        PyErr_Clear();
+        zero     = PyLong_FromLong( 0 );
+        negative = ( zero != NULL ) ? PyObject_RichCompareBool( number, zero, Py_LT ) : -1;
+        Py_XDECREF( zero );
+    } else {
+        negative = ( sign < 0 );
+    }
+    if ( negative != 0 ) {
+        Py_DECREF( number );
+        if ( negative > 0 ) {
+            PyErr_SetString( PyExc_ValueError, "value must not be negative" );
+        }
+        return -1;
+    }
+
+    *value = PyLong_AsUnsignedLongLong( number );
+    Py_DECREF( number );
+    if ( ( *value == ( unsigned long long )-1 ) && PyErr_Occurred() ) {
+        if ( PyErr_ExceptionMatches( PyExc_OverflowError ) ) {
+            PyErr_SetString( PyExc_OverflowError, "value does not fit in 64 bits" );
+        }
+        return -1;
+    }
+    return 0;
+}
+
+int hexin_PyArg_count( PyObject *object, void *value )
+{
+    return ( hexin_fastcall_count( object, ( unsigned long long * )value ) < 0 ) ? 0 : 1;
+}
+
+int hexin_fastcall_threads( PyObject *object, unsigned int *value )
+{
+    unsigned long long count = 0;
+
+    if ( hexin_fastcall_count( object, &count ) < 0 ) {
+        if ( PyErr_ExceptionMatches( PyExc_OverflowError ) ) {
+            PyErr_SetString( PyExc_ValueError, "threads is out of range" );
+        }
+        return -1;
+    }
+    if ( count > 0xFFFFFFFFULL ) {
+        PyErr_SetString( PyExc_ValueError, "threads is out of range" );
+        return -1;
+    }
+    *value = ( unsigned int )count;
+    return 0;
+}
+
+int hexin_PyArg_threads( PyObject *object, void *value )
+{
+    return ( hexin_fastcall_threads( object, ( unsigned int * )value ) < 0 ) ? 0 : 1;
+}
+
+int hexin_fastcall_bool( PyObject *object, unsigned int *value )
+{
+    int truth = PyObject_IsTrue( object );
+
+    if ( truth < 0 ) {
+        return -1;
+    }
+    *value = ( unsigned int )truth;
+    return 0;
+}
+
+int hexin_fastcall_preset( HEXIN_FASTCALL_PARAMS, Py_buffer *data, unsigned long long *init, unsigned int *threads )
+{
+    PyObject *values[3];
+
+    if ( hexin_fastcall_parse( HEXIN_FASTCALL_ARGS, __hexin_preset_kwlist, 1, HEXIN_PRESET_POSITIONAL, values ) < 0 ) {
+        return -1;
+    }
+    if ( ( values[1] != NULL ) && ( hexin_fastcall_mask( values[1], init ) < 0 ) ) {
+        return -1;
+    }
+    if ( ( values[2] != NULL ) && ( hexin_fastcall_threads( values[2], threads ) < 0 ) ) {
+        return -1;
+    }
+    if ( hexin_fastcall_buffer( values[0], data ) < 0 ) {
+        return -1;
+    }
+    return ( values[1] != NULL ) ? 2 : 1;
+}
@@ -0,0 +1,60 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2017-2022, Hexin
+*                                           All Rights Reserved
+* File    : _fastcall.h
+* Version : V1.7
+*
+*   Argument parsing of the CRC functions without a format string. Python 3.7+ passes the arguments
+*   as a C array ( METH_FASTCALL ), older versions as a tuple and a dict, hexin_fastcall_parse()
+*   reads both. Integers are converted like "B" / "H" / "I" / "K" : masked, never range checked.
+*
+*********************************************************************************************************
+*/
+
+#ifndef __HEXIN_FASTCALL_H__
+#define __HEXIN_FASTCALL_H__
+
+#include <Python.h>
+
+#if PY_VERSION_HEX >= 0x03070000
+#define                 HEXIN_FASTCALL                          1
+#define                 HEXIN_METH_FASTCALL                     ( METH_FASTCALL | METH_KEYWORDS )
+#define                 HEXIN_FASTCALL_PARAMS                   PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames
+#define                 HEXIN_FASTCALL_ARGS                     args, nargs, kwnames
+#else
+#define                 HEXIN_METH_FASTCALL                     ( METH_VARARGS | METH_KEYWORDS )
+#define                 HEXIN_FASTCALL_PARAMS                   PyObject *args, PyObject *kws
+#define                 HEXIN_FASTCALL_ARGS                     args, kws
+#endif
+
+/*
+ * values[] gets borrowed references in kwlist order, NULL when missing. The first `positional`
+ * names may be given by position, the first `required` ones must be given.
+ * Returns the number of positional arguments, -1 with an exception set.
+ */
+Py_ssize_t hexin_fastcall_parse( HEXIN_FASTCALL_PARAMS, const char *const *kwlist,
+                                 Py_ssize_t required, Py_ssize_t positional, PyObject **values );
+
+int hexin_fastcall_buffer( PyObject *object, Py_buffer *view );                 /* "y*" ( "s*" on Python 2 ) */
+int hexin_fastcall_mask( PyObject *object, unsigned long long *value );         /* "B" / "H" / "I" / "K" */
+int hexin_fastcall_bool( PyObject *object, unsigned int *value );               /* "p" */
+
+/*
+ * A length, a count or a CRC : a non-negative int of at most 64 bits, nothing is masked. ValueError
+ * when negative, OverflowError when too large. hexin_PyArg_count() is the "O&" converter of it.
+ */
+int hexin_fastcall_count( PyObject *object, unsigned long long *value );
+int hexin_PyArg_count( PyObject *object, void *value );
+
+/* threads : 0 ( every CPU ) ... 2^32 - 1, ValueError when negative or beyond. hexin_PyArg_threads() is the "O&" converter. */
+int hexin_fastcall_threads( PyObject *object, unsigned int *value );
+int hexin_PyArg_threads( PyObject *object, void *value );
+
+/*
+ * data [, init ] [, *, threads ] of the presets. Returns is_gradual : 2 when init is given, else 1.
+ * -1 with an exception set.
+ */
+int hexin_fastcall_preset( HEXIN_FASTCALL_PARAMS, Py_buffer *data, unsigned long long *init, unsigned int *threads );
+
+#endif //__HEXIN_FASTCALL_H__
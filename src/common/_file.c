@@ -0,0 +1,472 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2017-2022, Hexin
+*                                           All Rights Reserved
+* File    : _file.c
+* Version : V1.7
+*
+*********************************************************************************************************
+*/
+
+#define PY_SSIZE_T_CLEAN
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include "_file.h"
+#include "_parallel.h"
+
+#if defined( _WIN32 )
+#include <windows.h>
+#include <process.h>
+#include <io.h>
+#define                 HEXIN_FILE_READ( fd, buf, len )         _read( fd, buf, ( unsigned int )( len ) )
+#define                 HEXIN_FILE_CLOSE( fd )                  _close( fd )
+#else
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define                 HEXIN_FILE_READ( fd, buf, len )         read( fd, buf, len )
+#define                 HEXIN_FILE_CLOSE( fd )                  close( fd )
+#endif
+
+/* Reads until the buffer is full or the end of the file, returns the bytes read, -1 with errno set. */
+static long long hexin_file_fill( int fd, unsigned char *buffer, size_t size )
+{
+    size_t done = 0;
+    long long got = 0;
+
+    while ( done < size ) {
+        got = ( long long )HEXIN_FILE_READ( fd, buffer + done, size - done );
+        if ( got < 0 ) {
+            if ( errno == EINTR ) {
+                continue;
+            }
+            return -1;
+        }
+        if ( got == 0 ) {
+            break;
+        }
+        done += ( size_t )got;
+    }
+    return ( long long )done;
+}
+
+/* One buffer at a time, in the calling thread. Returns 0 or errno. */
+static int hexin_file_serial( const struct _hexin_hasher_ops *ops, const void *param, int fd, unsigned long long *crc, unsigned long long *size )
+{
+    unsigned char *buffer = ( unsigned char * )malloc( HEXIN_FILE_BUFFER );
+    long long got = 0;
+    int error = 0;
+
+    if ( buffer == NULL ) {
+        return ENOMEM;
+    }
+    while ( ( got = hexin_file_fill( fd, buffer, HEXIN_FILE_BUFFER ) ) > 0 ) {
+        *crc   = ops->update( param, *crc, buffer, ( size_t )got );
+        *size += ( unsigned long long )got;
+    }
+    error = ( got < 0 ) ? errno : 0;
+    free( buffer );
+    return error;
+}
+
+#if defined( _WIN32 )
+
+static int hexin_file_crc( const struct _hexin_hasher_ops *ops, const void *param, int fd, unsigned long long *crc, unsigned long long *size )
+{
+    return hexin_file_serial( ops, param, fd, crc, size );
+}
+
+#else
+
+/*
+ * A regular file from the current position : one mapping, read ahead by the kernel while the
+ * pages behind are computed. Returns 0 or errno, -1 when the file cannot be mapped.
+ */
+static int hexin_file_map( const struct _hexin_hasher_ops *ops, const void *param, int fd, unsigned long long *crc, unsigned long long *size )
+{
+    struct stat info;
+    off_t start = 0, base = 0;
+    long page = sysconf( _SC_PAGESIZE );
+    void *map = NULL;
+
+    if ( ( fstat( fd, &info ) < 0 ) || !S_ISREG( info.st_mode ) || ( page <= 0 ) ) {
+        return -1;
+    }
+    start = lseek( fd, 0, SEEK_CUR );
+    if ( start < 0 ) {
+        return -1;
+    }
+    /* Nothing to map : procfs / sysfs files report a size of 0, read() knows better. */
+    if ( start >= info.st_size ) {
+        return -1;
+    }
+    base = start - ( start % page );
+    if ( ( unsigned long long )( info.st_size - base ) > ( unsigned long long )( ( size_t )-1 >> 1 ) ) {
+        return -1;
+    }
+
+    map = mmap( NULL, ( size_t )( info.st_size - base ), PROT_READ, MAP_PRIVATE, fd, base );
+    if ( map == MAP_FAILED ) {
+        return -1;
+    }
+#if defined( MADV_SEQUENTIAL )
+    madvise( map, ( size_t )( info.st_size - base ), MADV_SEQUENTIAL );
+#endif
+    *crc  = ops->update( param, *crc, ( const unsigned char * )map + ( start - base ), ( size_t )( info.st_size - start ) );
+    *size = ( unsigned long long )( info.st_size - start );
+    munmap( map, ( size_t )( info.st_size - base ) );
+
+    /* As read() would leave it. */
+    lseek( fd, info.st_size, SEEK_SET );
+    return 0;
+}
+
+struct _hexin_file_reader {
+    int                  fd;
+    unsigned char       *buffer[2];
+    long long            length[2];         /* Bytes in the buffer, 0 at the end, -1 on error */
+    int                  ready[2];          /* Filled by the reader, not computed yet */
+    int                  error;
+    pthread_mutex_t      lock;
+    pthread_cond_t       cond;
+};
+
+static void *hexin_file_reader_thread( void *arg )
+{
+    struct _hexin_file_reader *reader = ( struct _hexin_file_reader * )arg;
+    unsigned int slot = 0;
+    long long got = 0;
+
+    for ( slot = 0; ; slot ^= 1 ) {
+        pthread_mutex_lock( &reader->lock );
+        while ( reader->ready[slot] ) {
+            pthread_cond_wait( &reader->cond, &reader->lock );
+        }
+        pthread_mutex_unlock( &reader->lock );
+
+        got = hexin_file_fill( reader->fd, reader->buffer[slot], HEXIN_FILE_BUFFER );
+
+        pthread_mutex_lock( &reader->lock );
+        reader->error        = ( got < 0 ) ? errno : 0;
+        reader->length[slot] = got;
+        reader->ready[slot]  = 1;
+        pthread_cond_broadcast( &reader->cond );
+        pthread_mutex_unlock( &reader->lock );
+
+        if ( got <= 0 ) {
+            break;
+        }
+    }
+    return NULL;
+}
+
+/* Double buffering : the helper thread reads one buffer while the caller computes the other. Returns 0 or errno. */
+static int hexin_file_stream( const struct _hexin_hasher_ops *ops, const void *param, int fd, unsigned long long *crc, unsigned long long *size )
+{
+    struct _hexin_file_reader reader;
+    pthread_t thread;
+    unsigned int slot = 0;
+    long long got = 0;
+    int error = 0;
+
+    reader.fd        = fd;
+    reader.buffer[0] = ( unsigned char * )malloc( 2 * ( size_t )HEXIN_FILE_BUFFER );
+    reader.buffer[1] = reader.buffer[0] + HEXIN_FILE_BUFFER;
+    reader.ready[0]  = reader.ready[1] = 0;
+    reader.error     = 0;
+    if ( reader.buffer[0] == NULL ) {
+        return ENOMEM;
+    }
+    pthread_mutex_init( &reader.lock, NULL );
+    pthread_cond_init( &reader.cond, NULL );
+
+    if ( 0 != pthread_create( &thread, NULL, hexin_file_reader_thread, &reader ) ) {
+        error = hexin_file_serial( ops, param, fd, crc, size );
+    } else {
+        for ( slot = 0; ; slot ^= 1 ) {
+            pthread_mutex_lock( &reader.lock );
+            while ( !reader.ready[slot] ) {
+                pthread_cond_wait( &reader.cond, &reader.lock );
+            }
+            got   = reader.length[slot];
+            error = reader.error;
+            pthread_mutex_unlock( &reader.lock );
+
+            if ( got <= 0 ) {
+                break;
+            }
+            *crc   = ops->update( param, *crc, reader.buffer[slot], ( size_t )got );
+            *size += ( unsigned long long )got;
+
+            pthread_mutex_lock( &reader.lock );
+            reader.ready[slot] = 0;
+            pthread_cond_broadcast( &reader.cond );
+            pthread_mutex_unlock( &reader.lock );
+        }
+        pthread_join( thread, NULL );
+    }
+
+    pthread_cond_destroy( &reader.cond );
+    pthread_mutex_destroy( &reader.lock );
+    free( reader.buffer[0] );
+    return error;
+}
+
+static int hexin_file_crc( const struct _hexin_hasher_ops *ops, const void *param, int fd, unsigned long long *crc, unsigned long long *size )
+{
+    int error = hexin_file_map( ops, param, fd, crc, size );
+
+    return ( error >= 0 ) ? error : hexin_file_stream( ops, param, fd, crc, size );
+}
+
+#endif /* _WIN32 */
+
+struct _hexin_file_item {
+    PyObject            *file;              /* The caller's path or descriptor, borrowed */
+    PyObject            *path;              /* File system encoded path, NULL for a descriptor */
+#if defined( _WIN32 ) && ( PY_MAJOR_VERSION >= 3 )
+    wchar_t             *name;
+#endif
+    int                  fd;
+    int                  error;             /* errno */
+    unsigned long long   crc;               /* Raw register, see the hasher ops */
+    unsigned long long   size;
+};
+
+/* With the GIL : a path or a descriptor. Returns -1 with an exception set. */
+static int hexin_file_item_init( struct _hexin_file_item *item, PyObject *file )
+{
+    long number = -1;
+
+    memset( item, 0, sizeof( *item ) );
+    item->file = file;
+    item->fd   = -1;
+
+#if PY_MAJOR_VERSION >= 3
+    if ( PyLong_Check( file ) ) {
+#else
+    if ( PyInt_Check( file ) || PyLong_Check( file ) ) {
+#endif /* PY_MAJOR_VERSION */
+        number = PyLong_AsLong( file );
+        if ( ( number == -1 ) && PyErr_Occurred() ) {
+            return -1;
+        }
+        if ( ( number < 0 ) || ( number > 0x7FFFFFFFL ) ) {
+            PyErr_SetString( PyExc_ValueError, "file descriptor must be a non-negative int" );
+            return -1;
+        }
+        item->fd = ( int )number;
+        return 0;
+    }
+
+#if defined( _WIN32 ) && ( PY_MAJOR_VERSION >= 3 )
+    if ( !PyUnicode_FSDecoder( file, &item->path ) ) {
+        return -1;
+    }
+    item->name = PyUnicode_AsWideCharString( item->path, NULL );
+    return ( item->name != NULL ) ? 0 : -1;
+#elif PY_MAJOR_VERSION >= 3
+    return PyUnicode_FSConverter( file, &item->path ) ? 0 : -1;
+#else
+    if ( !PyString_Check( file ) ) {
+        PyErr_SetString( PyExc_TypeError, "file must be a path or a file descriptor" );
+        return -1;
+    }
+    Py_INCREF( file );
+    item->path = file;
+    return 0;
+#endif
+}
+
+/* Without the GIL : open, compute, close. */
+static void hexin_file_item_run( const struct _hexin_hasher_ops *ops, const void *param, struct _hexin_file_item *item )
+{
+    int fd = item->fd;
+
+    item->crc  = ops->begin( param );
+    item->size = 0;
+    if ( item->path != NULL ) {
+#if defined( _WIN32 ) && ( PY_MAJOR_VERSION >= 3 )
+        fd = _wopen( item->name, _O_RDONLY | _O_BINARY );
+#elif defined( _WIN32 )
+        fd = _open( PyBytes_AS_STRING( item->path ), _O_RDONLY | _O_BINARY );
+#else
+        fd = open( PyBytes_AS_STRING( item->path ), O_RDONLY );
+#endif
+    }
+    item->error = ( fd < 0 ) ? errno : hexin_file_crc( ops, param, fd, &item->crc, &item->size );
+    if ( ( item->path != NULL ) && ( fd >= 0 ) ) {
+        HEXIN_FILE_CLOSE( fd );
+    }
+}
+
+static void hexin_file_item_free( struct _hexin_file_item *item )
+{
+#if defined( _WIN32 ) && ( PY_MAJOR_VERSION >= 3 )
+    PyMem_Free( item->name );
+#endif
+    Py_CLEAR( item->path );
+}
+
+/* OSError( errno, strerror, path ) of a failed item, a new reference. */
+static PyObject *hexin_file_item_error( struct _hexin_file_item *item )
+{
+    return PyObject_CallFunction( PyExc_OSError, "isO", item->error, strerror( item->error ),
+                                  ( item->path != NULL ) ? item->file : Py_None );
+}
+
+PyObject *hexin_file_compute( const struct _hexin_hasher_ops *ops, const void *param, PyObject *file )
+{
+    struct _hexin_file_item item;
+
+    if ( hexin_file_item_init( &item, file ) < 0 ) {
+        hexin_file_item_free( &item );
+        return NULL;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    hexin_file_item_run( ops, param, &item );
+    Py_END_ALLOW_THREADS
+
+    if ( item.error != 0 ) {
+        errno = item.error;
+        PyErr_SetFromErrnoWithFilenameObject( PyExc_OSError, ( item.path != NULL ) ? file : NULL );
+        hexin_file_item_free( &item );
+        return NULL;
+    }
+    hexin_file_item_free( &item );
+    return PyLong_FromUnsignedLongLong( ops->end( param, item.crc ) );
+}
+
+/*
+ * Many files : every worker takes the next file from a shared counter when it is done with its
+ * own, so one large file never holds the others back behind it.
+ */
+struct _hexin_file_pool {
+    const struct _hexin_hasher_ops *ops;
+    const void                     *param;
+    struct _hexin_file_item        *items;
+    size_t                          count;
+    volatile long                   next;
+};
+
+#if defined( _MSC_VER )
+#define                 HEXIN_FILE_NEXT( pool )                 ( ( size_t )InterlockedExchangeAdd( &( pool )->next, 1 ) )
+#else
+#define                 HEXIN_FILE_NEXT( pool )                 ( ( size_t )__sync_fetch_and_add( &( pool )->next, 1 ) )
+#endif
+
+static void hexin_file_pool_work( struct _hexin_file_pool *pool )
+{
+    size_t i = 0;
+
+    while ( ( i = HEXIN_FILE_NEXT( pool ) ) < pool->count ) {
+        hexin_file_item_run( pool->ops, pool->param, &pool->items[i] );
+    }
+}
+
+#if defined( _WIN32 )
+static unsigned __stdcall hexin_file_pool_thread( void *arg )
+{
+    hexin_file_pool_work( ( struct _hexin_file_pool * )arg );
+    return 0;
+}
+#else
+static void *hexin_file_pool_thread( void *arg )
+{
+    hexin_file_pool_work( ( struct _hexin_file_pool * )arg );
+    return NULL;
+}
+#endif
+
+static void hexin_file_pool_run( struct _hexin_file_pool *pool, unsigned int threads )
+{
+    unsigned int started[HEXIN_PARALLEL_MAX_THREADS] = { 0 };
+    unsigned int i = 0;
+#if defined( _WIN32 )
+    HANDLE handles[HEXIN_PARALLEL_MAX_THREADS];
+#else
+    pthread_t handles[HEXIN_PARALLEL_MAX_THREADS];
+#endif
+
+    /* The caller is one of the workers, a thread that does not start leaves its share to the others. */
+    for ( i=1; i<threads; i++ ) {
+#if defined( _WIN32 )
+        handles[i] = ( HANDLE )_beginthreadex( NULL, 0, hexin_file_pool_thread, pool, 0, NULL );
+        started[i] = ( handles[i] != 0 );
+#else
+        started[i] = ( 0 == pthread_create( &handles[i], NULL, hexin_file_pool_thread, pool ) );
+#endif
+    }
+
+    hexin_file_pool_work( pool );
+
+    for ( i=1; i<threads; i++ ) {
+        if ( !started[i] ) {
+            continue;
+        }
+#if defined( _WIN32 )
+        WaitForSingleObject( handles[i], INFINITE );
+        CloseHandle( handles[i] );
+#else
+        pthread_join( handles[i], NULL );
+#endif
+    }
+}
+
+PyObject *hexin_file_compute_many( const struct _hexin_hasher_ops *ops, const void *param, PyObject *files, unsigned int threads )
+{
+    struct _hexin_file_pool pool = { ops, param, NULL, 0, 0 };
+    PyObject *sequence = PySequence_Fast( files, "files must be a sequence of paths or file descriptors" );
+    PyObject *result = NULL, *value = NULL;
+    size_t i = 0, ready = 0;
+
+    if ( sequence == NULL ) {
+        return NULL;
+    }
+    pool.count = ( size_t )PySequence_Fast_GET_SIZE( sequence );
+    pool.items = ( struct _hexin_file_item * )calloc( ( pool.count > 0 ) ? pool.count : 1, sizeof( struct _hexin_file_item ) );
+    if ( pool.items == NULL ) {
+        Py_DECREF( sequence );
+        return PyErr_NoMemory();
+    }
+    for ( ready=0; ready<pool.count; ready++ ) {
+        if ( hexin_file_item_init( &pool.items[ready], PySequence_Fast_GET_ITEM( sequence, ready ) ) < 0 ) {
+            ready++;
+            goto done;
+        }
+    }
+
+    threads = ( threads == 0 ) ? hexin_parallel_cpus() : threads;
+    threads = ( threads > HEXIN_PARALLEL_MAX_THREADS ) ? HEXIN_PARALLEL_MAX_THREADS : threads;
+    threads = ( ( size_t )threads > pool.count ) ? ( unsigned int )pool.count : threads;
+
+    Py_BEGIN_ALLOW_THREADS
+    hexin_file_pool_run( &pool, ( threads > 0 ) ? threads : 1 );
+    Py_END_ALLOW_THREADS
+
+    result = PyList_New( ( Py_ssize_t )pool.count );
+    for ( i=0; ( result != NULL ) && ( i < pool.count ); i++ ) {
+        if ( pool.items[i].error != 0 ) {
+            value = hexin_file_item_error( &pool.items[i] );
+        } else {
+            value = Py_BuildValue( "(KK)", ops->end( param, pool.items[i].crc ), pool.items[i].size );
+        }
+        if ( value == NULL ) {
+            Py_CLEAR( result );
+            break;
+        }
+        PyList_SET_ITEM( result, ( Py_ssize_t )i, value );
+    }
+
+done:
+    for ( i=0; i<ready; i++ ) {
+        hexin_file_item_free( &pool.items[i] );
+    }
+    free( pool.items );
+    Py_DECREF( sequence );
+    return result;
+}
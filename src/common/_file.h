@@ -0,0 +1,31 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2017-2022, Hexin
+*                                           All Rights Reserved
+* File    : _file.h
+* Version : V1.7
+*
+*   The CRC of a file, from its current position to the end, without the GIL. A regular file is
+*   mapped and read ahead sequentially ( MADV_SEQUENTIAL ), anything else ( pipes, sockets, a
+*   failed mmap ) is read by a helper thread into two buffers while the other one is computed.
+*
+*********************************************************************************************************
+*/
+
+#ifndef __HEXIN_FILE_H__
+#define __HEXIN_FILE_H__
+
+#include "_hasher.h"
+
+#define                 HEXIN_FILE_BUFFER                       ( 1U << 20 )    /* One read() of the helper thread */
+
+/* file : a path ( str, bytes, os.PathLike ), opened and closed here, or a file descriptor, left open at the end. */
+PyObject *hexin_file_compute( const struct _hexin_hasher_ops *ops, const void *param, PyObject *file );
+
+/*
+ * A list with ( crc, size ) or the OSError of every file, computed by threads ( 0 : every CPU )
+ * without the GIL. A worker takes the next file as soon as it is done with one.
+ */
+PyObject *hexin_file_compute_many( const struct _hexin_hasher_ops *ops, const void *param, PyObject *files, unsigned int threads );
+
+#endif //__HEXIN_FILE_H__
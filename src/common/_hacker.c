@@ -0,0 +1,134 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2017-2022, Hexin
+*                                           All Rights Reserved
+* File    : _hacker.c
+* Version : V1.7
+*
+*********************************************************************************************************
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "_hacker.h"
+
+/* Every caller holds the GIL while it takes or drops an entry, only a free-threaded build needs the lock. */
+#ifdef Py_GIL_DISABLED
+#define                 HEXIN_HACKER_LOCK( cache )              PyThread_acquire_lock( ( cache )->lock, 1 )
+#define                 HEXIN_HACKER_UNLOCK( cache )            PyThread_release_lock( ( cache )->lock )
+#else
+#define                 HEXIN_HACKER_LOCK( cache )
+#define                 HEXIN_HACKER_UNLOCK( cache )
+#endif
+
+int hexin_hacker_ready( struct _hexin_hacker_cache *cache )
+{
+#ifdef Py_GIL_DISABLED
+    if ( cache->lock == NULL ) {
+        cache->lock = PyThread_allocate_lock();
+    }
+    if ( cache->lock == NULL ) {
+        PyErr_NoMemory();
+        return -1;
+    }
+#endif
+    return 0;
+}
+
+static void hexin_hacker_free( struct _hexin_hacker_entry *entry )
+{
+    if ( entry != NULL ) {
+        free( entry->table );
+        free( entry );
+    }
+}
+
+/* Drops one user under the lock, returns the entry to free when it was the last one. */
+static struct _hexin_hacker_entry *hexin_hacker_drop( struct _hexin_hacker_entry *entry )
+{
+    return ( ( entry != NULL ) && ( --entry->users == 0 ) ) ? entry : NULL;
+}
+
+/* Index of ( poly, type ) in the cache, -1 when it is not there. */
+static int hexin_hacker_find( const struct _hexin_hacker_cache *cache, unsigned long long poly, unsigned int type )
+{
+    unsigned int i = 0;
+
+    for ( i = 0; i < cache->count; i++ ) {
+        if ( ( cache->entries[i]->poly == poly ) && ( cache->entries[i]->type == type ) ) {
+            return ( int )i;
+        }
+    }
+    return -1;
+}
+
+/* Moves entries[index] to the front and puts entry there, returns the entry it replaced. */
+static struct _hexin_hacker_entry *hexin_hacker_front( struct _hexin_hacker_cache *cache, int index,
+                                                       struct _hexin_hacker_entry *entry )
+{
+    struct _hexin_hacker_entry *replaced = NULL;
+
+    if ( index < 0 ) {
+        if ( cache->count < HEXIN_HACKER_CACHE_SIZE ) {
+            index = ( int )cache->count++;
+        } else {
+            index = HEXIN_HACKER_CACHE_SIZE - 1;
+            replaced = cache->entries[index];
+        }
+    } else if ( cache->entries[index] != entry ) {
+        replaced = cache->entries[index];
+    }
+    memmove( &cache->entries[1], &cache->entries[0], ( size_t )index * sizeof( cache->entries[0] ) );
+    cache->entries[0] = entry;
+    return replaced;
+}
+
+struct _hexin_hacker_entry *hexin_hacker_acquire( struct _hexin_hacker_cache *cache, void *param,
+                                                  unsigned long long poly, unsigned int type, unsigned int reinit )
+{
+    struct _hexin_hacker_entry *entry = NULL, *stale = NULL;
+    int index = -1;
+
+    HEXIN_HACKER_LOCK( cache );
+    index = hexin_hacker_find( cache, poly, type );
+    if ( ( index >= 0 ) && ( reinit == FALSE ) ) {
+        entry = cache->entries[index];
+        hexin_hacker_front( cache, index, entry );
+        entry->users++;
+        HEXIN_HACKER_UNLOCK( cache );
+        return entry;
+    }
+    HEXIN_HACKER_UNLOCK( cache );
+
+    /* Built without the lock, another call may build the same tables meanwhile. */
+    entry = ( struct _hexin_hacker_entry * )calloc( 1, sizeof( struct _hexin_hacker_entry ) );
+    if ( entry != NULL ) {
+        entry->table = malloc( cache->size );
+    }
+    if ( ( entry == NULL ) || ( entry->table == NULL ) ) {
+        hexin_hacker_free( entry );
+        PyErr_NoMemory();
+        return NULL;
+    }
+    entry->poly  = poly;
+    entry->type  = cache->init( param, entry->table, &entry->clmul );
+    entry->users = 2;
+
+    HEXIN_HACKER_LOCK( cache );
+    stale = hexin_hacker_drop( hexin_hacker_front( cache, hexin_hacker_find( cache, poly, type ), entry ) );
+    HEXIN_HACKER_UNLOCK( cache );
+
+    hexin_hacker_free( stale );
+    return entry;
+}
+
+void hexin_hacker_release( struct _hexin_hacker_cache *cache, struct _hexin_hacker_entry *entry )
+{
+    struct _hexin_hacker_entry *stale = NULL;
+
+    HEXIN_HACKER_LOCK( cache );
+    stale = hexin_hacker_drop( entry );
+    HEXIN_HACKER_UNLOCK( cache );
+
+    hexin_hacker_free( stale );
+}
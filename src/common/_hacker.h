@@ -0,0 +1,55 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2017-2022, Hexin
+*                                           All Rights Reserved
+* File    : _hacker.h
+* Version : V1.7
+*
+*   Tables of the hacker functions. A call builds the tables of its ( poly, orientation ) once, the
+*   next calls with the same key share them. An entry is never written after it is built and is
+*   freed by the last call that uses it, so calls run in parallel with or without the GIL.
+*
+*   Every family has its own cache, the width is fixed by the cache. The cache keeps the
+*   HEXIN_HACKER_CACHE_SIZE keys used last, so rotating between models costs a lookup.
+*
+*********************************************************************************************************
+*/
+
+#ifndef __HEXIN_HACKER_H__
+#define __HEXIN_HACKER_H__
+
+#include <Python.h>
+#include "pythread.h"
+#include "_clmulfold.h"
+
+#ifndef HEXIN_HACKER_CACHE_SIZE
+#define                 HEXIN_HACKER_CACHE_SIZE                 32      /* Keys kept per family, least recently used goes first */
+#endif
+
+/* init( param, table, clmul ) : the compute_init_table() of the family, returns is_initial. */
+typedef unsigned int ( *hexin_hacker_init_t )( void *param, void *table, struct _hexin_clmul *clmul );
+
+struct _hexin_hacker_entry {
+    unsigned long long   poly;
+    unsigned int         type;              /* is_initial : HEXIN_TABLE_IS_NORMAL / HEXIN_TABLE_IS_REFLECTED */
+    unsigned int         users;             /* The cache and every call computing with the entry */
+    struct _hexin_clmul  clmul;
+    void                *table;             /* [MAX_SLICING_ARRAY][MAX_TABLE_ARRAY] of the family type */
+};
+
+struct _hexin_hacker_cache {
+    PyThread_type_lock           lock;      /* Created by hexin_hacker_ready() on a free-threaded build */
+    size_t                       size;      /* Bytes of one table */
+    hexin_hacker_init_t          init;
+    unsigned int                 count;
+    struct _hexin_hacker_entry  *entries[HEXIN_HACKER_CACHE_SIZE];  /* Most recently used first */
+};
+
+int hexin_hacker_ready( struct _hexin_hacker_cache *cache );
+
+/* The tables of param ( poly, type ), NULL with an exception set. reinit builds them again. */
+struct _hexin_hacker_entry *hexin_hacker_acquire( struct _hexin_hacker_cache *cache, void *param,
+                                                  unsigned long long poly, unsigned int type, unsigned int reinit );
+void hexin_hacker_release( struct _hexin_hacker_cache *cache, struct _hexin_hacker_entry *entry );
+
+#endif //__HEXIN_HACKER_H__
@@ -0,0 +1,251 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2017-2022, Hexin
+*                                           All Rights Reserved
+* File    : _hasher.c
+* Version : V1.7
+*
+*********************************************************************************************************
+*/
+
+#define PY_SSIZE_T_CLEAN
+#include "_hasher.h"
+#include "pythread.h"
+#include "_dispatch.h"
+
+typedef struct {
+    PyObject_HEAD
+    const struct _hexin_hasher_ops *ops;
+    const void          *param;                 /* The preset, never written */
+    PyObject            *owner;                 /* Holds param when it is not a static preset, or NULL */
+    PyObject            *name;
+    unsigned int         width;
+    unsigned long long   crc;                   /* Raw register of the family */
+    PyThread_type_lock   lock;                  /* Created by the first update() that releases the GIL, at once without a GIL */
+} hexin_hasher_object;
+
+static PyTypeObject hexin_hasher_type;
+
+/* Another thread may be inside update() with the GIL released, wait for it without the GIL. */
+static void hexin_hasher_enter( hexin_hasher_object *self )
+{
+    if ( ( self->lock != NULL ) && !PyThread_acquire_lock( self->lock, 0 ) ) {
+        Py_BEGIN_ALLOW_THREADS
+        PyThread_acquire_lock( self->lock, 1 );
+        Py_END_ALLOW_THREADS
+    }
+}
+
+static void hexin_hasher_leave( hexin_hasher_object *self )
+{
+    if ( self->lock != NULL ) {
+        PyThread_release_lock( self->lock );
+    }
+}
+
+/* A free-threaded interpreter has no GIL to serialize the calls, every hasher takes its lock. */
+static int hexin_hasher_lock( hexin_hasher_object *self )
+{
+    self->lock = NULL;
+#ifdef Py_GIL_DISABLED
+    self->lock = PyThread_allocate_lock();
+    if ( self->lock == NULL ) {
+        PyErr_NoMemory();
+        return -1;
+    }
+#endif
+    return 0;
+}
+
+PyObject *hexin_hasher_new( const struct _hexin_hasher_ops *ops, const void *param, const char *name, unsigned int width, PyObject *owner )
+{
+    hexin_hasher_object *self = PyObject_New( hexin_hasher_object, &hexin_hasher_type );
+
+    if ( self == NULL ) {
+        return NULL;
+    }
+
+    self->ops   = ops;
+    self->param = param;
+    self->owner = owner;
+    self->width = width;
+    self->crc   = ops->begin( param );
+    Py_XINCREF( owner );
+    self->name  = Py_BuildValue( "s", name );
+    if ( ( hexin_hasher_lock( self ) < 0 ) || ( self->name == NULL ) ) {
+        Py_DECREF( self );
+        return NULL;
+    }
+    return ( PyObject * )self;
+}
+
+static void hexin_hasher_dealloc( hexin_hasher_object *self )
+{
+    if ( self->lock != NULL ) {
+        PyThread_free_lock( self->lock );
+    }
+    Py_XDECREF( self->name );
+    Py_XDECREF( self->owner );
+    PyObject_Del( self );
+}
+
+static PyObject *hexin_hasher_update( hexin_hasher_object *self, PyObject *args )
+{
+    Py_buffer data = { NULL, NULL };
+
+#if PY_MAJOR_VERSION >= 3
+    if ( !PyArg_ParseTuple( args, "y*", &data ) ) {
+        return NULL;
+    }
+#else
+    if ( !PyArg_ParseTuple( args, "s*", &data ) ) {
+        return NULL;
+    }
+#endif /* PY_MAJOR_VERSION */
+
+    if ( ( self->lock == NULL ) && ( ( size_t )data.len >= hexin_gil_threshold() ) ) {
+        self->lock = PyThread_allocate_lock();
+    }
+
+    if ( ( self->lock != NULL ) && ( ( size_t )data.len >= hexin_gil_threshold() ) ) {
+        Py_BEGIN_ALLOW_THREADS
+        PyThread_acquire_lock( self->lock, 1 );
+        self->crc = self->ops->update( self->param, self->crc, ( const unsigned char * )data.buf, ( size_t )data.len );
+        PyThread_release_lock( self->lock );
+        Py_END_ALLOW_THREADS
+    } else {
+        hexin_hasher_enter( self );
+        self->crc = self->ops->update( self->param, self->crc, ( const unsigned char * )data.buf, ( size_t )data.len );
+        hexin_hasher_leave( self );
+    }
+
+    PyBuffer_Release( &data );
+    Py_RETURN_NONE;
+}
+
+static unsigned long long hexin_hasher_value( hexin_hasher_object *self )
+{
+    unsigned long long crc = 0;
+
+    hexin_hasher_enter( self );
+    crc = self->crc;
+    hexin_hasher_leave( self );
+    return self->ops->end( self->param, crc );
+}
+
+static PyObject *hexin_hasher_intdigest( hexin_hasher_object *self, PyObject *unused )
+{
+    return PyLong_FromUnsignedLongLong( hexin_hasher_value( self ) );
+}
+
+/* Big-endian, ( width + 7 ) / 8 bytes. */
+static PyObject *hexin_hasher_digest( hexin_hasher_object *self, PyObject *unused )
+{
+    unsigned char digest[8] = { 0 };
+    unsigned long long crc = hexin_hasher_value( self );
+    unsigned int i = 0, size = ( self->width + 7 ) / 8;
+
+    for ( i=0; i<size; i++ ) {
+        digest[size - 1 - i] = ( unsigned char )( crc >> ( 8 * i ) );
+    }
+    return PyBytes_FromStringAndSize( ( const char * )digest, size );
+}
+
+static PyObject *hexin_hasher_hexdigest( hexin_hasher_object *self, PyObject *unused )
+{
+    char hexdigest[17] = { 0 };
+    unsigned long long crc = hexin_hasher_value( self );
+    unsigned int i = 0, size = 2 * ( ( self->width + 7 ) / 8 );
+
+    for ( i=0; i<size; i++ ) {
+        hexdigest[size - 1 - i] = "0123456789abcdef"[( crc >> ( 4 * i ) ) & 0x0F];
+    }
+    return Py_BuildValue( "s", hexdigest );
+}
+
+static PyObject *hexin_hasher_copy( hexin_hasher_object *self, PyObject *unused )
+{
+    hexin_hasher_object *clone = PyObject_New( hexin_hasher_object, &hexin_hasher_type );
+
+    if ( clone == NULL ) {
+        return NULL;
+    }
+
+    clone->ops   = self->ops;
+    clone->param = self->param;
+    clone->owner = self->owner;
+    clone->width = self->width;
+    clone->name  = self->name;
+    Py_INCREF( clone->name );
+    Py_XINCREF( clone->owner );
+    if ( hexin_hasher_lock( clone ) < 0 ) {
+        Py_DECREF( clone );
+        return NULL;
+    }
+
+    hexin_hasher_enter( self );
+    clone->crc = self->crc;
+    hexin_hasher_leave( self );
+    return ( PyObject * )clone;
+}
+
+static PyObject *hexin_hasher_get_name( hexin_hasher_object *self, void *closure )
+{
+    Py_INCREF( self->name );
+    return self->name;
+}
+
+static PyObject *hexin_hasher_get_digest_size( hexin_hasher_object *self, void *closure )
+{
+    return Py_BuildValue( "I", ( self->width + 7 ) / 8 );
+}
+
+static PyObject *hexin_hasher_get_block_size( hexin_hasher_object *self, void *closure )
+{
+    return Py_BuildValue( "I", 1 );
+}
+
+static PyObject *hexin_hasher_get_width( hexin_hasher_object *self, void *closure )
+{
+    return Py_BuildValue( "I", self->width );
+}
+
+static PyMethodDef hexin_hasher_methods[] = {
+    { "update",     (PyCFunction)hexin_hasher_update,    METH_VARARGS, "Feed the bytes-like object to the CRC" },
+    { "digest",     (PyCFunction)hexin_hasher_digest,    METH_NOARGS,  "The CRC as big-endian bytes" },
+    { "hexdigest",  (PyCFunction)hexin_hasher_hexdigest, METH_NOARGS,  "The CRC as a string of hexadecimal digits" },
+    { "intdigest",  (PyCFunction)hexin_hasher_intdigest, METH_NOARGS,  "The CRC as an integer, the value the preset function returns" },
+    { "copy",       (PyCFunction)hexin_hasher_copy,      METH_NOARGS,  "A copy of the hasher, the register only is copied" },
+    { NULL, NULL, 0, NULL }        /* Sentinel */
+};
+
+static PyGetSetDef hexin_hasher_getset[] = {
+    { "name",        (getter)hexin_hasher_get_name,        NULL, "The preset name",                NULL },
+    { "digest_size", (getter)hexin_hasher_get_digest_size, NULL, "The size of digest() in bytes",  NULL },
+    { "block_size",  (getter)hexin_hasher_get_block_size,  NULL, "The CRC takes single bytes",     NULL },
+    { "width",       (getter)hexin_hasher_get_width,       NULL, "The CRC width in bits",          NULL },
+    { NULL, NULL, NULL, NULL, NULL }
+};
+
+static PyTypeObject hexin_hasher_type = {
+    PyVarObject_HEAD_INIT( NULL, 0 )
+    "libscrc.hasher",                           /* tp_name */
+    sizeof( hexin_hasher_object ),              /* tp_basicsize */
+    0,                                          /* tp_itemsize */
+    (destructor)hexin_hasher_dealloc,           /* tp_dealloc */
+};
+
+int hexin_hasher_ready( PyObject *module )
+{
+    hexin_hasher_type.tp_flags   = Py_TPFLAGS_DEFAULT;
+    hexin_hasher_type.tp_doc     = "hashlib-style CRC of a named preset, see libscrc.new()";
+    hexin_hasher_type.tp_methods = hexin_hasher_methods;
+    hexin_hasher_type.tp_getset  = hexin_hasher_getset;
+
+    if ( PyType_Ready( &hexin_hasher_type ) < 0 ) {
+        return -1;
+    }
+
+    Py_INCREF( &hexin_hasher_type );
+    return PyModule_AddObject( module, "_hasher", ( PyObject * )&hexin_hasher_type );
+}
@@ -0,0 +1,31 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2017-2022, Hexin
+*                                           All Rights Reserved
+* File    : _hasher.h
+* Version : V1.7
+*
+*   hashlib-style object of a named preset : update() / digest() / hexdigest() / intdigest() / copy().
+*   The object keeps the raw register of the family, so update() runs the kernel only and the
+*   refout / xorout fix-up is applied once, by the digest.
+*
+*********************************************************************************************************
+*/
+
+#ifndef __HEXIN_HASHER_H__
+#define __HEXIN_HASHER_H__
+
+#include <Python.h>
+#include <stddef.h>
+
+struct _hexin_hasher_ops {
+    unsigned long long ( *begin  )( const void *param );
+    unsigned long long ( *update )( const void *param, unsigned long long crc, const unsigned char *pSrc, size_t len );
+    unsigned long long ( *end    )( const void *param, unsigned long long crc );
+};
+
+int       hexin_hasher_ready( PyObject *module );
+/* owner : the object param belongs to, kept alive by the hasher ( NULL for a static preset ). */
+PyObject *hexin_hasher_new( const struct _hexin_hasher_ops *ops, const void *param, const char *name, unsigned int width, PyObject *owner );
+
+#endif //__HEXIN_HASHER_H__
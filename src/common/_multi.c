@@ -0,0 +1,131 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2017-2022, Hexin
+*                                           All Rights Reserved
+* File    : _multi.c
+* Version : V1.7
+*
+*********************************************************************************************************
+*/
+
+#define PY_SSIZE_T_CLEAN
+#include "_multi.h"
+#include "_dispatch.h"
+
+struct _hexin_multi_kernel {
+    const struct _hexin_hasher_ops *ops;
+    const void                     *param;
+    PyObject                       *owner;
+};
+
+static void hexin_multi_capsule_free( PyObject *capsule )
+{
+    struct _hexin_multi_kernel *kernel = ( struct _hexin_multi_kernel * )PyCapsule_GetPointer( capsule, HEXIN_MULTI_CAPSULE );
+
+    if ( kernel != NULL ) {
+        Py_XDECREF( kernel->owner );
+        PyMem_Free( kernel );
+    }
+}
+
+PyObject *hexin_multi_capsule( const struct _hexin_hasher_ops *ops, const void *param, PyObject *owner )
+{
+    struct _hexin_multi_kernel *kernel = ( struct _hexin_multi_kernel * )PyMem_Malloc( sizeof( struct _hexin_multi_kernel ) );
+    PyObject *capsule = NULL;
+
+    if ( kernel == NULL ) {
+        return PyErr_NoMemory();
+    }
+    kernel->ops   = ops;
+    kernel->param = param;
+    kernel->owner = owner;
+    capsule = PyCapsule_New( kernel, HEXIN_MULTI_CAPSULE, hexin_multi_capsule_free );
+    if ( capsule == NULL ) {
+        PyMem_Free( kernel );
+        return NULL;
+    }
+    Py_XINCREF( owner );
+    return capsule;
+}
+
+/* Without the GIL : block by block, every kernel goes over the block before the next one is read. */
+static void hexin_multi_run( struct _hexin_multi_kernel **kernels, unsigned long long *crcs, Py_ssize_t count,
+                             const unsigned char *pSrc, size_t len )
+{
+    size_t offset = 0, block = 0;
+    Py_ssize_t i = 0;
+
+    for ( i=0; i<count; i++ ) {
+        crcs[i] = kernels[i]->ops->begin( kernels[i]->param );
+    }
+    for ( offset=0; offset<len; offset+=block ) {
+        block = ( len - offset < HEXIN_MULTI_BLOCK ) ? ( len - offset ) : HEXIN_MULTI_BLOCK;
+        for ( i=0; i<count; i++ ) {
+            crcs[i] = kernels[i]->ops->update( kernels[i]->param, crcs[i], pSrc + offset, block );
+        }
+    }
+    for ( i=0; i<count; i++ ) {
+        crcs[i] = kernels[i]->ops->end( kernels[i]->param, crcs[i] );
+    }
+}
+
+PyObject *hexin_multi_compute( PyObject *self, PyObject *args )
+{
+    Py_buffer data = { NULL, NULL };
+    PyObject *capsules = NULL, *sequence = NULL, *result = NULL, *value = NULL;
+    struct _hexin_multi_kernel **kernels = NULL;
+    unsigned long long *crcs = NULL;
+    Py_ssize_t i = 0, count = 0;
+
+#if PY_MAJOR_VERSION >= 3
+    if ( !PyArg_ParseTuple( args, "y*O", &data, &capsules ) ) {
+#else
+    if ( !PyArg_ParseTuple( args, "s*O", &data, &capsules ) ) {
+#endif /* PY_MAJOR_VERSION */
+        return NULL;
+    }
+
+    sequence = PySequence_Fast( capsules, "kernels must be a sequence" );
+    if ( sequence == NULL ) {
+        goto done;
+    }
+    count   = PySequence_Fast_GET_SIZE( sequence );
+    kernels = ( struct _hexin_multi_kernel ** )PyMem_Malloc( ( count + 1 ) * sizeof( struct _hexin_multi_kernel * ) );
+    crcs    = ( unsigned long long * )PyMem_Malloc( ( count + 1 ) * sizeof( unsigned long long ) );
+    if ( ( kernels == NULL ) || ( crcs == NULL ) ) {
+        PyErr_NoMemory();
+        goto done;
+    }
+    for ( i=0; i<count; i++ ) {
+        kernels[i] = ( struct _hexin_multi_kernel * )PyCapsule_GetPointer( PySequence_Fast_GET_ITEM( sequence, i ), HEXIN_MULTI_CAPSULE );
+        if ( kernels[i] == NULL ) {
+            goto done;
+        }
+    }
+
+    /* The capsules are held by sequence, so is every owner. */
+    if ( ( size_t )data.len >= hexin_gil_threshold() ) {
+        Py_BEGIN_ALLOW_THREADS
+        hexin_multi_run( kernels, crcs, count, ( const unsigned char * )data.buf, ( size_t )data.len );
+        Py_END_ALLOW_THREADS
+    } else {
+        hexin_multi_run( kernels, crcs, count, ( const unsigned char * )data.buf, ( size_t )data.len );
+    }
+
+    result = PyTuple_New( count );
+    for ( i=0; ( result != NULL ) && ( i < count ); i++ ) {
+        value = PyLong_FromUnsignedLongLong( crcs[i] );
+        if ( value == NULL ) {
+            Py_CLEAR( result );
+            break;
+        }
+        PyTuple_SET_ITEM( result, i, value );
+    }
+
+done:
+    PyMem_Free( kernels );
+    PyMem_Free( crcs );
+    Py_XDECREF( sequence );
+    PyBuffer_Release( &data );
+    return result;
+}
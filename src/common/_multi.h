@@ -0,0 +1,29 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2017-2022, Hexin
+*                                           All Rights Reserved
+* File    : _multi.h
+* Version : V1.7
+*
+*   Many CRCs of one buffer in a single pass : the buffer is walked in blocks of HEXIN_MULTI_BLOCK
+*   bytes and every block is fed to all the kernels while it is still in L1 / L2. The kernels may
+*   belong to different extension modules, each one hands out its ( ops, param ) in a capsule.
+*
+*********************************************************************************************************
+*/
+
+#ifndef __HEXIN_MULTI_H__
+#define __HEXIN_MULTI_H__
+
+#include "_hasher.h"
+
+#define                 HEXIN_MULTI_BLOCK                       ( 1U << 14 )
+#define                 HEXIN_MULTI_CAPSULE                     "libscrc._capsule"
+
+/* owner : the object param belongs to, kept alive by the capsule ( NULL for a static preset ). */
+PyObject *hexin_multi_capsule( const struct _hexin_hasher_ops *ops, const void *param, PyObject *owner );
+
+/* _multi( data, capsules ) : a tuple with the CRC of data for every capsule. */
+PyObject *hexin_multi_compute( PyObject *self, PyObject *args );
+
+#endif //__HEXIN_MULTI_H__
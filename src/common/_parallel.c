@@ -0,0 +1,143 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2017-2022, Hexin
+*                                           All Rights Reserved
+* File    : _parallel.c
+* Version : V1.7
+*
+*********************************************************************************************************
+*/
+
+#include "_parallel.h"
+
+#if defined( _WIN32 )
+#include <windows.h>
+#include <process.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+struct _hexin_parallel_chunk {
+    const struct _hexin_parallel *job;
+    const unsigned char          *pSrc;
+    size_t                        len;
+    unsigned int                  first;
+    unsigned long long            crc;
+};
+
+unsigned int hexin_parallel_cpus( void )
+{
+#if defined( _WIN32 )
+    SYSTEM_INFO info;
+    GetSystemInfo( &info );
+    return ( info.dwNumberOfProcessors > 0 ) ? ( unsigned int )info.dwNumberOfProcessors : 1;
+#else
+    long cpus = sysconf( _SC_NPROCESSORS_ONLN );
+    return ( cpus > 0 ) ? ( unsigned int )cpus : 1;
+#endif
+}
+
+/*
+ * threads == 0 asks for every online CPU, every thread gets at least HEXIN_PARALLEL_MIN_CHUNK bytes.
+ */
+unsigned int hexin_parallel_threads( size_t len, unsigned int threads )
+{
+    if ( threads == 0 ) {
+        threads = hexin_parallel_cpus();
+    }
+    if ( threads > HEXIN_PARALLEL_MAX_THREADS ) {
+        threads = HEXIN_PARALLEL_MAX_THREADS;
+    }
+    if ( threads > len / HEXIN_PARALLEL_MIN_CHUNK ) {
+        threads = ( unsigned int )( len / HEXIN_PARALLEL_MIN_CHUNK );
+    }
+    return ( threads > 0 ) ? threads : 1;
+}
+
+static void hexin_parallel_chunk( struct _hexin_parallel_chunk *chunk )
+{
+    const struct _hexin_parallel *job = chunk->job;
+
+    chunk->crc = chunk->first ? job->compute( job->first, chunk->pSrc, chunk->len, job->init )
+                              : job->compute( job->rest,  chunk->pSrc, chunk->len, job->reinit );
+}
+
+#if defined( _WIN32 )
+static unsigned __stdcall hexin_parallel_thread( void *arg )
+{
+    hexin_parallel_chunk( ( struct _hexin_parallel_chunk * )arg );
+    return 0;
+}
+#else
+static void *hexin_parallel_thread( void *arg )
+{
+    hexin_parallel_chunk( ( struct _hexin_parallel_chunk * )arg );
+    return NULL;
+}
+#endif
+
+unsigned long long hexin_parallel_compute( const struct _hexin_parallel *job, const unsigned char *pSrc, size_t len, unsigned int threads )
+{
+    struct _hexin_parallel_chunk chunks[HEXIN_PARALLEL_MAX_THREADS];
+    struct _hexin_combine local;
+    const struct _hexin_combine *combine = job->combine;
+    unsigned int started[HEXIN_PARALLEL_MAX_THREADS] = { 0 };
+    unsigned long long empty = 0, crc = 0;
+    size_t size = 0, offset = 0;
+    unsigned int i = 0;
+#if defined( _WIN32 )
+    HANDLE handles[HEXIN_PARALLEL_MAX_THREADS];
+#else
+    pthread_t handles[HEXIN_PARALLEL_MAX_THREADS];
+#endif
+
+    threads = hexin_parallel_threads( len, threads );
+    if ( combine == NULL ) {
+        hexin_combine_init( &local, job->width, job->poly );
+        combine = &local;
+    }
+    empty = job->compute( job->rest, pSrc, 0, job->reinit );
+
+    /* Chunks start on a page boundary, the last one takes the remainder. */
+    size = ( ( len / threads ) + 4095 ) & ~( size_t )4095;
+    for ( i=0; i<threads; i++ ) {
+        chunks[i].job     = job;
+        chunks[i].pSrc    = pSrc + offset;
+        chunks[i].len     = ( ( len - offset ) > size ) && ( i + 1 < threads ) ? size : ( len - offset );
+        chunks[i].first   = ( i == 0 );
+        chunks[i].crc     = 0;
+        offset += chunks[i].len;
+    }
+
+    /* The caller computes the first chunk, a thread that does not start is computed here as well. */
+    for ( i=1; i<threads; i++ ) {
+#if defined( _WIN32 )
+        handles[i] = ( HANDLE )_beginthreadex( NULL, 0, hexin_parallel_thread, &chunks[i], 0, NULL );
+        started[i] = ( handles[i] != 0 );
+#else
+        started[i] = ( 0 == pthread_create( &handles[i], NULL, hexin_parallel_thread, &chunks[i] ) );
+#endif
+    }
+
+    hexin_parallel_chunk( &chunks[0] );
+
+    for ( i=1; i<threads; i++ ) {
+        if ( !started[i] ) {
+            hexin_parallel_chunk( &chunks[i] );
+            continue;
+        }
+#if defined( _WIN32 )
+        WaitForSingleObject( handles[i], INFINITE );
+        CloseHandle( handles[i] );
+#else
+        pthread_join( handles[i], NULL );
+#endif
+    }
+
+    crc = chunks[0].crc;
+    for ( i=1; i<threads; i++ ) {
+        crc = hexin_combine( combine, job->refout, crc, chunks[i].crc, chunks[i].len, empty );
+    }
+    return crc;
+}
@@ -0,0 +1,47 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2017-2022, Hexin
+*                                           All Rights Reserved
+* File    : _parallel.h
+* Version : V1.7
+*
+*   Split one buffer into a chunk per thread, compute the chunks on native threads ( the caller
+*   holds no GIL ) and merge them with hexin_combine(). The first chunk keeps the caller's register,
+*   so a gradual calculation continues exactly as the serial compute does.
+*   The threads are started per call rather than kept in a pool : every chunk is at least
+*   HEXIN_PARALLEL_MIN_CHUNK bytes, so starting a thread costs far less than its chunk, and no idle
+*   thread is left behind across fork() or interpreter shutdown.
+*
+*********************************************************************************************************
+*/
+
+#ifndef __HEXIN_PARALLEL_H__
+#define __HEXIN_PARALLEL_H__
+
+#include <stddef.h>
+#include "_combine.h"
+
+#define                 HEXIN_PARALLEL_MAX_THREADS              64
+#define                 HEXIN_PARALLEL_MIN_CHUNK                ( 1U << 20 )    /* Smaller chunks cost more to start than to compute */
+
+/* compute( param, pSrc, len, init ) : the CRC of one slice, param and init as the family compute takes them. */
+typedef unsigned long long ( *hexin_parallel_compute_t )( const void *param, const unsigned char *pSrc, size_t len, unsigned long long init );
+
+struct _hexin_parallel {
+    hexin_parallel_compute_t compute;
+    const void              *first;         /* Preset of the first chunk, may continue a gradual calculation */
+    const void              *rest;          /* Preset of the other chunks, is_gradual == FALSE */
+    unsigned long long       init;          /* Register of the first chunk */
+    unsigned long long       reinit;        /* Register of the other chunks ( the preset init ) */
+    const struct _hexin_combine *combine;   /* NULL : built from width and poly */
+    unsigned int             width;
+    unsigned long long       poly;
+    unsigned int             refout;
+};
+
+unsigned int hexin_parallel_cpus( void );
+unsigned int hexin_parallel_threads( size_t len, unsigned int threads );
+
+unsigned long long hexin_parallel_compute( const struct _hexin_parallel *job, const unsigned char *pSrc, size_t len, unsigned int threads );
+
+#endif //__HEXIN_PARALLEL_H__
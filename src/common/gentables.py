@@ -0,0 +1,229 @@
+# -*- coding:utf-8 -*-
+""" Build-time generator of the preset CRC tables. """
+# !/usr/bin/python
+# Python:   3.5.2+
+# Platform: Windows/Linux/MacOS/ARMv7
+# Program:  Emit the slicing tables and folding constants of every named preset as static const data.
+#
+# A module refers to its tables by name, the name carries the width, the polynomial and the orientation :
+#
+#   .table  = hexin_crc16_table_8005_reflected,     /* refin == refout == TRUE  */
+#   .table  = hexin_crc5_table_05_normal,           /* MSB-first table          */
+#   .clmul  = &hexin_crc16_clmul_8005,              /* carry-less folding keys  */
+#   .combine= &hexin_crc16_combine_8005             /* x^( 8 * 2^k ) mod P(x)   */
+#
+# generate() collects those names from the module source, checks them against the preset parameters
+# and writes _<family>presets.h, which only the module includes.
+
+import os
+import re
+
+MAX_TABLE_ARRAY   = 256
+MAX_SLICING_ARRAY = 16
+
+# family : ( element type, register width of the table, digits per value )
+FAMILIES = {
+    'crcx'  : ( 'unsigned short',     16, 4  ),
+    'canx'  : ( 'unsigned int',       32, 8  ),
+    'crc8'  : ( 'unsigned char',      8,  2  ),
+    'crc16' : ( 'unsigned short',     16, 4  ),
+    'crc24' : ( 'unsigned int',       24, 6  ),
+    'crc32' : ( 'unsigned int',       32, 8  ),
+    'crc64' : ( 'unsigned long long', 64, 16 ),
+}
+
+NAME_PATTERN   = re.compile( r'\bhexin_crc(\d+)_(table|clmul|combine)_([0-9A-F]+)(?:_(normal|reflected))?\b' )
+PRESET_PATTERN = re.compile( r'static\s+(?:const\s+)?struct\s+_hexin_\w+\s+(\w+)\s*=\s*\{\s*(\.is_initial.*?)\};', re.S )
+FIELD_PATTERN  = re.compile( r'\.(\w+)\s*=\s*&?\s*(\w+)' )
+DEFINE_PATTERN = re.compile( r'^#define\s+(\w+)\s+(0[xX][0-9A-Fa-f]+|\d+)[uUlL]*\s', re.M )
+
+
+def reverse( value, width ):
+    return int( '{:0{}b}'.format( value, width )[::-1], 2 )
+
+
+def crc_table( poly, width, reflected ):
+    """ table[k][i] is the CRC of byte i followed by k zero bytes, the polynomial is left-aligned on width. """
+    mask  = ( 1 << width ) - 1
+    table = [ [ 0 ] * MAX_TABLE_ARRAY for _ in range( MAX_SLICING_ARRAY ) ]
+
+    if reflected:
+        rpoly = reverse( poly, width )
+        for i in range( MAX_TABLE_ARRAY ):
+            crc = i
+            for _ in range( 8 ):
+                crc = ( crc >> 1 ) ^ rpoly if crc & 1 else crc >> 1
+            table[0][i] = crc
+        step = lambda crc: ( crc >> 8 ) ^ table[0][crc & 0xFF]
+    else:
+        top = 1 << ( width - 1 )
+        for i in range( MAX_TABLE_ARRAY ):
+            crc = i << ( width - 8 )
+            for _ in range( 8 ):
+                crc = ( ( crc << 1 ) ^ poly if crc & top else crc << 1 ) & mask
+            table[0][i] = crc
+        step = lambda crc: ( ( crc << 8 ) & mask ) ^ table[0][crc >> ( width - 8 )]
+
+    for i in range( MAX_TABLE_ARRAY ):
+        crc = table[0][i]
+        for k in range( 1, MAX_SLICING_ARRAY ):
+            crc = step( crc )
+            table[k][i] = crc
+    return table
+
+
+def clmul_xpow( n, poly ):
+    """ x^n mod P(x), P(x) = x^64 + poly """
+    if n < 64:
+        return 1 << n
+    r = 1 << 63
+    for _ in range( n - 63 ):
+        r = ( ( r << 1 ) ^ poly ) & 0xFFFFFFFFFFFFFFFF if r >> 63 else r << 1
+    return r
+
+
+def clmul_mu( poly ):
+    """ floor( x^128 / P(x) ), the implicit x^64 term is dropped """
+    q, rem = 0, ( 1 << 128 )
+    full = ( 1 << 64 ) | poly
+    for i in range( 64, -1, -1 ):
+        if rem >> ( i + 64 ) & 1:
+            q   |= 1 << i
+            rem ^= full << i
+    return q & 0xFFFFFFFFFFFFFFFF
+
+
+def clmul_keys( poly ):
+    """ The same layout as struct _hexin_clmul, see hexin_clmul_init() """
+    folds   = ( 2048, 512, 384, 256, 128 )
+    normal  = [ ( clmul_xpow( n, poly ), clmul_xpow( n + 64, poly ) ) for n in folds ]
+    reflect = [ ( reverse( clmul_xpow( n + 63, poly ), 64 ), reverse( clmul_xpow( n - 1, poly ), 64 ) ) for n in folds ]
+    mu      = clmul_mu( poly )
+    return ( normal, mu, poly ), ( reflect, reverse( mu, 64 ), reverse( poly, 64 ) )
+
+
+def combine_powers( poly, width ):
+    """ x^( 8 * 2^k ) mod P(x) for k = 0 ... 63, see hexin_combine_init() """
+    mask, top = ( 1 << width ) - 1, 1 << ( width - 1 )
+
+    def multiply( a, b ):
+        result = 0
+        for i in range( width ):
+            result = ( ( result << 1 ) ^ poly ) & mask if result & top else ( result << 1 ) & mask
+            if b & ( top >> i ):
+                result ^= a
+        return result
+
+    power = 1
+    for _ in range( 8 ):
+        power = ( ( power << 1 ) ^ poly ) & mask if power & top else ( power << 1 ) & mask
+    powers = [ power ]
+    for _ in range( 63 ):
+        powers.append( multiply( powers[-1], powers[-1] ) )
+    return powers
+
+
+def parse_defines( *paths ):
+    defines = { 'TRUE' : 1, 'FALSE' : 0 }
+    for path in paths:
+        with open( path ) as f:
+            for name, value in DEFINE_PATTERN.findall( f.read() ):
+                defines[name] = int( value, 0 )
+    return defines
+
+
+def check_presets( family, source, defines ):
+    """ Every named preset must point to the tables of its own width, polynomial and orientation. """
+    width = FAMILIES[family][1]
+    for preset, body in PRESET_PATTERN.findall( source ):
+        fields = dict( FIELD_PATTERN.findall( body ) )
+        value  = lambda key: defines[fields[key]] if fields[key] in defines else int( fields[key].rstrip( 'uUlL' ), 0 )
+        if value( 'is_initial' ) == 0:
+            continue                    # hackerN() builds its own tables at run time
+        if 'table' not in fields or 'clmul' not in fields or 'combine' not in fields:
+            raise ValueError( '{0} : preset without tables'.format( preset ) )
+        reflected = ( value( 'refin' ) == 1 ) and ( value( 'refout' ) == 1 )
+        expected  = 'hexin_crc{0}_table_{1:0{2}X}_{3}'.format( value( 'width' ), value( 'poly' ), ( value( 'width' ) + 3 ) // 4,
+                                                             'reflected' if reflected else 'normal' )
+        if fields['table'] != expected or fields['clmul'] != expected.replace( '_table_', '_clmul_' ).rsplit( '_', 1 )[0] \
+                                       or fields['combine'] != expected.replace( '_table_', '_combine_' ).rsplit( '_', 1 )[0]:
+            raise ValueError( '{0} : expected {1}'.format( preset, expected ) )
+        if value( 'is_initial' ) != ( defines['HEXIN_TABLE_IS_REFLECTED'] if reflected else defines['HEXIN_TABLE_IS_NORMAL'] ):
+            raise ValueError( '{0} : is_initial does not match the table orientation'.format( preset ) )
+        if value( 'width' ) > width:
+            raise ValueError( '{0} : width is larger than {1}'.format( preset, family ) )
+
+
+def format_array( values, digits, suffix ):
+    per_line = 4 if digits > 8 else 8
+    lines = []
+    for i in range( 0, len( values ), per_line ):
+        lines.append( '        ' + ', '.join( '0x{0:0{1}X}{2}'.format( v, digits, suffix ) for v in values[i:i+per_line] ) )
+    return ',\n'.join( lines )
+
+
+def render( family, names ):
+    ctype, width, digits = FAMILIES[family]
+    suffix = 'ULL' if width == 64 else ( 'U' if width > 16 else '' )
+    guard  = '__{0}_PRESETS_H__'.format( family.upper() )
+    out = [ '/*',
+            ' * _{0}presets.h : generated by src/common/gentables.py at build time, do not edit.'.format( family ),
+            ' */',
+            '',
+            '#ifndef {0}'.format( guard ),
+            '#define {0}'.format( guard ),
+            '' ]
+
+    for bits, kind, poly, orientation in sorted( names ):
+        crcwidth = int( bits )
+        aligned  = int( poly, 16 ) << ( width - crcwidth )
+        if kind == 'table':
+            table = crc_table( aligned, width, orientation == 'reflected' )
+            out.append( 'static const {0} hexin_crc{1}_table_{2}_{3}[MAX_SLICING_ARRAY][MAX_TABLE_ARRAY] = {{'.format( ctype, bits, poly, orientation ) )
+            out.append( ',\n'.join( '    {\n' + format_array( row, digits, suffix ) + ' }' for row in table ) )
+        elif kind == 'combine':
+            out.append( 'static const struct _hexin_combine hexin_crc{0}_combine_{1} = {{'.format( bits, poly ) )
+            out.append( '    {0}, 0x{1}ULL,'.format( crcwidth, poly ) )
+            out.append( '    {\n' + format_array( combine_powers( int( poly, 16 ), crcwidth ), len( poly ), 'ULL' ) + ' }' )
+        else:
+            out.append( 'static const struct _hexin_clmul hexin_crc{0}_clmul_{1} = {{'.format( bits, poly ) )
+            rows = []
+            for folds, mu, p in clmul_keys( aligned << ( 64 - width ) ):
+                keys = [ '{{ 0x{0:016X}ULL, 0x{1:016X}ULL }}'.format( lo, hi ) for lo, hi in folds ]
+                rows.append( '    {{ {0},\n      0x{1:016X}ULL, 0x{2:016X}ULL }}'.format( ',\n      '.join( keys ), mu, p ) )
+            out.append( ',\n'.join( rows ) )
+        out.append( '};' )
+        out.append( '' )
+
+    out.append( '#endif //{0}'.format( guard ) )
+    return '\n'.join( out ) + '\n'
+
+
+def generate( family, srcdir, target ):
+    """ Write _<family>presets.h into target, the file is left alone when its content does not change. """
+    module  = os.path.join( srcdir, family, '_{0}module.c'.format( family ) )
+    header  = os.path.join( srcdir, family, '_{0}tables.h'.format( family ) )
+    with open( module ) as f:
+        source = f.read()
+
+    check_presets( family, source, parse_defines( header ) )
+
+    content = render( family, set( NAME_PATTERN.findall( source ) ) )
+    path    = os.path.join( target, '_{0}presets.h'.format( family ) )
+    if os.path.exists( path ):
+        with open( path ) as f:
+            if f.read() == content:
+                return path
+
+    if not os.path.isdir( target ):
+        os.makedirs( target )
+    with open( path, 'w' ) as f:
+        f.write( content )
+    return path
+
+
+if __name__ == '__main__':
+    import sys
+    here = os.path.dirname( os.path.dirname( os.path.abspath( __file__ ) ) )
+    for name in ( sys.argv[2:] or sorted( FAMILIES ) ):
+        print( generate( name, here, sys.argv[1] if len( sys.argv ) > 1 else '.' ) )
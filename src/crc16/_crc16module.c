@@ -36,34 +36,42 @@
 
 #define PY_SSIZE_T_CLEAN
 #include <Python.h>
+#include <string.h>
 #include "_crc16tables.h"
-
-static unsigned char hexin_PyArg_ParseTuple( PyObject *self, PyObject *args,
+#include "_crc16presets.h"
+#include "_hasher.h"
+#include "_batch.h"
+#include "_file.h"
+#include "_multi.h"
+#include "_fastcall.h"
+#include "_hacker.h"
+
+static unsigned char hexin_PyArg_ParseTuple( PyObject *self, HEXIN_FASTCALL_PARAMS,
                                              unsigned short init,
                                              unsigned short (*function)( const unsigned char *,
-                                                                         unsigned int,
+                                                                         size_t,
                                                                          unsigned short ),
                                              unsigned short *result )
 {
+    static const char *const kwlist[] = { "data", "init", NULL };
     Py_buffer data = { NULL, NULL };
+    PyObject *values[2];
+    unsigned long long value = init;
 
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTuple( args, "y*|H", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
-    }
-#else
-    if ( !PyArg_ParseTuple( args, "s*|H", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
+    if ( ( hexin_fastcall_parse( HEXIN_FASTCALL_ARGS, kwlist, 1, 2, values ) < 0 )
+      || ( ( values[1] != NULL ) && ( hexin_fastcall_mask( values[1], &value ) < 0 ) )
+      || ( hexin_fastcall_buffer( values[0], &data ) < 0 ) ) {
         return FALSE;
     }
-#endif /* PY_MAJOR_VERSION */
+    init = ( unsigned short )value;
 
-    *result = (* function)( (const unsigned char *)data.buf, (unsigned int)data.len, init );
+    if ( ( size_t )data.len < hexin_gil_threshold() ) {
+        *result = (* function)( (const unsigned char *)data.buf, (size_t)data.len, init );
+    } else {
+        Py_BEGIN_ALLOW_THREADS
+        *result = (* function)( (const unsigned char *)data.buf, (size_t)data.len, init );
+        Py_END_ALLOW_THREADS
+    }
 
     if ( data.obj )
        PyBuffer_Release( &data );
@@ -71,286 +79,339 @@ static unsigned char hexin_PyArg_ParseTuple( PyObject *self, PyObject *args,
     return TRUE;
 }
 
-static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, PyObject *args, struct _hexin_crc16 *param )
+static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, HEXIN_FASTCALL_PARAMS, const struct _hexin_crc16 *preset, unsigned short *result )
 {
+    struct _hexin_crc16 local = *preset;       /* Per-call state, the preset is shared by every thread */
+    struct _hexin_crc16 *param = &local;
     Py_buffer data = { NULL, NULL };
-    unsigned short init = param->init;          /* Fixed Issues #4  */
+    unsigned long long value = param->init;     /* Fixed Issues #4  */
+    unsigned int threads = 1;
+    int is_gradual = hexin_fastcall_preset( HEXIN_FASTCALL_ARGS, &data, &value, &threads );
+    unsigned short init = ( unsigned short )value;
 
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTuple( args, "y*|H", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
+    if ( is_gradual < 0 ) {
         return FALSE;
     }
-#else
-    if ( !PyArg_ParseTuple( args, "s*|H", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
-    }
-#endif /* PY_MAJOR_VERSION */
 
     /* Fixed Issues #4  */
-    param->is_gradual = ( unsigned int )PyTuple_Size( args );   // Fixed warning C4244
+    param->is_gradual = ( unsigned int )is_gradual;
     if ( HEXIN_GRADUAL_CALCULATE_IS_TRUE( param ) ) {
         init = ( init ^ param->xorout );
     }
 
-    param->result = hexin_crc16_compute( (const unsigned char *)data.buf, (unsigned int)data.len, param, init );
-
-    if ( data.obj )
-       PyBuffer_Release( &data );
+    if ( hexin_parallel_threads( ( size_t )data.len, threads ) > 1 ) {
+        Py_BEGIN_ALLOW_THREADS
+        *result = hexin_crc16_compute_parallel( (const unsigned char *)data.buf, (size_t)data.len, param, init, threads );
+        Py_END_ALLOW_THREADS
+    } else if ( ( size_t )data.len < hexin_gil_threshold() ) {
+        *result = hexin_crc16_compute( (const unsigned char *)data.buf, (size_t)data.len, param, init );
+    } else {
+        Py_BEGIN_ALLOW_THREADS
+        *result = hexin_crc16_compute( (const unsigned char *)data.buf, (size_t)data.len, param, init );
+        Py_END_ALLOW_THREADS
+    }
 
+    PyBuffer_Release( &data );
     return TRUE;
 }
 
-static PyObject * _crc16_modbus( PyObject *self, PyObject *args )
+static const struct _hexin_crc16 crc16_param_modbus = { .is_initial=HEXIN_TABLE_IS_REFLECTED,
+                                                  .width  = HEXIN_CRC16_WIDTH,
+                                                  .poly   = CRC16_POLYNOMIAL_8005,
+                                                  .init   = 0xFFFF,
+                                                  .refin  = TRUE,
+                                                  .refout = TRUE,
+                                                  .xorout = 0x0000,
+                                                  .table  = hexin_crc16_table_8005_reflected,
+                                                  .clmul  = &hexin_crc16_clmul_8005,
+                                                  .combine= &hexin_crc16_combine_8005 };
+
+static PyObject * _crc16_modbus( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_modbus = { .is_initial=FALSE,
-                                                      .width  = HEXIN_CRC16_WIDTH,
-                                                      .poly   = CRC16_POLYNOMIAL_8005,
-                                                      .init   = 0xFFFF,
-                                                      .refin  = TRUE,
-                                                      .refout = TRUE,
-                                                      .xorout = 0x0000,
-                                                      .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_modbus ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc16_param_modbus , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_modbus.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_usb( PyObject *self, PyObject *args )
+static const struct _hexin_crc16 crc16_param_usb = { .is_initial=HEXIN_TABLE_IS_REFLECTED,
+                                               .width  = HEXIN_CRC16_WIDTH,
+                                               .poly   = CRC16_POLYNOMIAL_8005,
+                                               .init   = 0xFFFF,
+                                               .refin  = TRUE,
+                                               .refout = TRUE,
+                                               .xorout = 0xFFFF,
+                                               .table  = hexin_crc16_table_8005_reflected,
+                                               .clmul  = &hexin_crc16_clmul_8005,
+                                               .combine= &hexin_crc16_combine_8005 };
+
+static PyObject * _crc16_usb( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_usb = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC16_WIDTH,
-                                                   .poly   = CRC16_POLYNOMIAL_8005,
-                                                   .init   = 0xFFFF,
-                                                   .refin  = TRUE,
-                                                   .refout = TRUE,
-                                                   .xorout = 0xFFFF,
-                                                   .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_usb ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc16_param_usb , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_usb.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_ibm( PyObject *self, PyObject *args )
+static const struct _hexin_crc16 crc16_param_ibm = { .is_initial=HEXIN_TABLE_IS_REFLECTED,
+                                               .width  = HEXIN_CRC16_WIDTH,
+                                               .poly   = CRC16_POLYNOMIAL_8005,
+                                               .init   = 0x0000,
+                                               .refin  = TRUE,
+                                               .refout = TRUE,
+                                               .xorout = 0x0000,
+                                               .table  = hexin_crc16_table_8005_reflected,
+                                               .clmul  = &hexin_crc16_clmul_8005,
+                                               .combine= &hexin_crc16_combine_8005 };
+
+static PyObject * _crc16_ibm( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_ibm = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC16_WIDTH,
-                                                   .poly   = CRC16_POLYNOMIAL_8005,
-                                                   .init   = 0x0000,
-                                                   .refin  = TRUE,
-                                                   .refout = TRUE,
-                                                   .xorout = 0x0000,
-                                                   .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_ibm ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc16_param_ibm , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_ibm.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_xmodem( PyObject *self, PyObject *args )
+static const struct _hexin_crc16 crc16_param_xmodem = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                  .width  = HEXIN_CRC16_WIDTH,
+                                                  .poly   = CRC16_POLYNOMIAL_1021,
+                                                  .init   = 0x0000,
+                                                  .refin  = FALSE,
+                                                  .refout = FALSE,
+                                                  .xorout = 0x0000,
+                                                  .table  = hexin_crc16_table_1021_normal,
+                                                  .clmul  = &hexin_crc16_clmul_1021,
+                                                  .combine= &hexin_crc16_combine_1021 };
+
+static PyObject * _crc16_xmodem( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_xmodem = { .is_initial=FALSE,
-                                                      .width  = HEXIN_CRC16_WIDTH,
-                                                      .poly   = CRC16_POLYNOMIAL_1021,
-                                                      .init   = 0x0000,
-                                                      .refin  = FALSE,
-                                                      .refout = FALSE,
-                                                      .xorout = 0x0000,
-                                                      .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_xmodem ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc16_param_xmodem , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_xmodem.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
 
-static PyObject * _crc16_ccitt( PyObject *self, PyObject *args )
+static const struct _hexin_crc16 crc16_param_ccitt_false = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                       .width  = HEXIN_CRC16_WIDTH,
+                                                       .poly   = CRC16_POLYNOMIAL_1021,
+                                                       .init   = 0xFFFF,
+                                                       .refin  = FALSE,
+                                                       .refout = FALSE,
+                                                       .xorout = 0x0000,
+                                                       .table  = hexin_crc16_table_1021_normal,
+                                                       .clmul  = &hexin_crc16_clmul_1021,
+                                                       .combine= &hexin_crc16_combine_1021 };
+
+static PyObject * _crc16_ccitt( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_ccitt_false = { .is_initial=FALSE,
-                                                           .width  = HEXIN_CRC16_WIDTH,
-                                                           .poly   = CRC16_POLYNOMIAL_1021,
-                                                           .init   = 0xFFFF,
-                                                           .refin  = FALSE,
-                                                           .refout = FALSE,
-                                                           .xorout = 0x0000,
-                                                           .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_ccitt_false ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc16_param_ccitt_false , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_ccitt_false.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_ccitt_aug( PyObject *self, PyObject *args )
+static const struct _hexin_crc16 crc16_param_ccitt_aug = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                     .width  = HEXIN_CRC16_WIDTH,
+                                                     .poly   = CRC16_POLYNOMIAL_1021,
+                                                     .init   = 0x1D0F,
+                                                     .refin  = FALSE,
+                                                     .refout = FALSE,
+                                                     .xorout = 0x0000,
+                                                     .table  = hexin_crc16_table_1021_normal,
+                                                     .clmul  = &hexin_crc16_clmul_1021,
+                                                     .combine= &hexin_crc16_combine_1021 };
+
+static PyObject * _crc16_ccitt_aug( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_ccitt_aug = { .is_initial=FALSE,
-                                                         .width  = HEXIN_CRC16_WIDTH,
-                                                         .poly   = CRC16_POLYNOMIAL_1021,
-                                                         .init   = 0x1D0F,
-                                                         .refin  = FALSE,
-                                                         .refout = FALSE,
-                                                         .xorout = 0x0000,
-                                                         .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_ccitt_aug ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc16_param_ccitt_aug , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_ccitt_aug.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_kermit( PyObject *self, PyObject *args )
+static const struct _hexin_crc16 crc16_param_kermit = { .is_initial=HEXIN_TABLE_IS_REFLECTED,
+                                                  .width  = HEXIN_CRC16_WIDTH,
+                                                  .poly   = CRC16_POLYNOMIAL_1021,
+                                                  .init   = 0x0000,
+                                                  .refin  = TRUE,
+                                                  .refout = TRUE,
+                                                  .xorout = 0x0000,
+                                                  .table  = hexin_crc16_table_1021_reflected,
+                                                  .clmul  = &hexin_crc16_clmul_1021,
+                                                  .combine= &hexin_crc16_combine_1021 };
+
+static PyObject * _crc16_kermit( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_kermit = { .is_initial=FALSE,
-                                                      .width  = HEXIN_CRC16_WIDTH,
-                                                      .poly   = CRC16_POLYNOMIAL_1021,
-                                                      .init   = 0x0000,
-                                                      .refin  = TRUE,
-                                                      .refout = TRUE,
-                                                      .xorout = 0x0000,
-                                                      .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_kermit ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc16_param_kermit , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_kermit.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_mcrf4xx( PyObject *self, PyObject *args )
+static const struct _hexin_crc16 crc16_param_mcrf4xx = { .is_initial=HEXIN_TABLE_IS_REFLECTED,
+                                                   .width  = HEXIN_CRC16_WIDTH,
+                                                   .poly   = CRC16_POLYNOMIAL_1021,
+                                                   .init   = 0xFFFF,
+                                                   .refin  = TRUE,
+                                                   .refout = TRUE,
+                                                   .xorout = 0x0000,
+                                                   .table  = hexin_crc16_table_1021_reflected,
+                                                   .clmul  = &hexin_crc16_clmul_1021,
+                                                   .combine= &hexin_crc16_combine_1021 };
+
+static PyObject * _crc16_mcrf4xx( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_mcrf4xx = { .is_initial=FALSE,
-                                                       .width  = HEXIN_CRC16_WIDTH,
-                                                       .poly   = CRC16_POLYNOMIAL_1021,
-                                                       .init   = 0xFFFF,
-                                                       .refin  = TRUE,
-                                                       .refout = TRUE,
-                                                       .xorout = 0x0000,
-                                                       .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_mcrf4xx ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc16_param_mcrf4xx , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_mcrf4xx.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_x25( PyObject *self, PyObject *args )
+static const struct _hexin_crc16 crc16_param_x25 = { .is_initial=HEXIN_TABLE_IS_REFLECTED,
+                                               .width  = HEXIN_CRC16_WIDTH,
+                                               .poly   = CRC16_POLYNOMIAL_1021,
+                                               .init   = 0xFFFF,
+                                               .refin  = TRUE,
+                                               .refout = TRUE,
+                                               .xorout = 0xFFFF,
+                                               .table  = hexin_crc16_table_1021_reflected,
+                                               .clmul  = &hexin_crc16_clmul_1021,
+                                               .combine= &hexin_crc16_combine_1021 };
+
+static PyObject * _crc16_x25( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_x25 = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC16_WIDTH,
-                                                   .poly   = CRC16_POLYNOMIAL_1021,
-                                                   .init   = 0xFFFF,
-                                                   .refin  = TRUE,
-                                                   .refout = TRUE,
-                                                   .xorout = 0xFFFF,
-                                                   .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_x25 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc16_param_x25 , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_x25.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_sick( PyObject *self, PyObject *args )
+static PyObject * _crc16_sick( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
     unsigned short result = 0x0000;
     unsigned short init   = 0x0000;
  
-    if ( !hexin_PyArg_ParseTuple( self, args, init, hexin_calc_crc16_sick, ( unsigned short * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( self, HEXIN_FASTCALL_ARGS, init, hexin_calc_crc16_sick, ( unsigned short * )&result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_dnp( PyObject *self, PyObject *args )
+static const struct _hexin_crc16 crc16_param_dnp = { .is_initial=HEXIN_TABLE_IS_REFLECTED,
+                                               .width  = HEXIN_CRC16_WIDTH,
+                                               .poly   = CRC16_POLYNOMIAL_3D65,
+                                               .init   = 0x0000,
+                                               .refin  = TRUE,
+                                               .refout = TRUE,
+                                               .xorout = 0xFFFF,
+                                               .table  = hexin_crc16_table_3D65_reflected,
+                                               .clmul  = &hexin_crc16_clmul_3D65,
+                                               .combine= &hexin_crc16_combine_3D65 };
+
+static PyObject * _crc16_dnp( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_dnp = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC16_WIDTH,
-                                                   .poly   = CRC16_POLYNOMIAL_3D65,
-                                                   .init   = 0x0000,
-                                                   .refin  = TRUE,
-                                                   .refout = TRUE,
-                                                   .xorout = 0xFFFF,
-                                                   .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_dnp ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc16_param_dnp , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_dnp.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_maxim( PyObject *self, PyObject *args )
+static const struct _hexin_crc16 crc16_param_maxim = { .is_initial=HEXIN_TABLE_IS_REFLECTED,
+                                                 .width  = HEXIN_CRC16_WIDTH,
+                                                 .poly   = CRC16_POLYNOMIAL_8005,
+                                                 .init   = 0x0000,
+                                                 .refin  = TRUE,
+                                                 .refout = TRUE,
+                                                 .xorout = 0xFFFF,
+                                                 .table  = hexin_crc16_table_8005_reflected,
+                                                 .clmul  = &hexin_crc16_clmul_8005,
+                                                 .combine= &hexin_crc16_combine_8005 };
+
+static PyObject * _crc16_maxim( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_maxim = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC16_WIDTH,
-                                                     .poly   = CRC16_POLYNOMIAL_8005,
-                                                     .init   = 0x0000,
-                                                     .refin  = TRUE,
-                                                     .refout = TRUE,
-                                                     .xorout = 0xFFFF,
-                                                     .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_maxim ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc16_param_maxim , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_maxim.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_dect_r( PyObject *self, PyObject *args )
+static const struct _hexin_crc16 crc16_param_dectr = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                 .width  = HEXIN_CRC16_WIDTH,
+                                                 .poly   = CRC16_POLYNOMIAL_0589,
+                                                 .init   = 0x0000,
+                                                 .refin  = FALSE,
+                                                 .refout = FALSE,
+                                                 .xorout = 0x0001,
+                                                 .table  = hexin_crc16_table_0589_normal,
+                                                 .clmul  = &hexin_crc16_clmul_0589,
+                                                 .combine= &hexin_crc16_combine_0589 };
+
+static PyObject * _crc16_dect_r( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_dectr = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC16_WIDTH,
-                                                     .poly   = CRC16_POLYNOMIAL_0589,
-                                                     .init   = 0x0000,
-                                                     .refin  = FALSE,
-                                                     .refout = FALSE,
-                                                     .xorout = 0x0001,
-                                                     .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_dectr ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc16_param_dectr , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_dectr.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_dect_x( PyObject *self, PyObject *args )
+static const struct _hexin_crc16 crc16_param_dectx = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                 .width  = HEXIN_CRC16_WIDTH,
+                                                 .poly   = CRC16_POLYNOMIAL_0589,
+                                                 .init   = 0x0000,
+                                                 .refin  = FALSE,
+                                                 .refout = FALSE,
+                                                 .xorout = 0x0000,
+                                                 .table  = hexin_crc16_table_0589_normal,
+                                                 .clmul  = &hexin_crc16_clmul_0589,
+                                                 .combine= &hexin_crc16_combine_0589 };
+
+static PyObject * _crc16_dect_x( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_dectx = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC16_WIDTH,
-                                                     .poly   = CRC16_POLYNOMIAL_0589,
-                                                     .init   = 0x0000,
-                                                     .refin  = FALSE,
-                                                     .refout = FALSE,
-                                                     .xorout = 0x0000,
-                                                     .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_dectx ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc16_param_dectx , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_dectx.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
 static PyObject * _crc16_table( PyObject *self, PyObject *args )
@@ -376,428 +437,853 @@ static PyObject * _crc16_table( PyObject *self, PyObject *args )
     }
 
     for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
-        PyList_SetItem( plist, i, Py_BuildValue( "H", table[i] ) );
+        PyList_SetItem( plist, i, PyLong_FromUnsignedLong( table[i] ) );
     }
 
     return plist;
 }
 
-static PyObject * _crc16_hacker( PyObject *self, PyObject *args, PyObject* kws )
+static unsigned int hexin_crc16_hacker_init( void *param, void *table, struct _hexin_clmul *clmul )
+{
+    return hexin_crc16_compute_init_table( ( struct _hexin_crc16 * )param, ( unsigned short (*)[MAX_TABLE_ARRAY] )table, clmul );
+}
+
+static struct _hexin_hacker_cache crc16_hacker_cache = { NULL, sizeof( unsigned short [MAX_SLICING_ARRAY][MAX_TABLE_ARRAY] ), hexin_crc16_hacker_init, 0 };
+
+static PyObject * _crc16_hacker( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
     unsigned int reinit = FALSE;
+    unsigned short result = 0;
+    struct _hexin_hacker_entry *entry = NULL;
     Py_buffer data = { NULL, NULL };
-    static struct _hexin_crc16 crc16_param_hacker = { .is_initial = FALSE,
-                                                      .is_gradual = FALSE,
-                                                      .width  = HEXIN_CRC16_WIDTH,
-                                                      .poly   = CRC16_POLYNOMIAL_8005,
-                                                      .init   = 0xFFFF,
-                                                      .refin  = TRUE,
-                                                      .refout = TRUE,
-                                                      .xorout = 0x0000,
-                                                      .result = 0 };
-
-    static char* kwlist[]={ "data", "poly", "init", "xorout", "refin", "refout", "reinit", NULL };
-
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTupleAndKeywords( args, kws, "y*|HHHppp", kwlist, &data,
-                                                                       &crc16_param_hacker.poly,
-                                                                       &crc16_param_hacker.init,
-                                                                       &crc16_param_hacker.xorout,
-                                                                       &crc16_param_hacker.refin,
-                                                                       &crc16_param_hacker.refout,
-                                                                       &reinit ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
+    struct _hexin_crc16 crc16_param_hacker = { .is_initial = FALSE,
+                                               .is_gradual = FALSE,
+                                               .width  = HEXIN_CRC16_WIDTH,
+                                               .poly   = CRC16_POLYNOMIAL_8005,
+                                               .init   = 0xFFFF,
+                                               .refin  = TRUE,
+                                               .refout = TRUE,
+                                               .xorout = 0x0000 };
+
+    static const char *const kwlist[] = { "data", "poly", "init", "xorout", "refin", "refout", "reinit", NULL };
+    PyObject *values[7];
+    unsigned long long poly = crc16_param_hacker.poly, init = crc16_param_hacker.init, xorout = crc16_param_hacker.xorout;
+    unsigned int refin = crc16_param_hacker.refin, refout = crc16_param_hacker.refout;
+
+    if ( ( hexin_fastcall_parse( HEXIN_FASTCALL_ARGS, kwlist, 1, 7, values ) < 0 )
+      || ( ( values[1] != NULL ) && ( hexin_fastcall_mask( values[1], &poly   ) < 0 ) )
+      || ( ( values[2] != NULL ) && ( hexin_fastcall_mask( values[2], &init   ) < 0 ) )
+      || ( ( values[3] != NULL ) && ( hexin_fastcall_mask( values[3], &xorout ) < 0 ) )
+      || ( ( values[4] != NULL ) && ( hexin_fastcall_bool( values[4], &refin  ) < 0 ) )
+      || ( ( values[5] != NULL ) && ( hexin_fastcall_bool( values[5], &refout ) < 0 ) )
+      || ( ( values[6] != NULL ) && ( hexin_fastcall_bool( values[6], &reinit ) < 0 ) )
+      || ( hexin_fastcall_buffer( values[0], &data ) < 0 ) ) {
         return NULL;
     }
-#else
-    if ( !PyArg_ParseTupleAndKeywords( args, kws, "s*|HHHIII", kwlist, &data,
-                                                                       &crc16_param_hacker.poly,
-                                                                       &crc16_param_hacker.init,
-                                                                       &crc16_param_hacker.xorout,
-                                                                       &crc16_param_hacker.refin,
-                                                                       &crc16_param_hacker.refout,
-                                                                       &reinit ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
+    crc16_param_hacker.poly   = ( unsigned short )poly;
+    crc16_param_hacker.init   = ( unsigned short )init;
+    crc16_param_hacker.xorout = ( unsigned short )xorout;
+    crc16_param_hacker.refin  = refin;
+    crc16_param_hacker.refout = refout;
+
+    /* The tables of the last HEXIN_HACKER_CACHE_SIZE ( poly, orientation ) are kept, reinit=True builds them again. */
+    entry = hexin_hacker_acquire( &crc16_hacker_cache, &crc16_param_hacker, crc16_param_hacker.poly, HEXIN_TABLE_TYPE( &crc16_param_hacker ), reinit );
+    if ( entry == NULL ) {
+        PyBuffer_Release( &data );
         return NULL;
     }
-#endif /* PY_MAJOR_VERSION */
+    crc16_param_hacker.is_initial = entry->type;
+    crc16_param_hacker.table      = entry->table;
+    crc16_param_hacker.clmul      = &entry->clmul;
 
-    crc16_param_hacker.is_initial = ( reinit == FALSE ) ? crc16_param_hacker.is_initial : FALSE;
-    crc16_param_hacker.result = hexin_crc16_compute( (const unsigned char *)data.buf, (unsigned int)data.len, &crc16_param_hacker, crc16_param_hacker.init );
+    if ( ( size_t )data.len < hexin_gil_threshold() ) {
+        result = hexin_crc16_compute( (const unsigned char *)data.buf, (size_t)data.len, &crc16_param_hacker, crc16_param_hacker.init );
+    } else {
+        Py_BEGIN_ALLOW_THREADS
+        result = hexin_crc16_compute( (const unsigned char *)data.buf, (size_t)data.len, &crc16_param_hacker, crc16_param_hacker.init );
+        Py_END_ALLOW_THREADS
+    }
 
-    if ( data.obj )
-       PyBuffer_Release( &data );
+    hexin_hacker_release( &crc16_hacker_cache, entry );
+    PyBuffer_Release( &data );
 
-    return Py_BuildValue( "H", crc16_param_hacker.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_network( PyObject *self, PyObject *args )
+static PyObject * _crc16_network( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
     unsigned short result   = 0x0000;
     unsigned short reserved = 0x0000;
  
-    if ( !hexin_PyArg_ParseTuple( self, args, reserved, hexin_calc_crc16_network, ( unsigned short * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( self, HEXIN_FASTCALL_ARGS, reserved, hexin_calc_crc16_network, ( unsigned short * )&result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_fletcher( PyObject *self, PyObject *args )
+static PyObject * _crc16_fletcher( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
     unsigned short result   = 0x0000;
     unsigned short reserved = 0x0000;
  
-    if ( !hexin_PyArg_ParseTuple( self, args, reserved, hexin_calc_crc16_fletcher, ( unsigned short * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( self, HEXIN_FASTCALL_ARGS, reserved, hexin_calc_crc16_fletcher, ( unsigned short * )&result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_rfid_epc( PyObject *self, PyObject *args )
+static const struct _hexin_crc16 crc16_param_epc16 = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                 .width  = HEXIN_CRC16_WIDTH,
+                                                 .poly   = CRC16_POLYNOMIAL_1021,
+                                                 .init   = 0xFFFF,
+                                                 .refin  = FALSE,
+                                                 .refout = FALSE,
+                                                 .xorout = 0xFFFF,
+                                                 .table  = hexin_crc16_table_1021_normal,
+                                                 .clmul  = &hexin_crc16_clmul_1021,
+                                                 .combine= &hexin_crc16_combine_1021 };
+
+static PyObject * _crc16_rfid_epc( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_epc16 = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC16_WIDTH,
-                                                     .poly   = CRC16_POLYNOMIAL_1021,
-                                                     .init   = 0xFFFF,
-                                                     .refin  = FALSE,
-                                                     .refout = FALSE,
-                                                     .xorout = 0xFFFF,
-                                                     .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_epc16 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc16_param_epc16 , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_epc16.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_profibus( PyObject *self, PyObject *args )
+static const struct _hexin_crc16 crc16_param_profibus = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                    .width  = HEXIN_CRC16_WIDTH,
+                                                    .poly   = CRC16_POLYNOMIAL_1DCF,
+                                                    .init   = 0xFFFF,
+                                                    .refin  = FALSE,
+                                                    .refout = FALSE,
+                                                    .xorout = 0xFFFF,
+                                                    .table  = hexin_crc16_table_1DCF_normal,
+                                                    .clmul  = &hexin_crc16_clmul_1DCF,
+                                                    .combine= &hexin_crc16_combine_1DCF };
+
+static PyObject * _crc16_profibus( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_profibus = { .is_initial=FALSE,
-                                                        .width  = HEXIN_CRC16_WIDTH,
-                                                        .poly   = CRC16_POLYNOMIAL_1DCF,
-                                                        .init   = 0xFFFF,
-                                                        .refin  = FALSE,
-                                                        .refout = FALSE,
-                                                        .xorout = 0xFFFF,
-                                                        .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_profibus ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc16_param_profibus , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_profibus.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_buypass( PyObject *self, PyObject *args )
+static const struct _hexin_crc16 crc16_param_buypass = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                   .width  = HEXIN_CRC16_WIDTH,
+                                                   .poly   = CRC16_POLYNOMIAL_8005,
+                                                   .init   = 0x0000,
+                                                   .refin  = FALSE,
+                                                   .refout = FALSE,
+                                                   .xorout = 0x0000,
+                                                   .table  = hexin_crc16_table_8005_normal,
+                                                   .clmul  = &hexin_crc16_clmul_8005,
+                                                   .combine= &hexin_crc16_combine_8005 };
+
+static PyObject * _crc16_buypass( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_buypass = { .is_initial=FALSE,
-                                                       .width  = HEXIN_CRC16_WIDTH,
-                                                       .poly   = CRC16_POLYNOMIAL_8005,
-                                                       .init   = 0x0000,
-                                                       .refin  = FALSE,
-                                                       .refout = FALSE,
-                                                       .xorout = 0x0000,
-                                                       .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_buypass ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc16_param_buypass , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_buypass.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_gsm16( PyObject *self, PyObject *args )
+static const struct _hexin_crc16 crc16_param_gsm16 = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                 .width  = HEXIN_CRC16_WIDTH,
+                                                 .poly   = CRC16_POLYNOMIAL_1021,
+                                                 .init   = 0x0000,
+                                                 .refin  = FALSE,
+                                                 .refout = FALSE,
+                                                 .xorout = 0xFFFF,
+                                                 .table  = hexin_crc16_table_1021_normal,
+                                                 .clmul  = &hexin_crc16_clmul_1021,
+                                                 .combine= &hexin_crc16_combine_1021 };
+
+static PyObject * _crc16_gsm16( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_gsm16 = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC16_WIDTH,
-                                                     .poly   = CRC16_POLYNOMIAL_1021,
-                                                     .init   = 0x0000,
-                                                     .refin  = FALSE,
-                                                     .refout = FALSE,
-                                                     .xorout = 0xFFFF,
-                                                     .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_gsm16 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc16_param_gsm16 , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_gsm16.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_riello( PyObject *self, PyObject *args )
+static const struct _hexin_crc16 crc16_param_riello = { .is_initial=HEXIN_TABLE_IS_REFLECTED,
+                                                  .width  = HEXIN_CRC16_WIDTH,
+                                                  .poly   = CRC16_POLYNOMIAL_1021,
+                                                  .init   = 0xB2AA,
+                                                  .refin  = TRUE,
+                                                  .refout = TRUE,
+                                                  .xorout = 0x0000,
+                                                  .table  = hexin_crc16_table_1021_reflected,
+                                                  .clmul  = &hexin_crc16_clmul_1021,
+                                                  .combine= &hexin_crc16_combine_1021 };
+
+static PyObject * _crc16_riello( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_riello = { .is_initial=FALSE,
-                                                      .width  = HEXIN_CRC16_WIDTH,
-                                                      .poly   = CRC16_POLYNOMIAL_1021,
-                                                      .init   = 0xB2AA,
-                                                      .refin  = TRUE,
-                                                      .refout = TRUE,
-                                                      .xorout = 0x0000,
-                                                      .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_riello ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc16_param_riello , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_riello.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_crc16_a( PyObject *self, PyObject *args )
+static const struct _hexin_crc16 crc16_param_crc16a = { .is_initial=HEXIN_TABLE_IS_REFLECTED,
+                                                  .width  = HEXIN_CRC16_WIDTH,
+                                                  .poly   = CRC16_POLYNOMIAL_1021,
+                                                  .init   = 0xC6C6,
+                                                  .refin  = TRUE,
+                                                  .refout = TRUE,
+                                                  .xorout = 0x0000,
+                                                  .table  = hexin_crc16_table_1021_reflected,
+                                                  .clmul  = &hexin_crc16_clmul_1021,
+                                                  .combine= &hexin_crc16_combine_1021 };
+
+static PyObject * _crc16_crc16_a( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_crc16a = { .is_initial=FALSE,
-                                                      .width  = HEXIN_CRC16_WIDTH,
-                                                      .poly   = CRC16_POLYNOMIAL_1021,
-                                                      .init   = 0xC6C6,
-                                                      .refin  = TRUE,
-                                                      .refout = TRUE,
-                                                      .xorout = 0x0000,
-                                                      .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_crc16a ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc16_param_crc16a , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_crc16a.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_cdma2000( PyObject *self, PyObject *args )
+static const struct _hexin_crc16 crc16_param_cdma2000 = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                  .width  = HEXIN_CRC16_WIDTH,
+                                                  .poly   = CRC16_POLYNOMIAL_C867,
+                                                  .init   = 0xFFFF,
+                                                  .refin  = FALSE,
+                                                  .refout = FALSE,
+                                                  .xorout = 0x0000,
+                                                  .table  = hexin_crc16_table_C867_normal,
+                                                  .clmul  = &hexin_crc16_clmul_C867,
+                                                  .combine= &hexin_crc16_combine_C867 };
+
+static PyObject * _crc16_cdma2000( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_cdma2000 = { .is_initial=FALSE,
-                                                      .width  = HEXIN_CRC16_WIDTH,
-                                                      .poly   = CRC16_POLYNOMIAL_C867,
-                                                      .init   = 0xFFFF,
-                                                      .refin  = FALSE,
-                                                      .refout = FALSE,
-                                                      .xorout = 0x0000,
-                                                      .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_cdma2000 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc16_param_cdma2000 , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_cdma2000.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_teledisk( PyObject *self, PyObject *args )
+static const struct _hexin_crc16 crc16_param_teledisk = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                  .width  = HEXIN_CRC16_WIDTH,
+                                                  .poly   = 0xA097,
+                                                  .init   = 0x0000,
+                                                  .refin  = FALSE,
+                                                  .refout = FALSE,
+                                                  .xorout = 0x0000,
+                                                  .table  = hexin_crc16_table_A097_normal,
+                                                  .clmul  = &hexin_crc16_clmul_A097,
+                                                  .combine= &hexin_crc16_combine_A097 };
+
+static PyObject * _crc16_teledisk( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_teledisk = { .is_initial=FALSE,
-                                                      .width  = HEXIN_CRC16_WIDTH,
-                                                      .poly   = 0xA097,
-                                                      .init   = 0x0000,
-                                                      .refin  = FALSE,
-                                                      .refout = FALSE,
-                                                      .xorout = 0x0000,
-                                                      .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_teledisk ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc16_param_teledisk , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_teledisk.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_tms37157( PyObject *self, PyObject *args )
+static const struct _hexin_crc16 crc16_param_tms37157 = { .is_initial=HEXIN_TABLE_IS_REFLECTED,
+                                                  .width  = HEXIN_CRC16_WIDTH,
+                                                  .poly   = CRC16_POLYNOMIAL_1021,
+                                                  .init   = 0x89EC,
+                                                  .refin  = TRUE,
+                                                  .refout = TRUE,
+                                                  .xorout = 0x0000,
+                                                  .table  = hexin_crc16_table_1021_reflected,
+                                                  .clmul  = &hexin_crc16_clmul_1021,
+                                                  .combine= &hexin_crc16_combine_1021 };
+
+static PyObject * _crc16_tms37157( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_tms37157 = { .is_initial=FALSE,
-                                                      .width  = HEXIN_CRC16_WIDTH,
-                                                      .poly   = CRC16_POLYNOMIAL_1021,
-                                                      .init   = 0x89EC,
-                                                      .refin  = TRUE,
-                                                      .refout = TRUE,
-                                                      .xorout = 0x0000,
-                                                      .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_tms37157 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc16_param_tms37157 , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_tms37157.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_en13757( PyObject *self, PyObject *args )
+static const struct _hexin_crc16 crc16_param_en13757 = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                   .width  = HEXIN_CRC16_WIDTH,
+                                                   .poly   = CRC16_POLYNOMIAL_3D65,
+                                                   .init   = 0x0000,
+                                                   .refin  = FALSE,
+                                                   .refout = FALSE,
+                                                   .xorout = 0xFFFF,
+                                                   .table  = hexin_crc16_table_3D65_normal,
+                                                   .clmul  = &hexin_crc16_clmul_3D65,
+                                                   .combine= &hexin_crc16_combine_3D65 };
+
+static PyObject * _crc16_en13757( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_en13757 = { .is_initial=FALSE,
-                                                       .width  = HEXIN_CRC16_WIDTH,
-                                                       .poly   = CRC16_POLYNOMIAL_3D65,
-                                                       .init   = 0x0000,
-                                                       .refin  = FALSE,
-                                                       .refout = FALSE,
-                                                       .xorout = 0xFFFF,
-                                                       .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_en13757 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc16_param_en13757 , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_en13757.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_t10_dif( PyObject *self, PyObject *args )
+static const struct _hexin_crc16 crc16_param_t10_dif = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                   .width  = HEXIN_CRC16_WIDTH,
+                                                   .poly   = 0x8BB7,
+                                                   .init   = 0x0000,
+                                                   .refin  = FALSE,
+                                                   .refout = FALSE,
+                                                   .xorout = 0x0000,
+                                                   .table  = hexin_crc16_table_8BB7_normal,
+                                                   .clmul  = &hexin_crc16_clmul_8BB7,
+                                                   .combine= &hexin_crc16_combine_8BB7 };
+
+static PyObject * _crc16_t10_dif( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_t10_dif = { .is_initial=FALSE,
-                                                       .width  = HEXIN_CRC16_WIDTH,
-                                                       .poly   = 0x8BB7,
-                                                       .init   = 0x0000,
-                                                       .refin  = FALSE,
-                                                       .refout = FALSE,
-                                                       .xorout = 0x0000,
-                                                       .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_t10_dif ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc16_param_t10_dif , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_t10_dif.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_dds_110( PyObject *self, PyObject *args )
+static const struct _hexin_crc16 crc16_param_dds_110 = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                   .width  = HEXIN_CRC16_WIDTH,
+                                                   .poly   = CRC16_POLYNOMIAL_8005,
+                                                   .init   = 0x800D,
+                                                   .refin  = FALSE,
+                                                   .refout = FALSE,
+                                                   .xorout = 0x0000,
+                                                   .table  = hexin_crc16_table_8005_normal,
+                                                   .clmul  = &hexin_crc16_clmul_8005,
+                                                   .combine= &hexin_crc16_combine_8005 };
+
+static PyObject * _crc16_dds_110( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_dds_110 = { .is_initial=FALSE,
-                                                       .width  = HEXIN_CRC16_WIDTH,
-                                                       .poly   = CRC16_POLYNOMIAL_8005,
-                                                       .init   = 0x800D,
-                                                       .refin  = FALSE,
-                                                       .refout = FALSE,
-                                                       .xorout = 0x0000,
-                                                       .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_dds_110 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc16_param_dds_110 , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_dds_110.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_cms( PyObject *self, PyObject *args )
+static const struct _hexin_crc16 crc16_param_cms16 = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                 .width  = HEXIN_CRC16_WIDTH,
+                                                 .poly   = CRC16_POLYNOMIAL_8005,
+                                                 .init   = 0xFFFF,
+                                                 .refin  = FALSE,
+                                                 .refout = FALSE,
+                                                 .xorout = 0x0000,
+                                                 .table  = hexin_crc16_table_8005_normal,
+                                                 .clmul  = &hexin_crc16_clmul_8005,
+                                                 .combine= &hexin_crc16_combine_8005 };
+
+static PyObject * _crc16_cms( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_cms16 = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC16_WIDTH,
-                                                     .poly   = CRC16_POLYNOMIAL_8005,
-                                                     .init   = 0xFFFF,
-                                                     .refin  = FALSE,
-                                                     .refout = FALSE,
-                                                     .xorout = 0x0000,
-                                                     .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_cms16 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc16_param_cms16 , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_cms16.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_lj1200( PyObject *self, PyObject *args )
+static const struct _hexin_crc16 crc16_param_lj1200 = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                  .width  = HEXIN_CRC16_WIDTH,
+                                                  .poly   = 0x6F63,
+                                                  .init   = 0x0000,
+                                                  .refin  = FALSE,
+                                                  .refout = FALSE,
+                                                  .xorout = 0x0000,
+                                                  .table  = hexin_crc16_table_6F63_normal,
+                                                  .clmul  = &hexin_crc16_clmul_6F63,
+                                                  .combine= &hexin_crc16_combine_6F63 };
+
+static PyObject * _crc16_lj1200( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_lj1200 = { .is_initial=FALSE,
-                                                      .width  = HEXIN_CRC16_WIDTH,
-                                                      .poly   = 0x6F63,
-                                                      .init   = 0x0000,
-                                                      .refin  = FALSE,
-                                                      .refout = FALSE,
-                                                      .xorout = 0x0000,
-                                                      .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_lj1200 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc16_param_lj1200 , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_lj1200.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_nrsc5( PyObject *self, PyObject *args )
+static const struct _hexin_crc16 crc16_param_nrsc5 = { .is_initial=HEXIN_TABLE_IS_REFLECTED,
+                                                 .width  = HEXIN_CRC16_WIDTH,
+                                                 .poly   = 0x080B,
+                                                 .init   = 0xFFFF,
+                                                 .refin  = TRUE,
+                                                 .refout = TRUE,
+                                                 .xorout = 0x0000,
+                                                 .table  = hexin_crc16_table_080B_reflected,
+                                                 .clmul  = &hexin_crc16_clmul_080B,
+                                                 .combine= &hexin_crc16_combine_080B };
+
+static PyObject * _crc16_nrsc5( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_nrsc5 = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC16_WIDTH,
-                                                     .poly   = 0x080B,
-                                                     .init   = 0xFFFF,
-                                                     .refin  = TRUE,
-                                                     .refout = TRUE,
-                                                     .xorout = 0x0000,
-                                                     .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_nrsc5 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc16_param_nrsc5 , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_nrsc5.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_opensafety_a( PyObject *self, PyObject *args )
+static const struct _hexin_crc16 crc16_param_opensafety_a = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                        .width  = HEXIN_CRC16_WIDTH,
+                                                        .poly   = 0x5935,
+                                                        .init   = 0x0000,
+                                                        .refin  = FALSE,
+                                                        .refout = FALSE,
+                                                        .xorout = 0x0000,
+                                                        .table  = hexin_crc16_table_5935_normal,
+                                                        .clmul  = &hexin_crc16_clmul_5935,
+                                                        .combine= &hexin_crc16_combine_5935 };
+
+static PyObject * _crc16_opensafety_a( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc16 crc16_param_opensafety_a = { .is_initial=FALSE,
-                                                            .width  = HEXIN_CRC16_WIDTH,
-                                                            .poly   = 0x5935,
-                                                            .init   = 0x0000,
-                                                            .refin  = FALSE,
-                                                            .refout = FALSE,
-                                                            .xorout = 0x0000,
-                                                            .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_opensafety_a ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc16_param_opensafety_a , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_opensafety_a.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc16_opensafety_b( PyObject *self, PyObject *args )
+static const struct _hexin_crc16 crc16_param_opensafety_b = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                        .width  = HEXIN_CRC16_WIDTH,
+                                                        .poly   = 0x755B,
+                                                        .init   = 0x0000,
+                                                        .refin  = FALSE,
+                                                        .refout = FALSE,
+                                                        .xorout = 0x0000,
+                                                        .table  = hexin_crc16_table_755B_normal,
+                                                        .clmul  = &hexin_crc16_clmul_755B,
+                                                        .combine= &hexin_crc16_combine_755B };
+
+static PyObject * _crc16_opensafety_b( PyObject *self, HEXIN_FASTCALL_PARAMS )
+{
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc16_param_opensafety_b , &result ) ) {
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLong( result );
+}
+
+/* Named presets, the method names of the table below */
+static struct {
+    const char          *name;
+    const struct _hexin_crc16 *param;
+} _crc16_presets[] = {
+    { "modbus",      &crc16_param_modbus },
+    { "usb16",       &crc16_param_usb },
+    { "ibm",         &crc16_param_ibm },
+    { "arc",         &crc16_param_ibm },
+    { "lha",         &crc16_param_ibm },
+    { "xmodem",      &crc16_param_xmodem },
+    { "zmodem",      &crc16_param_xmodem },
+    { "acorn",       &crc16_param_xmodem },
+    { "v41_msb",     &crc16_param_xmodem },
+    { "lte16",       &crc16_param_xmodem },
+    { "ccitt_aug",   &crc16_param_ccitt_aug },
+    { "spi_fujitsu", &crc16_param_ccitt_aug },
+    { "ccitt_false", &crc16_param_ccitt_false },
+    { "ibm_3740",    &crc16_param_ccitt_false },
+    { "autosar16",   &crc16_param_ccitt_false },
+    { "kermit",      &crc16_param_kermit },
+    { "ccitt_true",  &crc16_param_kermit },
+    { "ccitt",       &crc16_param_kermit },
+    { "v41_lsb",     &crc16_param_kermit },
+    { "mcrf4xx",     &crc16_param_mcrf4xx },
+    { "dnp",         &crc16_param_dnp },
+    { "x25",         &crc16_param_x25 },
+    { "ibm_sdlc",    &crc16_param_x25 },
+    { "iso_hdlc16",  &crc16_param_x25 },
+    { "iec14443_3_b",&crc16_param_x25 },
+    { "maxim16",     &crc16_param_maxim },
+    { "dect_r",      &crc16_param_dectr },
+    { "dect_x",      &crc16_param_dectx },
+    { "epc16",       &crc16_param_epc16 },
+    { "profibus",    &crc16_param_profibus },
+    { "buypass",     &crc16_param_buypass },
+    { "umts",        &crc16_param_buypass },
+    { "verifone",    &crc16_param_buypass },
+    { "genibus",     &crc16_param_epc16 },
+    { "darc",        &crc16_param_epc16 },
+    { "epc_c1g2",    &crc16_param_epc16 },
+    { "icode16",     &crc16_param_epc16 },
+    { "gsm16",       &crc16_param_gsm16 },
+    { "riello",      &crc16_param_riello },
+    { "crc16_a",     &crc16_param_crc16a },
+    { "iec14443_3_a",&crc16_param_crc16a },
+    { "cdma2000",    &crc16_param_cdma2000 },
+    { "teledisk",    &crc16_param_teledisk },
+    { "tms37157",    &crc16_param_tms37157 },
+    { "en13757",     &crc16_param_en13757 },
+    { "t10_dif",     &crc16_param_t10_dif },
+    { "dds_110",     &crc16_param_dds_110 },
+    { "cms",         &crc16_param_cms16 },
+    { "lj1200",      &crc16_param_lj1200 },
+    { "nrsc5",       &crc16_param_nrsc5 },
+    { "opensafety_a",&crc16_param_opensafety_a },
+    { "opensafety_b",&crc16_param_opensafety_b },
+    { NULL, NULL }
+};
+
+static const struct _hexin_crc16 *hexin_crc16_preset( const char *name )
+{
+    unsigned int i = 0;
+
+    for ( i=0; _crc16_presets[i].name != NULL; i++ ) {
+        if ( 0 == strcmp( _crc16_presets[i].name, name ) ) {
+            return _crc16_presets[i].param;
+        }
+    }
+    return NULL;
+}
+
+static PyObject * _crc16_presets_list( PyObject *self, PyObject *args )
+{
+    unsigned int i = 0;
+    PyObject *names = PyList_New( 0 );
+
+    for ( i=0; ( names != NULL ) && ( _crc16_presets[i].name != NULL ); i++ ) {
+        PyObject *name = Py_BuildValue( "s", _crc16_presets[i].name );
+        if ( ( name == NULL ) || ( PyList_Append( names, name ) < 0 ) ) {
+            Py_XDECREF( name );
+            Py_DECREF( names );
+            return NULL;
+        }
+        Py_DECREF( name );
+    }
+    return names;
+}
+
+static PyObject * _crc16_combine( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    unsigned long long crc_a = 0, crc_b = 0, len_b = 0, mask = 0;
+    const struct _hexin_crc16 *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "sO&O&O&", &name, hexin_PyArg_count, &crc_a, hexin_PyArg_count, &crc_b, hexin_PyArg_count, &len_b ) ) {
+        return NULL;
+    }
+
+    param = hexin_crc16_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+
+    mask = ( param->width >= 64 ) ? ~0ULL : ( ( 1ULL << param->width ) - 1 );
+    if ( ( crc_a | crc_b ) & ~mask ) {
+        PyErr_Format( PyExc_ValueError, "%s is a %u-bit CRC", name, ( unsigned int )param->width );
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLongLong( hexin_crc16_combine( param, ( unsigned short )crc_a, ( unsigned short )crc_b, len_b ) );
+}
+
+static PyObject * _crc16_extend_zeros( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    unsigned long long crc = 0, len = 0, mask = 0;
+    const struct _hexin_crc16 *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "sO&O&", &name, hexin_PyArg_count, &crc, hexin_PyArg_count, &len ) ) {
+        return NULL;
+    }
+
+    param = hexin_crc16_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+
+    mask = ( param->width >= 64 ) ? ~0ULL : ( ( 1ULL << param->width ) - 1 );
+    if ( crc & ~mask ) {
+        PyErr_Format( PyExc_ValueError, "%s is a %u-bit CRC", name, ( unsigned int )param->width );
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLongLong( hexin_crc16_extend_zeros( param, ( unsigned short )crc, len ) );
+}
+
+static PyObject * _crc16_extend_repeat( PyObject *self, PyObject *args )
 {
-    static struct _hexin_crc16 crc16_param_opensafety_b = { .is_initial=FALSE,
-                                                            .width  = HEXIN_CRC16_WIDTH,
-                                                            .poly   = 0x755B,
-                                                            .init   = 0x0000,
-                                                            .refin  = FALSE,
-                                                            .refout = FALSE,
-                                                            .xorout = 0x0000,
-                                                            .result = 0 };
+    const char *name = NULL;
+    unsigned long long crc = 0, count = 0, mask = 0;
+    const struct _hexin_crc16 *param = NULL;
+    Py_buffer data = { NULL, NULL };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc16_param_opensafety_b ) ) {
+#if PY_MAJOR_VERSION >= 3
+    if ( !PyArg_ParseTuple( args, "sO&y*O&", &name, hexin_PyArg_count, &crc, &data, hexin_PyArg_count, &count ) ) {
+#else
+    if ( !PyArg_ParseTuple( args, "sO&s*O&", &name, hexin_PyArg_count, &crc, &data, hexin_PyArg_count, &count ) ) {
+#endif /* PY_MAJOR_VERSION */
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc16_param_opensafety_b.result );
+    param = hexin_crc16_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        PyBuffer_Release( &data );
+        return NULL;
+    }
+
+    mask = ( param->width >= 64 ) ? ~0ULL : ( ( 1ULL << param->width ) - 1 );
+    if ( crc & ~mask ) {
+        PyErr_Format( PyExc_ValueError, "%s is a %u-bit CRC", name, ( unsigned int )param->width );
+        PyBuffer_Release( &data );
+        return NULL;
+    }
+
+    if ( ( size_t )data.len < hexin_gil_threshold() ) {
+        result = hexin_crc16_extend_repeat( param, ( unsigned short )crc, ( const unsigned char * )data.buf, ( size_t )data.len, count );
+    } else {
+        Py_BEGIN_ALLOW_THREADS
+        result = hexin_crc16_extend_repeat( param, ( unsigned short )crc, ( const unsigned char * )data.buf, ( size_t )data.len, count );
+        Py_END_ALLOW_THREADS
+    }
+    PyBuffer_Release( &data );
+    return PyLong_FromUnsignedLongLong( result );
+}
+
+static PyObject * _crc16_update_range( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    unsigned long long crc = 0, offset = 0, total = 0, mask = 0;
+    const struct _hexin_crc16 *param = NULL;
+    Py_buffer before = { NULL, NULL }, after = { NULL, NULL };
+    PyObject *result = NULL;
+
+#if PY_MAJOR_VERSION >= 3
+    if ( !PyArg_ParseTuple( args, "sO&O&y*y*O&", &name, hexin_PyArg_count, &crc, hexin_PyArg_count, &offset, &before, &after, hexin_PyArg_count, &total ) ) {
+#else
+    if ( !PyArg_ParseTuple( args, "sO&O&s*s*O&", &name, hexin_PyArg_count, &crc, hexin_PyArg_count, &offset, &before, &after, hexin_PyArg_count, &total ) ) {
+#endif /* PY_MAJOR_VERSION */
+        return NULL;
+    }
+
+    param = hexin_crc16_preset( name );
+    mask  = ( ( param == NULL ) || ( param->width >= 64 ) ) ? ~0ULL : ( ( 1ULL << param->width ) - 1 );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+    } else if ( crc & ~mask ) {
+        PyErr_Format( PyExc_ValueError, "%s is a %u-bit CRC", name, ( unsigned int )param->width );
+    } else if ( before.len != after.len ) {
+        PyErr_SetString( PyExc_ValueError, "old_bytes and new_bytes differ in length" );
+    } else if ( ( offset > total ) || ( ( unsigned long long )before.len > total - offset ) ) {
+        PyErr_SetString( PyExc_ValueError, "the range is out of the message" );
+    } else {
+        result = PyLong_FromUnsignedLongLong( hexin_crc16_update_range( param, ( unsigned short )crc, ( const unsigned char * )before.buf, ( const unsigned char * )after.buf,
+                                                                       ( size_t )before.len, total - offset - ( unsigned long long )before.len ) );
+    }
+    PyBuffer_Release( &before );
+    PyBuffer_Release( &after );
+    return result;
+}
+
+static unsigned long long hexin_crc16_hasher_begin( const void *param )
+{
+    struct _hexin_crc16 local = *( const struct _hexin_crc16 * )param;
+
+    local.is_gradual = FALSE;
+    return hexin_crc16_compute_begin( &local, local.init );
+}
+
+static unsigned long long hexin_crc16_hasher_update( const void *param, unsigned long long crc, const unsigned char *pSrc, size_t len )
+{
+    return hexin_crc16_compute_update( ( const struct _hexin_crc16 * )param, ( unsigned short )crc, pSrc, len );
+}
+
+static unsigned long long hexin_crc16_hasher_end( const void *param, unsigned long long crc )
+{
+    return hexin_crc16_compute_end( ( const struct _hexin_crc16 * )param, ( unsigned short )crc );
+}
+
+static const struct _hexin_hasher_ops crc16_hasher_ops = { hexin_crc16_hasher_begin, hexin_crc16_hasher_update, hexin_crc16_hasher_end };
+
+static PyObject * _crc16_new( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    const struct _hexin_crc16 *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "s", &name ) ) {
+        return NULL;
+    }
+
+    param = hexin_crc16_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+    return hexin_hasher_new( &crc16_hasher_ops, param, name, param->width, NULL );
+}
+
+static PyObject * _crc16_batch( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    PyObject *data = NULL, *out = NULL, *offsets = Py_None, *lengths = Py_None, *expected = Py_None;
+    int rows = 0;
+    const struct _hexin_crc16 *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "sOO|OOOi", &name, &data, &out, &offsets, &lengths, &expected, &rows ) ) {
+        return NULL;
+    }
+
+    param = hexin_crc16_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+    return hexin_batch_compute( &crc16_hasher_ops, param, param->width, data, out,
+                                ( offsets  == Py_None ) ? NULL : offsets,
+                                ( lengths  == Py_None ) ? NULL : lengths,
+                                ( expected == Py_None ) ? NULL : expected, rows );
+}
+
+static PyObject * _crc16_file( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    PyObject *file = NULL;
+    const struct _hexin_crc16 *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "sO", &name, &file ) ) {
+        return NULL;
+    }
+
+    param = hexin_crc16_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+    return hexin_file_compute( &crc16_hasher_ops, param, file );
+}
+
+static PyObject * _crc16_files( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    PyObject *files = NULL;
+    unsigned int threads = 0;
+    const struct _hexin_crc16 *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "sO|O&", &name, &files, hexin_PyArg_threads, &threads ) ) {
+        return NULL;
+    }
+
+    param = hexin_crc16_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+    return hexin_file_compute_many( &crc16_hasher_ops, param, files, threads );
+}
+
+static PyObject * _crc16_capsule( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    const struct _hexin_crc16 *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "s", &name ) ) {
+        return NULL;
+    }
+
+    param = hexin_crc16_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+    return hexin_multi_capsule( &crc16_hasher_ops, param, NULL );
+}
+
+static PyObject * _crc16_kernels( PyObject *self, PyObject *args )
+{
+    return Py_BuildValue( "{s:s}", "crc16", hexin_clmul_kernel() );
+}
+
+static PyObject * _crc16_gil_threshold( PyObject *self, PyObject *args )
+{
+    Py_ssize_t threshold = -1;
+
+    if ( !PyArg_ParseTuple( args, "|n", &threshold ) ) {
+        return NULL;
+    }
+    return PyLong_FromSize_t( hexin_set_gil_threshold( ( threshold < 0 ) ? ( size_t )-1 : ( size_t )threshold ) );
 }
 
 /* method table */
 static PyMethodDef _crc16Methods[] = {
-    { "modbus",      (PyCFunction)_crc16_modbus,    METH_VARARGS, "Calculate MODBUS of CRC16 [Poly=0x8005, Init=0xFFFF Xorout=0x0000 Refin=True Refout=True]" },
-    { "usb16",       (PyCFunction)_crc16_usb,       METH_VARARGS, "Calculate USB of CRC16 [Poly=0x8005, Init=0xFFFF Xorout=0xFFFF Refin=True Refout=True]" },
-    { "ibm",         (PyCFunction)_crc16_ibm,       METH_VARARGS, "Calculate IBM (Alias:ARC/LHA) of CRC16 [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
-    { "arc",         (PyCFunction)_crc16_ibm,       METH_VARARGS, "Calculate ARC (Alias:IBM/LHA) of CRC16 [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
-    { "lha",         (PyCFunction)_crc16_ibm,       METH_VARARGS, "Calculate LHA (Alias:ARC/IBM) of CRC16 [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
-    { "xmodem",      (PyCFunction)_crc16_xmodem,    METH_VARARGS, "Calculate XMODEM of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
-    { "zmodem",      (PyCFunction)_crc16_xmodem,    METH_VARARGS, "Calculate ZMODEM of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
-    { "acorn",       (PyCFunction)_crc16_xmodem,    METH_VARARGS, "Calculate ACORN of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
-    { "v41_msb",     (PyCFunction)_crc16_xmodem,    METH_VARARGS, "Calculate V-41-MSB of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
-    { "lte16",       (PyCFunction)_crc16_xmodem,    METH_VARARGS, "Calculate LTE of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
-    { "ccitt_aug",   (PyCFunction)_crc16_ccitt_aug, METH_VARARGS, "Calculate CCITT-AUG of CRC16 [Poly=0x1021, Init=0x1D0F Xorout=0x0000 Refin=False Refout=False]" },
-    { "spi_fujitsu", (PyCFunction)_crc16_ccitt_aug, METH_VARARGS, "Calculate SPI-FUJITSU of CRC16 [Poly=0x1021, Init=0x1D0F Xorout=0x0000 Refin=False Refout=False]" },
-    { "ccitt_false", (PyCFunction)_crc16_ccitt,     METH_VARARGS, "Calculate CCITT-FALSE of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0x0000 Refin=False Refout=False]" },
-    { "ibm_3740",    (PyCFunction)_crc16_ccitt,     METH_VARARGS, "Calculate IBM-3740 of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0x0000 Refin=False Refout=False]" },
-    { "autosar16",   (PyCFunction)_crc16_ccitt,     METH_VARARGS, "Calculate AUTOSAR of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0x0000 Refin=False Refout=False]" },
-    { "kermit",      (PyCFunction)_crc16_kermit,    METH_VARARGS, "Calculate KERMIT of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
-    { "ccitt_true",  (PyCFunction)_crc16_kermit,    METH_VARARGS, "Calculate CCITT-TRUE of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
-    { "ccitt",       (PyCFunction)_crc16_kermit,    METH_VARARGS, "Calculate CCITT of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
-    { "v41_lsb",     (PyCFunction)_crc16_kermit,    METH_VARARGS, "Calculate V-41-LSB of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
-    { "mcrf4xx",     (PyCFunction)_crc16_mcrf4xx,   METH_VARARGS, "Calculate MCRF4XX of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0x0000 Refin=True Refout=True]" },
-    { "sick",        (PyCFunction)_crc16_sick,      METH_VARARGS, "Calculate SICK of CRC16 [Poly=0x8005, Init=0x0000]" },
-    { "dnp",         (PyCFunction)_crc16_dnp,       METH_VARARGS, "Calculate DNP (Ues:M-Bus, ICE870) of CRC16 [Poly=0x3D65, Init=0x0000 Xorout=0xFFFF Refin=False Refout=False]" },
-    { "x25",         (PyCFunction)_crc16_x25,       METH_VARARGS, "Calculate X25 of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=True Refout=True]" },
-    { "ibm_sdlc",    (PyCFunction)_crc16_x25,       METH_VARARGS, "Calculate IBM-SDLC of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=True Refout=True]" },
-    { "iso_hdlc16",  (PyCFunction)_crc16_x25,       METH_VARARGS, "Calculate ISO-HDLC of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=True Refout=True]" },
-    { "iec14443_3_b",(PyCFunction)_crc16_x25,       METH_VARARGS, "Calculate ISO-IEC-14443-3-B of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=True Refout=True]" },
-    { "maxim16",     (PyCFunction)_crc16_maxim,     METH_VARARGS, "Calculate MAXIM(MAXIM-DOW) of CRC16 [Poly=0x8005, Init=0x0000 Xorout=0xFFFF Refin=True Refout=True]" },
-    { "dect_r",      (PyCFunction)_crc16_dect_r,    METH_VARARGS, "Calculate DECT-R of CRC16 [Poly=0x0589, Init=0x0000 Xorout=0x0001 Refin=False Refout=False]" },
-    { "dect_x",      (PyCFunction)_crc16_dect_x,    METH_VARARGS, "Calculate DECT-X of CRC16 [Poly=0x0589, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "modbus",      (PyCFunction)_crc16_modbus,    HEXIN_METH_FASTCALL, "Calculate MODBUS of CRC16 [Poly=0x8005, Init=0xFFFF Xorout=0x0000 Refin=True Refout=True]" },
+    { "usb16",       (PyCFunction)_crc16_usb,       HEXIN_METH_FASTCALL, "Calculate USB of CRC16 [Poly=0x8005, Init=0xFFFF Xorout=0xFFFF Refin=True Refout=True]" },
+    { "ibm",         (PyCFunction)_crc16_ibm,       HEXIN_METH_FASTCALL, "Calculate IBM (Alias:ARC/LHA) of CRC16 [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
+    { "arc",         (PyCFunction)_crc16_ibm,       HEXIN_METH_FASTCALL, "Calculate ARC (Alias:IBM/LHA) of CRC16 [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
+    { "lha",         (PyCFunction)_crc16_ibm,       HEXIN_METH_FASTCALL, "Calculate LHA (Alias:ARC/IBM) of CRC16 [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
+    { "xmodem",      (PyCFunction)_crc16_xmodem,    HEXIN_METH_FASTCALL, "Calculate XMODEM of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "zmodem",      (PyCFunction)_crc16_xmodem,    HEXIN_METH_FASTCALL, "Calculate ZMODEM of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "acorn",       (PyCFunction)_crc16_xmodem,    HEXIN_METH_FASTCALL, "Calculate ACORN of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "v41_msb",     (PyCFunction)_crc16_xmodem,    HEXIN_METH_FASTCALL, "Calculate V-41-MSB of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "lte16",       (PyCFunction)_crc16_xmodem,    HEXIN_METH_FASTCALL, "Calculate LTE of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "ccitt_aug",   (PyCFunction)_crc16_ccitt_aug, HEXIN_METH_FASTCALL, "Calculate CCITT-AUG of CRC16 [Poly=0x1021, Init=0x1D0F Xorout=0x0000 Refin=False Refout=False]" },
+    { "spi_fujitsu", (PyCFunction)_crc16_ccitt_aug, HEXIN_METH_FASTCALL, "Calculate SPI-FUJITSU of CRC16 [Poly=0x1021, Init=0x1D0F Xorout=0x0000 Refin=False Refout=False]" },
+    { "ccitt_false", (PyCFunction)_crc16_ccitt,     HEXIN_METH_FASTCALL, "Calculate CCITT-FALSE of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0x0000 Refin=False Refout=False]" },
+    { "ibm_3740",    (PyCFunction)_crc16_ccitt,     HEXIN_METH_FASTCALL, "Calculate IBM-3740 of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0x0000 Refin=False Refout=False]" },
+    { "autosar16",   (PyCFunction)_crc16_ccitt,     HEXIN_METH_FASTCALL, "Calculate AUTOSAR of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0x0000 Refin=False Refout=False]" },
+    { "kermit",      (PyCFunction)_crc16_kermit,    HEXIN_METH_FASTCALL, "Calculate KERMIT of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
+    { "ccitt_true",  (PyCFunction)_crc16_kermit,    HEXIN_METH_FASTCALL, "Calculate CCITT-TRUE of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
+    { "ccitt",       (PyCFunction)_crc16_kermit,    HEXIN_METH_FASTCALL, "Calculate CCITT of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
+    { "v41_lsb",     (PyCFunction)_crc16_kermit,    HEXIN_METH_FASTCALL, "Calculate V-41-LSB of CRC16 [Poly=0x1021, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
+    { "mcrf4xx",     (PyCFunction)_crc16_mcrf4xx,   HEXIN_METH_FASTCALL, "Calculate MCRF4XX of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0x0000 Refin=True Refout=True]" },
+    { "sick",        (PyCFunction)_crc16_sick,      HEXIN_METH_FASTCALL, "Calculate SICK of CRC16 [Poly=0x8005, Init=0x0000]" },
+    { "dnp",         (PyCFunction)_crc16_dnp,       HEXIN_METH_FASTCALL, "Calculate DNP (Ues:M-Bus, ICE870) of CRC16 [Poly=0x3D65, Init=0x0000 Xorout=0xFFFF Refin=False Refout=False]" },
+    { "x25",         (PyCFunction)_crc16_x25,       HEXIN_METH_FASTCALL, "Calculate X25 of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=True Refout=True]" },
+    { "ibm_sdlc",    (PyCFunction)_crc16_x25,       HEXIN_METH_FASTCALL, "Calculate IBM-SDLC of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=True Refout=True]" },
+    { "iso_hdlc16",  (PyCFunction)_crc16_x25,       HEXIN_METH_FASTCALL, "Calculate ISO-HDLC of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=True Refout=True]" },
+    { "iec14443_3_b",(PyCFunction)_crc16_x25,       HEXIN_METH_FASTCALL, "Calculate ISO-IEC-14443-3-B of CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=True Refout=True]" },
+    { "maxim16",     (PyCFunction)_crc16_maxim,     HEXIN_METH_FASTCALL, "Calculate MAXIM(MAXIM-DOW) of CRC16 [Poly=0x8005, Init=0x0000 Xorout=0xFFFF Refin=True Refout=True]" },
+    { "dect_r",      (PyCFunction)_crc16_dect_r,    HEXIN_METH_FASTCALL, "Calculate DECT-R of CRC16 [Poly=0x0589, Init=0x0000 Xorout=0x0001 Refin=False Refout=False]" },
+    { "dect_x",      (PyCFunction)_crc16_dect_x,    HEXIN_METH_FASTCALL, "Calculate DECT-X of CRC16 [Poly=0x0589, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
     { "table16",     (PyCFunction)_crc16_table,     METH_VARARGS, "Print CRC16 table to list. libscrc.table16( polynomial )" },
-    { "hacker16",    (PyCFunction)_crc16_hacker,    METH_KEYWORDS|METH_VARARGS, "User calculation CRC16\n"
+    { "hacker16",    (PyCFunction)_crc16_hacker,    HEXIN_METH_FASTCALL, "User calculation CRC16\n"
                                                                                 "@data   : bytes\n"
                                                                                 "@poly   : default=0x8050\n"
                                                                                 "@init   : default=0xFFFF\n"
@@ -805,34 +1291,47 @@ static PyMethodDef _crc16Methods[] = {
                                                                                 "@refin  : default=True\n"
                                                                                 "@refout : default=True\n"
                                                                                 "@reinit : default=False" },
-    { "udp",         (PyCFunction)_crc16_network,    METH_VARARGS, "Calculate UDP checksum." },
-    { "tcp",         (PyCFunction)_crc16_network,    METH_VARARGS, "Calculate TCP checksum." },
-    { "fletcher16",  (PyCFunction)_crc16_fletcher,   METH_VARARGS, "Calculate FLETCHER16" },
-    { "epc16",       (PyCFunction)_crc16_rfid_epc,   METH_VARARGS, "Calculate RFID EPC CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]" },
-    { "profibus",    (PyCFunction)_crc16_profibus,   METH_VARARGS, "Calculate PROFIBUS of CRC16 [Poly=0x1DCF, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]" },
-    { "buypass",     (PyCFunction)_crc16_buypass,    METH_VARARGS, "Calculate BUYPASS [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
-    { "umts",        (PyCFunction)_crc16_buypass,    METH_VARARGS, "Calculate UMTS [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
-    { "verifone",    (PyCFunction)_crc16_buypass,    METH_VARARGS, "Calculate VERIFONE [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
-    { "genibus",     (PyCFunction)_crc16_rfid_epc,   METH_VARARGS, "Calculate GENIBUS [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]" },
-    { "darc",        (PyCFunction)_crc16_rfid_epc,   METH_VARARGS, "Calculate DARC [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]" },
-    { "epc_c1g2",    (PyCFunction)_crc16_rfid_epc,   METH_VARARGS, "Calculate EPC-C1G2 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]" },
-    { "icode16",     (PyCFunction)_crc16_rfid_epc,   METH_VARARGS, "Calculate I-CODE16 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]" },
-    { "gsm16",       (PyCFunction)_crc16_gsm16,      METH_VARARGS, "Calculate GSM16 [Poly=0x1021, Init=0x0000 Xorout=0xFFFF Refin=False Refout=False]" },
-    { "riello",      (PyCFunction)_crc16_riello,     METH_VARARGS, "Calculate RIELLO [Poly=0x1021, Init=0xB2AA Xorout=0x0000 Refin=True Refout=True]" },
-    { "crc16_a",     (PyCFunction)_crc16_crc16_a,    METH_VARARGS, "Calculate CRC16-A [Poly=0x1021, Init=0xC6C6 Xorout=0x0000 Refin=True Refout=True]" },
-    { "iec14443_3_a",(PyCFunction)_crc16_crc16_a,    METH_VARARGS, "Calculate ISO-IEC-14443-3-A [Poly=0x1021, Init=0xC6C6 Xorout=0x0000 Refin=True Refout=True]" },
-    { "cdma2000",    (PyCFunction)_crc16_cdma2000,   METH_VARARGS, "Calculate CDMA2000 [Poly=0xC867, Init=0xFFFF Xorout=0x0000 Refin=False Refout=False]" },
-    { "teledisk",    (PyCFunction)_crc16_teledisk,   METH_VARARGS, "Calculate TELEDISK [Poly=0xA097, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
-    { "tms37157",    (PyCFunction)_crc16_tms37157,   METH_VARARGS, "Calculate TMS37157 [Poly=0x1021, Init=0x89EC Xorout=0x0000 Refin=True Refout=True]" },
-    { "en13757",     (PyCFunction)_crc16_en13757,    METH_VARARGS, "Calculate EN13757(Used in the Wireless M-Bus protocol for remote meter reading) [Poly=0x3D65, Init=0x0000 Xorout=0xFFFF Refin=False Refout=False]" },
-    { "t10_dif",     (PyCFunction)_crc16_t10_dif,    METH_VARARGS, "Calculate T10-DIF [Poly=0x8BB7, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
-    { "dds_110",     (PyCFunction)_crc16_dds_110,    METH_VARARGS, "Calculate DDS-110 [Poly=0x8005, Init=0x800D Xorout=0x0000 Refin=False Refout=False]" },
-    { "cms",         (PyCFunction)_crc16_cms,        METH_VARARGS, "Calculate CMS [Poly=0x8005, Init=0xFFFF Xorout=0x0000 Refin=False Refout=False]" },
-    { "lj1200",      (PyCFunction)_crc16_lj1200,     METH_VARARGS, "Calculate LJ1200 [Poly=0x6F63, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
-    { "nrsc5",       (PyCFunction)_crc16_nrsc5,      METH_VARARGS, "Calculate NRSC-5 [Poly=0x080B, Init=0xFFFF Xorout=0x0000 Refin=True Refout=True]" },
+    { "udp",         (PyCFunction)_crc16_network,    HEXIN_METH_FASTCALL, "Calculate UDP checksum." },
+    { "tcp",         (PyCFunction)_crc16_network,    HEXIN_METH_FASTCALL, "Calculate TCP checksum." },
+    { "fletcher16",  (PyCFunction)_crc16_fletcher,   HEXIN_METH_FASTCALL, "Calculate FLETCHER16" },
+    { "epc16",       (PyCFunction)_crc16_rfid_epc,   HEXIN_METH_FASTCALL, "Calculate RFID EPC CRC16 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]" },
+    { "profibus",    (PyCFunction)_crc16_profibus,   HEXIN_METH_FASTCALL, "Calculate PROFIBUS of CRC16 [Poly=0x1DCF, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]" },
+    { "buypass",     (PyCFunction)_crc16_buypass,    HEXIN_METH_FASTCALL, "Calculate BUYPASS [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "umts",        (PyCFunction)_crc16_buypass,    HEXIN_METH_FASTCALL, "Calculate UMTS [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "verifone",    (PyCFunction)_crc16_buypass,    HEXIN_METH_FASTCALL, "Calculate VERIFONE [Poly=0x8005, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "genibus",     (PyCFunction)_crc16_rfid_epc,   HEXIN_METH_FASTCALL, "Calculate GENIBUS [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]" },
+    { "darc",        (PyCFunction)_crc16_rfid_epc,   HEXIN_METH_FASTCALL, "Calculate DARC [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]" },
+    { "epc_c1g2",    (PyCFunction)_crc16_rfid_epc,   HEXIN_METH_FASTCALL, "Calculate EPC-C1G2 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]" },
+    { "icode16",     (PyCFunction)_crc16_rfid_epc,   HEXIN_METH_FASTCALL, "Calculate I-CODE16 [Poly=0x1021, Init=0xFFFF Xorout=0xFFFF Refin=False Refout=False]" },
+    { "gsm16",       (PyCFunction)_crc16_gsm16,      HEXIN_METH_FASTCALL, "Calculate GSM16 [Poly=0x1021, Init=0x0000 Xorout=0xFFFF Refin=False Refout=False]" },
+    { "riello",      (PyCFunction)_crc16_riello,     HEXIN_METH_FASTCALL, "Calculate RIELLO [Poly=0x1021, Init=0xB2AA Xorout=0x0000 Refin=True Refout=True]" },
+    { "crc16_a",     (PyCFunction)_crc16_crc16_a,    HEXIN_METH_FASTCALL, "Calculate CRC16-A [Poly=0x1021, Init=0xC6C6 Xorout=0x0000 Refin=True Refout=True]" },
+    { "iec14443_3_a",(PyCFunction)_crc16_crc16_a,    HEXIN_METH_FASTCALL, "Calculate ISO-IEC-14443-3-A [Poly=0x1021, Init=0xC6C6 Xorout=0x0000 Refin=True Refout=True]" },
+    { "cdma2000",    (PyCFunction)_crc16_cdma2000,   HEXIN_METH_FASTCALL, "Calculate CDMA2000 [Poly=0xC867, Init=0xFFFF Xorout=0x0000 Refin=False Refout=False]" },
+    { "teledisk",    (PyCFunction)_crc16_teledisk,   HEXIN_METH_FASTCALL, "Calculate TELEDISK [Poly=0xA097, Init=0x0000 Xorout=0x0000 Refin=True Refout=True]" },
+    { "tms37157",    (PyCFunction)_crc16_tms37157,   HEXIN_METH_FASTCALL, "Calculate TMS37157 [Poly=0x1021, Init=0x89EC Xorout=0x0000 Refin=True Refout=True]" },
+    { "en13757",     (PyCFunction)_crc16_en13757,    HEXIN_METH_FASTCALL, "Calculate EN13757(Used in the Wireless M-Bus protocol for remote meter reading) [Poly=0x3D65, Init=0x0000 Xorout=0xFFFF Refin=False Refout=False]" },
+    { "t10_dif",     (PyCFunction)_crc16_t10_dif,    HEXIN_METH_FASTCALL, "Calculate T10-DIF [Poly=0x8BB7, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "dds_110",     (PyCFunction)_crc16_dds_110,    HEXIN_METH_FASTCALL, "Calculate DDS-110 [Poly=0x8005, Init=0x800D Xorout=0x0000 Refin=False Refout=False]" },
+    { "cms",         (PyCFunction)_crc16_cms,        HEXIN_METH_FASTCALL, "Calculate CMS [Poly=0x8005, Init=0xFFFF Xorout=0x0000 Refin=False Refout=False]" },
+    { "lj1200",      (PyCFunction)_crc16_lj1200,     HEXIN_METH_FASTCALL, "Calculate LJ1200 [Poly=0x6F63, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "nrsc5",       (PyCFunction)_crc16_nrsc5,      HEXIN_METH_FASTCALL, "Calculate NRSC-5 [Poly=0x080B, Init=0xFFFF Xorout=0x0000 Refin=True Refout=True]" },
     
-    { "opensafety_a",   (PyCFunction)_crc16_opensafety_a,   METH_VARARGS, "Calculate OPENSAFETY-A [Poly=0x5935, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
-    { "opensafety_b",   (PyCFunction)_crc16_opensafety_b,   METH_VARARGS, "Calculate OPENSAFETY-B [Poly=0x755B, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "opensafety_a",   (PyCFunction)_crc16_opensafety_a,   HEXIN_METH_FASTCALL, "Calculate OPENSAFETY-A [Poly=0x5935, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "opensafety_b",   (PyCFunction)_crc16_opensafety_b,   HEXIN_METH_FASTCALL, "Calculate OPENSAFETY-B [Poly=0x755B, Init=0x0000 Xorout=0x0000 Refin=False Refout=False]" },
+    { "_kernels",    (PyCFunction)_crc16_kernels, METH_NOARGS, "The kernel tier every family of this module is bound to." },
+    { "_gil_threshold", (PyCFunction)_crc16_gil_threshold, METH_VARARGS, "Release the GIL for buffers of at least this many bytes, returns the previous value." },
+    { "_presets",    (PyCFunction)_crc16_presets_list, METH_NOARGS, "The names of the presets of this module." },
+    { "_combine",    (PyCFunction)_crc16_combine, METH_VARARGS, "CRC( A || B ) of a preset : _combine( name, crc_a, crc_b, len_b )" },
+    { "_extend_zeros",  (PyCFunction)_crc16_extend_zeros,  METH_VARARGS, "CRC( A || n zero bytes ) : _extend_zeros( name, crc, n )" },
+    { "_extend_repeat", (PyCFunction)_crc16_extend_repeat, METH_VARARGS, "CRC( A || block * count ) : _extend_repeat( name, crc, block, count )" },
+    { "_update_range",  (PyCFunction)_crc16_update_range,  METH_VARARGS, "CRC after a range was rewritten : _update_range( name, crc, offset, old, new, total_len )" },
+    { "_new",        (PyCFunction)_crc16_new, METH_VARARGS, "A hashlib-style hasher of a preset : _new( name )" },
+    { "_batch",      (PyCFunction)_crc16_batch, METH_VARARGS, "CRC of many buffers into an integer array : _batch( name, data, out, offsets, lengths, expected, rows )" },
+    { "_file",       (PyCFunction)_crc16_file, METH_VARARGS, "CRC of a file without the GIL : _file( name, path or fd )" },
+    { "_files",      (PyCFunction)_crc16_files, METH_VARARGS, "( crc, size ) of many files on a thread pool : _files( name, files, threads=0 )" },
+    { "_capsule",    (PyCFunction)_crc16_capsule, METH_VARARGS, "The kernel of a preset for _multi : _capsule( name )" },
+    { "_multi",      (PyCFunction)hexin_multi_compute, METH_VARARGS, "Many CRCs of data in one pass : _multi( data, capsules )" },
     { NULL, NULL, 0, NULL }        /* Sentinel */
 };
 
@@ -909,13 +1408,32 @@ PyInit__crc16( void )
     PyObject *m;
 
     m = PyModule_Create( &_crc16module );
-    if (m == NULL) {
+    if ( m == NULL ) {
+        return NULL;
+    }
+
+    if ( ( hexin_hasher_ready( m ) < 0 ) || ( hexin_hacker_ready( &crc16_hacker_cache ) < 0 ) ) {
+        Py_DECREF( m );
         return NULL;
     }
 
     PyModule_AddStringConstant( m, "__version__", "1.7"   );
     PyModule_AddStringConstant( m, "__author__",  "Heyn"  );
 
+    /* Probe the CPU once and pick the kernel tier ( AVX-512 / PCLMULQDQ / tables ), LIBSCRC_KERNEL may lower it. */
+    hexin_clmul_level();
+    hexin_gil_threshold();
+
+    if ( !hexin_kernel_is_known() && ( PyErr_WarnEx( PyExc_RuntimeWarning, HEXIN_KERNEL_UNKNOWN, 1 ) < 0 ) ) {
+        Py_DECREF( m );
+        return NULL;
+    }
+
+#ifdef Py_GIL_DISABLED
+    /* The presets are read-only and every call keeps its state on the stack. */
+    PyUnstable_Module_SetGIL( m, Py_MOD_GIL_NOT_USED );
+#endif
+
     return m;
 }
 
@@ -925,7 +1443,12 @@ PyInit__crc16( void )
 PyMODINIT_FUNC
 init_crc16( void )
 {
-    (void) Py_InitModule3( "_crc16", _crc16Methods, _crc16_doc );
+    PyObject *m = Py_InitModule3( "_crc16", _crc16Methods, _crc16_doc );
+
+    if ( m != NULL ) {
+        hexin_hasher_ready( m );
+        hexin_hacker_ready( &crc16_hacker_cache );
+    }
 }
 
 #endif /* PY_MAJOR_VERSION */
@@ -35,12 +35,11 @@ static unsigned char __hexin_reverse8( unsigned char data )
 
 unsigned short hexin_reverse16( unsigned short data )
 {
-    unsigned int   i = 0;
-    unsigned short t = 0;
-    for ( i=0; i<16; i++ ) {
-        t |= ( ( data >> i ) & 0x0001 ) << ( 15-i );
-    }
-    return t;
+    unsigned int t = data;
+    t = ( ( t >> 1 ) & 0x5555 ) | ( ( t & 0x5555 ) << 1 );
+    t = ( ( t >> 2 ) & 0x3333 ) | ( ( t & 0x3333 ) << 2 );
+    t = ( ( t >> 4 ) & 0x0F0F ) | ( ( t & 0x0F0F ) << 4 );
+    return ( unsigned short )( ( ( t >> 8 ) & 0x00FF ) | ( ( t & 0x00FF ) << 8 ) );
 }
 
 unsigned int hexin_crc16_init_table_poly_is_high( unsigned short polynomial, unsigned short *table )
@@ -120,9 +119,9 @@ static unsigned short __hexin_crc16_sick( unsigned short crc16, unsigned char c,
     return crc;
 }
 
-unsigned short hexin_calc_crc16_sick( const unsigned char *pSrc, unsigned int len, unsigned short crc16 )
+unsigned short hexin_calc_crc16_sick( const unsigned char *pSrc, size_t len, unsigned short crc16 )
 {
-    unsigned int   i            = 0;
+    size_t   i            = 0;
 			 char  prev_byte	= 0x00;
 	unsigned short crc		    = crc16;
 
@@ -134,7 +133,7 @@ unsigned short hexin_calc_crc16_sick( const unsigned char *pSrc, unsigned int le
 	return crc;
 }
 
-unsigned short hexin_calc_crc16_network( const unsigned char *pSrc, unsigned int len, unsigned short crc16 /*reserved*/ )
+unsigned short hexin_calc_crc16_network( const unsigned char *pSrc, size_t len, unsigned short crc16 /*reserved*/ )
 {
     unsigned int sum = 0;
 
@@ -155,9 +154,9 @@ unsigned short hexin_calc_crc16_network( const unsigned char *pSrc, unsigned int
     return ( unsigned short )( ~sum );
 }
 
-unsigned short hexin_calc_crc16_fletcher( const unsigned char *pSrc, unsigned int len, unsigned short crc16 /*reserved*/ )
+unsigned short hexin_calc_crc16_fletcher( const unsigned char *pSrc, size_t len, unsigned short crc16 /*reserved*/ )
 {
-    unsigned int i = 0;
+    size_t i = 0;
     unsigned short sum1 = 0, sum2 = 0;
 
     for ( i = 0; i < len; i++ ) {
@@ -167,11 +166,29 @@ unsigned short hexin_calc_crc16_fletcher( const unsigned char *pSrc, unsigned in
     return ( sum1 & 0xFF ) | ( sum2 << 8 );
 }
 
-static unsigned int hexin_crc16_compute_init_table( struct _hexin_crc16 *param )
+unsigned int hexin_crc16_compute_init_table( struct _hexin_crc16 *param, unsigned short (*table)[MAX_TABLE_ARRAY], struct _hexin_clmul *clmul )
 {
     unsigned int i = 0, j = 0;
     unsigned short crc = 0, c = 0;
 
+    param->table = ( const unsigned short (*)[MAX_TABLE_ARRAY] )table;
+    param->clmul = clmul;
+
+    /* The folding kernel takes the left-aligned polynomial in either orientation. */
+    hexin_clmul_init( clmul, ( unsigned long long )param->poly << 48 );
+
+    if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
+        hexin_crc16_init_table_poly_is_high( hexin_reverse16( param->poly ), table[0] );
+        for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
+            crc = table[0][i];
+            for ( j=1; j<MAX_SLICING_ARRAY; j++ ) {
+                crc = ( crc >> 8 ) ^ table[0][ crc & 0xFF ];
+                table[j][i] = crc;
+            }
+        }
+        return HEXIN_TABLE_IS_REFLECTED;
+    }
+
     for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
         crc = 0;
         c   = ( ( unsigned short ) i ) << 8;
@@ -180,31 +197,76 @@ static unsigned int hexin_crc16_compute_init_table( struct _hexin_crc16 *param )
             else                      crc =   crc << 1;
             c = c << 1;
         }
-        param->table[i] = crc;
+        table[0][i] = crc;
     }
 
-    return TRUE;
+    /* Slicing tables : table[k][i] is the CRC of byte i followed by k zero bytes. */
+    for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
+        crc = table[0][i];
+        for ( j=1; j<MAX_SLICING_ARRAY; j++ ) {
+            crc = ( crc << 8 ) ^ table[0][ crc >> 8 ];
+            table[j][i] = crc;
+        }
+    }
+
+    return HEXIN_TABLE_IS_NORMAL;
 }
 
-static unsigned short hexin_crc16_compute_char( unsigned short crc16, unsigned char c, struct _hexin_crc16 *param )
+static unsigned short hexin_crc16_compute_char( unsigned short crc16, unsigned char c, const struct _hexin_crc16 *param )
 {
     unsigned short crc = crc16;
-    crc = (crc << 8) ^ param->table[ ((crc >> 8 ) ^ (0x00FF & (unsigned short)c)) & 0xFF ];
+    crc = (crc << 8) ^ param->table[0][ ((crc >> 8 ) ^ (0x00FF & (unsigned short)c)) & 0xFF ];
     return crc;
 }
 
-unsigned short hexin_crc16_compute( const unsigned char *pSrc, unsigned int len, struct _hexin_crc16 *param, unsigned short init )
+static unsigned short hexin_crc16_compute_slicing8( unsigned short crc, const unsigned char *p, const unsigned short (*table)[MAX_TABLE_ARRAY] )
+{
+    crc ^= ( unsigned short )( ( p[0] << 8 ) | p[1] );
+    return table[7][ crc >> 8 ] ^ table[6][ crc & 0xFF ]
+         ^ table[5][ p[2] ] ^ table[4][ p[3] ] ^ table[3][ p[4] ] ^ table[2][ p[5] ] ^ table[1][ p[6] ] ^ table[0][ p[7] ];
+}
+
+static unsigned short hexin_crc16_compute_slicing16( unsigned short crc, const unsigned char *p, const unsigned short (*table)[MAX_TABLE_ARRAY] )
 {
-    unsigned int i = 0;
-    unsigned short crc = init;              /* Fixed Issues #4  */
+    crc ^= ( unsigned short )( ( p[0] << 8 ) | p[1] );
+    return table[15][ crc >> 8 ] ^ table[14][ crc & 0xFF ]
+         ^ table[13][ p[2]  ] ^ table[12][ p[3]  ] ^ table[11][ p[4]  ] ^ table[10][ p[5]  ]
+         ^ table[9][  p[6]  ] ^ table[8][  p[7]  ] ^ table[7][  p[8]  ] ^ table[6][  p[9]  ]
+         ^ table[5][  p[10] ] ^ table[4][  p[11] ] ^ table[3][  p[12] ] ^ table[2][  p[13] ]
+         ^ table[1][  p[14] ] ^ table[0][  p[15] ];
+}
 
-    if ( param->is_initial == FALSE ) {
-        param->is_initial = hexin_crc16_compute_init_table( param );
+/*
+ * Slicing-by-16 over the bulk of the buffer, one slicing-by-8 step and the byte loop for the tail.
+ */
+static unsigned short hexin_crc16_compute_slicing( unsigned short crc, const unsigned char *pSrc, size_t len, const struct _hexin_crc16 *param )
+{
+    size_t        i = 0;
+    unsigned char buffer[MAX_SLICING_ARRAY];
+    const unsigned short (*table)[MAX_TABLE_ARRAY] = param->table;
+
+    for ( ; len >= 16; len -= 16, pSrc += 16 ) {
+        if ( HEXIN_REFIN_IS_TRUE( param ) ) {
+            for ( i=0; i<16; i++ ) {
+                buffer[i] = __hexin_reverse8( pSrc[i] );
+            }
+            crc = hexin_crc16_compute_slicing16( crc, buffer, table );
+        } else {
+            crc = hexin_crc16_compute_slicing16( crc, pSrc, table );
+        }
     }
 
-    /* Fixed Issues #4 #8 */
-    if ( HEXIN_REFOUT_IS_TRUE( param ) && ( HEXIN_GRADUAL_CALCULATE_IS_TRUE( param ) ) ) { 
-        crc = hexin_reverse16( init );
+    if ( len >= 8 ) {
+        if ( HEXIN_REFIN_IS_TRUE( param ) ) {
+            for ( i=0; i<8; i++ ) {
+                buffer[i] = __hexin_reverse8( pSrc[i] );
+            }
+            crc = hexin_crc16_compute_slicing8( crc, buffer, table );
+        } else {
+            crc = hexin_crc16_compute_slicing8( crc, pSrc, table );
+        }
+        len  -= 8;
+        pSrc += 8;
     }
 
     /* Fixed Issues #8 */
@@ -218,10 +280,211 @@ unsigned short hexin_crc16_compute( const unsigned char *pSrc, unsigned int len,
         }
     }
 
+    return crc;
+}
+
+static unsigned short hexin_crc16_compute_slicing8_reflected( unsigned short crc, const unsigned char *p, const unsigned short (*table)[MAX_TABLE_ARRAY] )
+{
+    crc ^= ( unsigned short )( ( p[1] << 8 ) | p[0] );
+    return table[7][ crc & 0xFF ] ^ table[6][ crc >> 8 ]
+         ^ table[5][ p[2] ] ^ table[4][ p[3] ] ^ table[3][ p[4] ] ^ table[2][ p[5] ] ^ table[1][ p[6] ] ^ table[0][ p[7] ];
+}
+
+static unsigned short hexin_crc16_compute_slicing16_reflected( unsigned short crc, const unsigned char *p, const unsigned short (*table)[MAX_TABLE_ARRAY] )
+{
+    crc ^= ( unsigned short )( ( p[1] << 8 ) | p[0] );
+    return table[15][ crc & 0xFF ] ^ table[14][ crc >> 8 ]
+         ^ table[13][ p[2]  ] ^ table[12][ p[3]  ] ^ table[11][ p[4]  ] ^ table[10][ p[5]  ]
+         ^ table[9][  p[6]  ] ^ table[8][  p[7]  ] ^ table[7][  p[8]  ] ^ table[6][  p[9]  ]
+         ^ table[5][  p[10] ] ^ table[4][  p[11] ] ^ table[3][  p[12] ] ^ table[2][  p[13] ]
+         ^ table[1][  p[14] ] ^ table[0][  p[15] ];
+}
+
+/*
+ * Right-shifting register over the reflected tables : the input bytes are used as they are.
+ */
+static unsigned short hexin_crc16_compute_slicing_reflected( unsigned short crc, const unsigned char *pSrc, size_t len, const struct _hexin_crc16 *param )
+{
+    size_t i = 0;
+    const unsigned short (*table)[MAX_TABLE_ARRAY] = param->table;
+
+    for ( ; len >= 16; len -= 16, pSrc += 16 ) {
+        crc = hexin_crc16_compute_slicing16_reflected( crc, pSrc, table );
+    }
+
+    if ( len >= 8 ) {
+        crc   = hexin_crc16_compute_slicing8_reflected( crc, pSrc, table );
+        len  -= 8;
+        pSrc += 8;
+    }
+
+    for ( i=0; i<len; i++ ) {
+        crc = ( crc >> 8 ) ^ table[0][ ( crc ^ pSrc[i] ) & 0xFF ];
+    }
+
+    return crc;
+}
+
+/*
+ * Carry-less multiplication folding over the 16-byte aligned bulk, when the CPU supports PCLMULQDQ.
+ */
+static unsigned short hexin_crc16_compute_clmul( unsigned short crc, const unsigned char *pSrc, size_t len, const struct _hexin_crc16 *param )
+{
+    if ( HEXIN_REFIN_IS_TRUE( param ) ) {
+        return hexin_reverse16( ( unsigned short )hexin_clmul_compute( param->clmul, hexin_reverse16( crc ), pSrc, len, TRUE ) );
+    }
+    return ( unsigned short )( hexin_clmul_compute( param->clmul, ( unsigned long long )crc << 48, pSrc, len, FALSE ) >> 48 );
+}
+
+/*
+ * The register of a new calculation, or of a gradual one ( is_gradual, init = crc ^ xorout ).
+ */
+unsigned short hexin_crc16_compute_begin( const struct _hexin_crc16 *param, unsigned short init )
+{
+    if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
+        return HEXIN_GRADUAL_CALCULATE_IS_TRUE( param ) ? init : hexin_reverse16( init );
+    }
+
+    /* Fixed Issues #4 #8 */
+    if ( HEXIN_REFOUT_IS_TRUE( param ) && ( HEXIN_GRADUAL_CALCULATE_IS_TRUE( param ) ) ) {
+        return hexin_reverse16( init );
+    }
+    return init;
+}
+
+/*
+ * Feed the register, no fix-up between two calls.
+ */
+unsigned short hexin_crc16_compute_update( const struct _hexin_crc16 *param, unsigned short crc, const unsigned char *pSrc, size_t len )
+{
+    if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
+        if ( ( len >= HEXIN_CLMUL_MIN_LENGTH ) && hexin_clmul_is_supported() ) {
+            crc   = ( unsigned short )hexin_clmul_compute( param->clmul, crc, pSrc, len & ~( size_t )15, TRUE );
+            pSrc += len & ~( size_t )15;
+            len  &= 15U;
+        }
+        return hexin_crc16_compute_slicing_reflected( crc, pSrc, len, param );
+    }
+
+    if ( ( len >= HEXIN_CLMUL_MIN_LENGTH ) && hexin_clmul_is_supported() ) {
+        crc   = hexin_crc16_compute_clmul( crc, pSrc, len & ~( size_t )15, param );
+        pSrc += len & ~( size_t )15;
+        len  &= 15U;
+    }
+    return hexin_crc16_compute_slicing( crc, pSrc, len, param );
+}
+
+/*
+ * The CRC of the register : refout and xorout.
+ */
+unsigned short hexin_crc16_compute_end( const struct _hexin_crc16 *param, unsigned short crc )
+{
     /* Fixed Issues #8 */
-    if ( HEXIN_REFOUT_IS_TRUE( param ) ) {
+    if ( HEXIN_REFOUT_IS_TRUE( param ) && !HEXIN_REFIN_IS_TRUE( param ) ) {
         crc = hexin_reverse16( crc );
     }
+    return ( crc ^ param->xorout );
+}
+
+unsigned short hexin_crc16_compute( const unsigned char *pSrc, size_t len, const struct _hexin_crc16 *param, unsigned short init )
+{
+    unsigned short crc = hexin_crc16_compute_begin( param, init );
+
+    crc = hexin_crc16_compute_update( param, crc, pSrc, len );
+    return hexin_crc16_compute_end( param, crc );
+}
+
+static unsigned long long hexin_crc16_compute_chunk( const void *param, const unsigned char *pSrc, size_t len, unsigned long long init )
+{
+    return hexin_crc16_compute( pSrc, len, ( const struct _hexin_crc16 * )param, ( unsigned short )init );
+}
+
+/*
+ * Split the buffer over threads ( 0 : every CPU ), the result is the same as hexin_crc16_compute().
+ */
+unsigned short hexin_crc16_compute_parallel( const unsigned char *pSrc, size_t len, const struct _hexin_crc16 *param, unsigned short init, unsigned int threads )
+{
+    struct _hexin_crc16 rest = *param;
+    struct _hexin_parallel job = { .compute = hexin_crc16_compute_chunk,
+                                   .first   = param,
+                                   .rest    = &rest,
+                                   .combine = param->combine,
+                                   .init    = init,
+                                   .reinit  = param->init,
+                                   .width   = param->width,
+                                   .poly    = param->poly,
+                                   .refout  = param->refout };
+
+    rest.is_gradual = FALSE;
+    return ( unsigned short )hexin_parallel_compute( &job, pSrc, len, threads );
+}
 
-	return ( crc ^ param->xorout );
+/*
+ * CRC( A || B ) from CRC( A ), CRC( B ) and len( B ), O( log( len_b ) ).
+ */
+unsigned short hexin_crc16_combine( const struct _hexin_crc16 *param, unsigned short crc_a, unsigned short crc_b, unsigned long long len_b )
+{
+    struct _hexin_crc16 local = *param;
+    struct _hexin_combine combine;
+    unsigned short empty = 0;
+
+    local.is_gradual = FALSE;
+    empty = hexin_crc16_compute( ( const unsigned char * )"", 0, &local, local.init );
+
+    if ( param->combine == NULL ) {
+        hexin_combine_init( &combine, param->width, param->poly );
+    }
+    return ( unsigned short )hexin_combine( ( param->combine != NULL ) ? param->combine : &combine, param->refout, crc_a, crc_b, len_b, empty );
+}
+
+/*
+ * CRC( A || len zero bytes ) from CRC( A ), O( log( len ) ).
+ */
+unsigned short hexin_crc16_extend_zeros( const struct _hexin_crc16 *param, unsigned short crc, unsigned long long len )
+{
+    struct _hexin_combine combine;
+
+    if ( param->combine == NULL ) {
+        hexin_combine_init( &combine, param->width, param->poly );
+    }
+    return ( unsigned short )hexin_combine_zeros( ( param->combine != NULL ) ? param->combine : &combine, param->refout, crc, len, param->xorout );
+}
+
+/*
+ * CRC( A || count copies of block ) from CRC( A ), one pass over the block and O( log( count ) ).
+ */
+unsigned short hexin_crc16_extend_repeat( const struct _hexin_crc16 *param, unsigned short crc, const unsigned char *pBlock, size_t len, unsigned long long count )
+{
+    struct _hexin_crc16 local = *param;
+    struct _hexin_combine combine;
+    unsigned short empty = 0, block = 0;
+
+    local.is_gradual = FALSE;
+    empty = hexin_crc16_compute( ( const unsigned char * )"", 0, &local, local.init );
+    block = hexin_crc16_compute( pBlock, len, &local, local.init );
+
+    if ( param->combine == NULL ) {
+        hexin_combine_init( &combine, param->width, param->poly );
+    }
+    return ( unsigned short )hexin_combine_repeat( ( param->combine != NULL ) ? param->combine : &combine, param->refout, crc, block, len, count, empty );
+}
+
+/*
+ * CRC( A ) after len bytes of A, followed by len_after bytes, were rewritten from pOld to pNew, O( len + log( len_after ) ).
+ */
+unsigned short hexin_crc16_update_range( const struct _hexin_crc16 *param, unsigned short crc, const unsigned char *pOld, const unsigned char *pNew,
+                                      size_t len, unsigned long long len_after )
+{
+    struct _hexin_crc16 local = *param;
+    struct _hexin_combine combine;
+    unsigned short crc_old = 0, crc_new = 0;
+
+    local.is_gradual = FALSE;
+    crc_old = hexin_crc16_compute( pOld, len, &local, local.init );
+    crc_new = hexin_crc16_compute( pNew, len, &local, local.init );
+
+    if ( param->combine == NULL ) {
+        hexin_combine_init( &combine, param->width, param->poly );
+    }
+    return ( unsigned short )hexin_combine_patch( ( param->combine != NULL ) ? param->combine : &combine, param->refout, crc, crc_old, crc_new, len_after );
 }
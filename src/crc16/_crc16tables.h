@@ -20,6 +20,9 @@
 #ifndef __CRC16_TABLES_H__
 #define __CRC16_TABLES_H__
 
+#include "_clmulfold.h"
+#include "_parallel.h"
+
 #ifndef TRUE
 #define                 TRUE                                    1
 #endif
@@ -32,6 +35,10 @@
 #define                 MAX_TABLE_ARRAY                         256
 #endif
 
+#ifndef MAX_SLICING_ARRAY
+#define                 MAX_SLICING_ARRAY                       16      /* Slicing-by-16 (table[0] is the classic table) */
+#endif
+
 #define                 HEXIN_CRC16_WIDTH                       16
 
 #define                 CRC16_POLYNOMIAL_1021                   0x1021
@@ -46,6 +53,9 @@
 #define                 HEXIN_REFOUT_IS_TRUE(x)                 ( x->refout == TRUE )
 #define                 HEXIN_REFIN_REFOUT_IS_TRUE(x)           ( ( x->refin == TRUE ) && ( x->refout == TRUE ) )
 #define                 HEXIN_GRADUAL_CALCULATE_IS_TRUE(x)      ( x->is_gradual == 2 )
+#define                 HEXIN_TABLE_IS_NORMAL                   1       /* is_initial : MSB-first table */
+#define                 HEXIN_TABLE_IS_REFLECTED                2       /* is_initial : LSB-first table ( refin == refout == TRUE ) */
+#define                 HEXIN_TABLE_TYPE(x)                     ( HEXIN_REFIN_REFOUT_IS_TRUE((x)) ? HEXIN_TABLE_IS_REFLECTED : HEXIN_TABLE_IS_NORMAL )
 
 struct _hexin_crc16 {
     unsigned int    is_initial;
@@ -56,8 +66,9 @@ struct _hexin_crc16 {
     unsigned int    refin;
     unsigned int    refout;
     unsigned short  xorout;
-    unsigned short  result;
-    unsigned short  table[MAX_TABLE_ARRAY];
+    const unsigned short (*table)[MAX_TABLE_ARRAY];        /* static const presets, see _crc16presets.h */
+    const struct _hexin_clmul *clmul;
+    const struct _hexin_combine *combine;                  /* x^( 8 * 2^k ) mod P(x), see _combine.h */
 };
 
 unsigned short hexin_reverse16( unsigned short data );
@@ -65,11 +76,20 @@ unsigned short hexin_reverse16( unsigned short data );
 unsigned int hexin_crc16_init_table_poly_is_high( unsigned short polynomial, unsigned short *table );
 unsigned int hexin_crc16_init_table_poly_is_low(  unsigned short polynomial, unsigned short *table );
 
-unsigned short hexin_calc_crc16_sick(     const unsigned char *pSrc, unsigned int len, unsigned short crc16 );
-unsigned short hexin_calc_crc16_network(  const unsigned char *pSrc, unsigned int len, unsigned short crc16 /*reserved*/ );
-unsigned short hexin_calc_crc16_fletcher( const unsigned char *pSrc, unsigned int len, unsigned short crc16 /*reserved*/ );
+unsigned short hexin_calc_crc16_sick(     const unsigned char *pSrc, size_t len, unsigned short crc16 );
+unsigned short hexin_calc_crc16_network(  const unsigned char *pSrc, size_t len, unsigned short crc16 /*reserved*/ );
+unsigned short hexin_calc_crc16_fletcher( const unsigned char *pSrc, size_t len, unsigned short crc16 /*reserved*/ );
 
-unsigned short hexin_crc16_compute( const unsigned char *pSrc, unsigned int len, struct _hexin_crc16 *param, unsigned short init );
+unsigned int   hexin_crc16_compute_init_table( struct _hexin_crc16 *param, unsigned short (*table)[MAX_TABLE_ARRAY], struct _hexin_clmul *clmul );
+unsigned short hexin_crc16_compute_begin(  const struct _hexin_crc16 *param, unsigned short init );
+unsigned short hexin_crc16_compute_update( const struct _hexin_crc16 *param, unsigned short crc, const unsigned char *pSrc, size_t len );
+unsigned short hexin_crc16_compute_end(    const struct _hexin_crc16 *param, unsigned short crc );
+unsigned short hexin_crc16_compute( const unsigned char *pSrc, size_t len, const struct _hexin_crc16 *param, unsigned short init );
+unsigned short hexin_crc16_compute_parallel( const unsigned char *pSrc, size_t len, const struct _hexin_crc16 *param, unsigned short init, unsigned int threads );
+unsigned short hexin_crc16_combine( const struct _hexin_crc16 *param, unsigned short crc_a, unsigned short crc_b, unsigned long long len_b );
+unsigned short hexin_crc16_extend_zeros(  const struct _hexin_crc16 *param, unsigned short crc, unsigned long long len );
+unsigned short hexin_crc16_extend_repeat( const struct _hexin_crc16 *param, unsigned short crc, const unsigned char *pBlock, size_t len, unsigned long long count );
+unsigned short hexin_crc16_update_range(  const struct _hexin_crc16 *param, unsigned short crc, const unsigned char *pOld, const unsigned char *pNew, size_t len, unsigned long long len_after );
 
 
 #endif //__CRC16_TABLES_H__
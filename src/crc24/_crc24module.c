@@ -20,252 +20,607 @@
 
 #define PY_SSIZE_T_CLEAN
 #include <Python.h>
+#include <string.h>
 #include "_crc24tables.h"
-
-static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, PyObject *args, struct _hexin_crc24 *param )
+#include "_crc24presets.h"
+#include "_hasher.h"
+#include "_batch.h"
+#include "_file.h"
+#include "_multi.h"
+#include "_fastcall.h"
+#include "_hacker.h"
+
+static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, HEXIN_FASTCALL_PARAMS, const struct _hexin_crc24 *preset, unsigned int *result )
 {
+    struct _hexin_crc24 local = *preset;       /* Per-call state, the preset is shared by every thread */
+    struct _hexin_crc24 *param = &local;
     Py_buffer data = { NULL, NULL };
-    unsigned int init = param->init;
+    unsigned long long value = param->init;     /* Fixed Issues #4  */
+    unsigned int threads = 1;
+    int is_gradual = hexin_fastcall_preset( HEXIN_FASTCALL_ARGS, &data, &value, &threads );
+    unsigned int init = ( unsigned int )value;
 
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTuple( args, "y*|I", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
-    }
-#else
-    if ( !PyArg_ParseTuple( args, "s*|I", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
+    if ( is_gradual < 0 ) {
         return FALSE;
     }
-#endif /* PY_MAJOR_VERSION */
 
     /* Fixed Issues #4  */
-    param->is_gradual = ( unsigned int )PyTuple_Size( args );   // Fixed warning C4244
+    param->is_gradual = ( unsigned int )is_gradual;
     if ( HEXIN_GRADUAL_CALCULATE_IS_TRUE( param ) ) {
         init = ( init ^ param->xorout );
     }
 
-    param->result = hexin_crc24_compute( (const unsigned char *)data.buf, (unsigned int)data.len, param, init );
-
-    if ( data.obj )
-       PyBuffer_Release( &data );
+    if ( hexin_parallel_threads( ( size_t )data.len, threads ) > 1 ) {
+        Py_BEGIN_ALLOW_THREADS
+        *result = hexin_crc24_compute_parallel( (const unsigned char *)data.buf, (size_t)data.len, param, init, threads );
+        Py_END_ALLOW_THREADS
+    } else if ( ( size_t )data.len < hexin_gil_threshold() ) {
+        *result = hexin_crc24_compute( (const unsigned char *)data.buf, (size_t)data.len, param, init );
+    } else {
+        Py_BEGIN_ALLOW_THREADS
+        *result = hexin_crc24_compute( (const unsigned char *)data.buf, (size_t)data.len, param, init );
+        Py_END_ALLOW_THREADS
+    }
 
+    PyBuffer_Release( &data );
     return TRUE;
 }
 
-static PyObject * _crc24_ble( PyObject *self, PyObject *args )
+static const struct _hexin_crc24 crc24_param_ble = { .is_initial=HEXIN_TABLE_IS_REFLECTED,
+                                               .width  = HEXIN_CRC24_WIDTH,
+                                               .poly   = CRC24_POLYNOMIAL_00065B,
+                                               .init   = 0x00555555,
+                                               .refin  = TRUE,
+                                               .refout = TRUE,
+                                               .xorout = 0x00000000,
+                                               .table  = hexin_crc24_table_00065B_reflected,
+                                               .clmul  = &hexin_crc24_clmul_00065B,
+                                               .combine= &hexin_crc24_combine_00065B };
+
+static PyObject * _crc24_ble( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc24 crc24_param_ble = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC24_WIDTH,
-                                                   .poly   = CRC24_POLYNOMIAL_00065B,
-                                                   .init   = 0x00555555,
-                                                   .refin  = TRUE,
-                                                   .refout = TRUE,
-                                                   .xorout = 0x00000000,
-                                                   .result = 0 };
+    unsigned int result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc24_param_ble ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc24_param_ble , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc24_param_ble.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc24_flexraya( PyObject *self, PyObject *args )
+static const struct _hexin_crc24 crc24_param_flexraya = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                    .width  = HEXIN_CRC24_WIDTH,
+                                                    .poly   = CRC24_POLYNOMIAL_5D6DCB,
+                                                    .init   = 0x00FEDCBA,
+                                                    .refin  = FALSE,
+                                                    .refout = FALSE,
+                                                    .xorout = 0x00000000,
+                                                    .table  = hexin_crc24_table_5D6DCB_normal,
+                                                    .clmul  = &hexin_crc24_clmul_5D6DCB,
+                                                    .combine= &hexin_crc24_combine_5D6DCB };
+
+static PyObject * _crc24_flexraya( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc24 crc24_param_flexraya = { .is_initial=FALSE,
-                                                        .width  = HEXIN_CRC24_WIDTH,
-                                                        .poly   = CRC24_POLYNOMIAL_5D6DCB,
-                                                        .init   = 0x00FEDCBA,
-                                                        .refin  = FALSE,
-                                                        .refout = FALSE,
-                                                        .xorout = 0x00000000,
-                                                        .result = 0 };
+    unsigned int result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc24_param_flexraya ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc24_param_flexraya , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc24_param_flexraya.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc24_flexrayb( PyObject *self, PyObject *args )
+static const struct _hexin_crc24 crc24_param_flexrayb = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                    .width  = HEXIN_CRC24_WIDTH,
+                                                    .poly   = CRC24_POLYNOMIAL_5D6DCB,
+                                                    .init   = 0x00ABCDEF,
+                                                    .refin  = FALSE,
+                                                    .refout = FALSE,
+                                                    .xorout = 0x00000000,
+                                                    .table  = hexin_crc24_table_5D6DCB_normal,
+                                                    .clmul  = &hexin_crc24_clmul_5D6DCB,
+                                                    .combine= &hexin_crc24_combine_5D6DCB };
+
+static PyObject * _crc24_flexrayb( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc24 crc24_param_flexrayb = { .is_initial=FALSE,
-                                                        .width  = HEXIN_CRC24_WIDTH,
-                                                        .poly   = CRC24_POLYNOMIAL_5D6DCB,
-                                                        .init   = 0x00ABCDEF,
-                                                        .refin  = FALSE,
-                                                        .refout = FALSE,
-                                                        .xorout = 0x00000000,
-                                                        .result = 0 };
+    unsigned int result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc24_param_flexrayb ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc24_param_flexrayb , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc24_param_flexrayb.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc24_openpgp( PyObject *self, PyObject *args )
+static const struct _hexin_crc24 crc24_param_openpgp = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                   .width  = HEXIN_CRC24_WIDTH,
+                                                   .poly   = CRC24_POLYNOMIAL_864CFB,
+                                                   .init   = 0x00B704CE,
+                                                   .refin  = FALSE,
+                                                   .refout = FALSE,
+                                                   .xorout = 0x00000000,
+                                                   .table  = hexin_crc24_table_864CFB_normal,
+                                                   .clmul  = &hexin_crc24_clmul_864CFB,
+                                                   .combine= &hexin_crc24_combine_864CFB };
+
+static PyObject * _crc24_openpgp( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc24 crc24_param_openpgp = { .is_initial=FALSE,
-                                                       .width  = HEXIN_CRC24_WIDTH,
-                                                       .poly   = CRC24_POLYNOMIAL_864CFB,
-                                                       .init   = 0x00B704CE,
-                                                       .refin  = FALSE,
-                                                       .refout = FALSE,
-                                                       .xorout = 0x00000000,
-                                                       .result = 0 };
+    unsigned int result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc24_param_openpgp ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc24_param_openpgp , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc24_param_openpgp.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc24_lte_a( PyObject *self, PyObject *args )
+static const struct _hexin_crc24 crc24_param_lte_a = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                 .width  = HEXIN_CRC24_WIDTH,
+                                                 .poly   = CRC24_POLYNOMIAL_864CFB,
+                                                 .init   = 0x00000000,
+                                                 .refin  = FALSE,
+                                                 .refout = FALSE,
+                                                 .xorout = 0x00000000,
+                                                 .table  = hexin_crc24_table_864CFB_normal,
+                                                 .clmul  = &hexin_crc24_clmul_864CFB,
+                                                 .combine= &hexin_crc24_combine_864CFB };
+
+static PyObject * _crc24_lte_a( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc24 crc24_param_lte_a = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC24_WIDTH,
-                                                     .poly   = CRC24_POLYNOMIAL_864CFB,
-                                                     .init   = 0x00000000,
-                                                     .refin  = FALSE,
-                                                     .refout = FALSE,
-                                                     .xorout = 0x00000000,
-                                                     .result = 0 };
+    unsigned int result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc24_param_lte_a ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc24_param_lte_a , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc24_param_lte_a.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc24_lte_b( PyObject *self, PyObject *args )
+static const struct _hexin_crc24 crc24_param_lte_b = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                 .width  = HEXIN_CRC24_WIDTH,
+                                                 .poly   = CRC24_POLYNOMIAL_800063,
+                                                 .init   = 0x00000000,
+                                                 .refin  = FALSE,
+                                                 .refout = FALSE,
+                                                 .xorout = 0x00000000,
+                                                 .table  = hexin_crc24_table_800063_normal,
+                                                 .clmul  = &hexin_crc24_clmul_800063,
+                                                 .combine= &hexin_crc24_combine_800063 };
+
+static PyObject * _crc24_lte_b( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc24 crc24_param_lte_b = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC24_WIDTH,
-                                                     .poly   = CRC24_POLYNOMIAL_800063,
-                                                     .init   = 0x00000000,
-                                                     .refin  = FALSE,
-                                                     .refout = FALSE,
-                                                     .xorout = 0x00000000,
-                                                     .result = 0 };
+    unsigned int result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc24_param_lte_b ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc24_param_lte_b , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc24_param_lte_b.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc24_os9( PyObject *self, PyObject *args )
+static const struct _hexin_crc24 crc24_param_os9 = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                               .width  = HEXIN_CRC24_WIDTH,
+                                               .poly   = CRC24_POLYNOMIAL_800063,
+                                               .init   = 0x00FFFFFF,
+                                               .refin  = FALSE,
+                                               .refout = FALSE,
+                                               .xorout = 0x00FFFFFF,
+                                               .table  = hexin_crc24_table_800063_normal,
+                                               .clmul  = &hexin_crc24_clmul_800063,
+                                               .combine= &hexin_crc24_combine_800063 };
+
+static PyObject * _crc24_os9( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc24 crc24_param_os9 = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC24_WIDTH,
-                                                   .poly   = CRC24_POLYNOMIAL_800063,
-                                                   .init   = 0x00FFFFFF,
-                                                   .refin  = FALSE,
-                                                   .refout = FALSE,
-                                                   .xorout = 0x00FFFFFF,
-                                                   .result = 0 };
+    unsigned int result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc24_param_os9 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc24_param_os9 , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc24_param_os9.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc24_interlaken( PyObject *self, PyObject *args )
+static const struct _hexin_crc24 crc24_param_interlaken = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                      .width  = HEXIN_CRC24_WIDTH,
+                                                      .poly   = CRC24_POLYNOMIAL_328B63,
+                                                      .init   = 0x00FFFFFF,
+                                                      .refin  = FALSE,
+                                                      .refout = FALSE,
+                                                      .xorout = 0x00FFFFFF,
+                                                      .table  = hexin_crc24_table_328B63_normal,
+                                                      .clmul  = &hexin_crc24_clmul_328B63,
+                                                      .combine= &hexin_crc24_combine_328B63 };
+
+static PyObject * _crc24_interlaken( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc24 crc24_param_interlaken = { .is_initial=FALSE,
-                                                          .width  = HEXIN_CRC24_WIDTH,
-                                                          .poly   = CRC24_POLYNOMIAL_328B63,
-                                                          .init   = 0x00FFFFFF,
-                                                          .refin  = FALSE,
-                                                          .refout = FALSE,
-                                                          .xorout = 0x00FFFFFF,
-                                                          .result = 0 };
+    unsigned int result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc24_param_interlaken ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc24_param_interlaken , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc24_param_interlaken.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc24_hacker( PyObject *self, PyObject *args, PyObject* kws )
+static unsigned int hexin_crc24_hacker_init( void *param, void *table, struct _hexin_clmul *clmul )
+{
+    return hexin_crc24_compute_init_table( ( struct _hexin_crc24 * )param, ( unsigned int (*)[MAX_TABLE_ARRAY] )table, clmul );
+}
+
+static struct _hexin_hacker_cache crc24_hacker_cache = { NULL, sizeof( unsigned int [MAX_SLICING_ARRAY][MAX_TABLE_ARRAY] ), hexin_crc24_hacker_init, 0 };
+
+static PyObject * _crc24_hacker( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
     unsigned int reinit = FALSE;
+    unsigned int result = 0;
+    struct _hexin_hacker_entry *entry = NULL;
     Py_buffer data = { NULL, NULL };
-    static struct _hexin_crc24 crc24_param_hacker = { .is_initial = FALSE,
-                                                      .is_gradual = FALSE,
-                                                      .width  = HEXIN_CRC24_WIDTH,
-                                                      .poly   = CRC24_POLYNOMIAL_800063,
-                                                      .init   = 0x00FFFFFF,
-                                                      .refin  = FALSE,
-                                                      .refout = FALSE,
-                                                      .xorout = 0x00FFFFFF,
-                                                      .result = 0 };
+    struct _hexin_crc24 crc24_param_hacker = { .is_initial = FALSE,
+                                               .is_gradual = FALSE,
+                                               .width  = HEXIN_CRC24_WIDTH,
+                                               .poly   = CRC24_POLYNOMIAL_800063,
+                                               .init   = 0x00FFFFFF,
+                                               .refin  = FALSE,
+                                               .refout = FALSE,
+                                               .xorout = 0x00FFFFFF };
+
+    static const char *const kwlist[] = { "data", "poly", "init", "xorout", "refin", "refout", "reinit", NULL };
+    PyObject *values[7];
+    unsigned long long poly = crc24_param_hacker.poly, init = crc24_param_hacker.init, xorout = crc24_param_hacker.xorout;
+    unsigned int refin = crc24_param_hacker.refin, refout = crc24_param_hacker.refout;
+
+    if ( ( hexin_fastcall_parse( HEXIN_FASTCALL_ARGS, kwlist, 1, 7, values ) < 0 )
+      || ( ( values[1] != NULL ) && ( hexin_fastcall_mask( values[1], &poly   ) < 0 ) )
+      || ( ( values[2] != NULL ) && ( hexin_fastcall_mask( values[2], &init   ) < 0 ) )
+      || ( ( values[3] != NULL ) && ( hexin_fastcall_mask( values[3], &xorout ) < 0 ) )
+      || ( ( values[4] != NULL ) && ( hexin_fastcall_bool( values[4], &refin  ) < 0 ) )
+      || ( ( values[5] != NULL ) && ( hexin_fastcall_bool( values[5], &refout ) < 0 ) )
+      || ( ( values[6] != NULL ) && ( hexin_fastcall_bool( values[6], &reinit ) < 0 ) )
+      || ( hexin_fastcall_buffer( values[0], &data ) < 0 ) ) {
+        return NULL;
+    }
+    crc24_param_hacker.poly   = ( unsigned int )poly;
+    crc24_param_hacker.init   = ( unsigned int )init;
+    crc24_param_hacker.xorout = ( unsigned int )xorout;
+    crc24_param_hacker.refin  = refin;
+    crc24_param_hacker.refout = refout;
+
+    /* The tables of the last HEXIN_HACKER_CACHE_SIZE ( poly, orientation ) are kept, reinit=True builds them again. */
+    entry = hexin_hacker_acquire( &crc24_hacker_cache, &crc24_param_hacker, crc24_param_hacker.poly, HEXIN_TABLE_TYPE( &crc24_param_hacker ), reinit );
+    if ( entry == NULL ) {
+        PyBuffer_Release( &data );
+        return NULL;
+    }
+    crc24_param_hacker.is_initial = entry->type;
+    crc24_param_hacker.table      = entry->table;
+    crc24_param_hacker.clmul      = &entry->clmul;
+
+    if ( ( size_t )data.len < hexin_gil_threshold() ) {
+        result = hexin_crc24_compute( (const unsigned char *)data.buf, (size_t)data.len, &crc24_param_hacker, crc24_param_hacker.init );
+    } else {
+        Py_BEGIN_ALLOW_THREADS
+        result = hexin_crc24_compute( (const unsigned char *)data.buf, (size_t)data.len, &crc24_param_hacker, crc24_param_hacker.init );
+        Py_END_ALLOW_THREADS
+    }
 
-    static char* kwlist[]={ "data", "poly", "init", "xorout", "refin", "refout", "reinit", NULL };
+    hexin_hacker_release( &crc24_hacker_cache, entry );
+    PyBuffer_Release( &data );
 
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTupleAndKeywords( args, kws, "y*|IIIppp", kwlist, &data,
-                                                                       &crc24_param_hacker.poly,
-                                                                       &crc24_param_hacker.init,
-                                                                       &crc24_param_hacker.xorout,
-                                                                       &crc24_param_hacker.refin,
-                                                                       &crc24_param_hacker.refout,
-                                                                       &reinit ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
+    return PyLong_FromUnsignedLong( result );
+}
+
+/* Named presets, the method names of the table below */
+static struct {
+    const char          *name;
+    const struct _hexin_crc24 *param;
+} _crc24_presets[] = {
+    { "ble",       &crc24_param_ble },
+    { "flexraya",  &crc24_param_flexraya },
+    { "flexrayb",  &crc24_param_flexrayb },
+    { "openpgp",   &crc24_param_openpgp },
+    { "crc24",     &crc24_param_openpgp },
+    { "lte_a",     &crc24_param_lte_a },
+    { "lte_b",     &crc24_param_lte_b },
+    { "os9",       &crc24_param_os9 },
+    { "interlaken",&crc24_param_interlaken },
+    { NULL, NULL }
+};
+
+static const struct _hexin_crc24 *hexin_crc24_preset( const char *name )
+{
+    unsigned int i = 0;
+
+    for ( i=0; _crc24_presets[i].name != NULL; i++ ) {
+        if ( 0 == strcmp( _crc24_presets[i].name, name ) ) {
+            return _crc24_presets[i].param;
         }
-        return NULL;        
     }
-#else
-    if ( !PyArg_ParseTupleAndKeywords( args, kws, "s*|IIIIII", kwlist, &data,
-                                                                       &crc24_param_hacker.poly,
-                                                                       &crc24_param_hacker.init,
-                                                                       &crc24_param_hacker.xorout,
-                                                                       &crc24_param_hacker.refin,
-                                                                       &crc24_param_hacker.refout,
-                                                                       &reinit ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
+    return NULL;
+}
+
+static PyObject * _crc24_presets_list( PyObject *self, PyObject *args )
+{
+    unsigned int i = 0;
+    PyObject *names = PyList_New( 0 );
+
+    for ( i=0; ( names != NULL ) && ( _crc24_presets[i].name != NULL ); i++ ) {
+        PyObject *name = Py_BuildValue( "s", _crc24_presets[i].name );
+        if ( ( name == NULL ) || ( PyList_Append( names, name ) < 0 ) ) {
+            Py_XDECREF( name );
+            Py_DECREF( names );
+            return NULL;
         }
-        return NULL;  
+        Py_DECREF( name );
+    }
+    return names;
+}
+
+static PyObject * _crc24_combine( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    unsigned long long crc_a = 0, crc_b = 0, len_b = 0, mask = 0;
+    const struct _hexin_crc24 *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "sO&O&O&", &name, hexin_PyArg_count, &crc_a, hexin_PyArg_count, &crc_b, hexin_PyArg_count, &len_b ) ) {
+        return NULL;
+    }
+
+    param = hexin_crc24_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+
+    mask = ( param->width >= 64 ) ? ~0ULL : ( ( 1ULL << param->width ) - 1 );
+    if ( ( crc_a | crc_b ) & ~mask ) {
+        PyErr_Format( PyExc_ValueError, "%s is a %u-bit CRC", name, ( unsigned int )param->width );
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLongLong( hexin_crc24_combine( param, ( unsigned int )crc_a, ( unsigned int )crc_b, len_b ) );
+}
+
+static PyObject * _crc24_extend_zeros( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    unsigned long long crc = 0, len = 0, mask = 0;
+    const struct _hexin_crc24 *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "sO&O&", &name, hexin_PyArg_count, &crc, hexin_PyArg_count, &len ) ) {
+        return NULL;
+    }
+
+    param = hexin_crc24_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+
+    mask = ( param->width >= 64 ) ? ~0ULL : ( ( 1ULL << param->width ) - 1 );
+    if ( crc & ~mask ) {
+        PyErr_Format( PyExc_ValueError, "%s is a %u-bit CRC", name, ( unsigned int )param->width );
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLongLong( hexin_crc24_extend_zeros( param, ( unsigned int )crc, len ) );
+}
+
+static PyObject * _crc24_extend_repeat( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    unsigned long long crc = 0, count = 0, mask = 0;
+    const struct _hexin_crc24 *param = NULL;
+    Py_buffer data = { NULL, NULL };
+    unsigned int result = 0;
+
+#if PY_MAJOR_VERSION >= 3
+    if ( !PyArg_ParseTuple( args, "sO&y*O&", &name, hexin_PyArg_count, &crc, &data, hexin_PyArg_count, &count ) ) {
+#else
+    if ( !PyArg_ParseTuple( args, "sO&s*O&", &name, hexin_PyArg_count, &crc, &data, hexin_PyArg_count, &count ) ) {
+#endif /* PY_MAJOR_VERSION */
+        return NULL;
+    }
+
+    param = hexin_crc24_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        PyBuffer_Release( &data );
+        return NULL;
+    }
+
+    mask = ( param->width >= 64 ) ? ~0ULL : ( ( 1ULL << param->width ) - 1 );
+    if ( crc & ~mask ) {
+        PyErr_Format( PyExc_ValueError, "%s is a %u-bit CRC", name, ( unsigned int )param->width );
+        PyBuffer_Release( &data );
+        return NULL;
+    }
+
+    if ( ( size_t )data.len < hexin_gil_threshold() ) {
+        result = hexin_crc24_extend_repeat( param, ( unsigned int )crc, ( const unsigned char * )data.buf, ( size_t )data.len, count );
+    } else {
+        Py_BEGIN_ALLOW_THREADS
+        result = hexin_crc24_extend_repeat( param, ( unsigned int )crc, ( const unsigned char * )data.buf, ( size_t )data.len, count );
+        Py_END_ALLOW_THREADS
     }
+    PyBuffer_Release( &data );
+    return PyLong_FromUnsignedLongLong( result );
+}
+
+static PyObject * _crc24_update_range( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    unsigned long long crc = 0, offset = 0, total = 0, mask = 0;
+    const struct _hexin_crc24 *param = NULL;
+    Py_buffer before = { NULL, NULL }, after = { NULL, NULL };
+    PyObject *result = NULL;
+
+#if PY_MAJOR_VERSION >= 3
+    if ( !PyArg_ParseTuple( args, "sO&O&y*y*O&", &name, hexin_PyArg_count, &crc, hexin_PyArg_count, &offset, &before, &after, hexin_PyArg_count, &total ) ) {
+#else
+    if ( !PyArg_ParseTuple( args, "sO&O&s*s*O&", &name, hexin_PyArg_count, &crc, hexin_PyArg_count, &offset, &before, &after, hexin_PyArg_count, &total ) ) {
 #endif /* PY_MAJOR_VERSION */
+        return NULL;
+    }
+
+    param = hexin_crc24_preset( name );
+    mask  = ( ( param == NULL ) || ( param->width >= 64 ) ) ? ~0ULL : ( ( 1ULL << param->width ) - 1 );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+    } else if ( crc & ~mask ) {
+        PyErr_Format( PyExc_ValueError, "%s is a %u-bit CRC", name, ( unsigned int )param->width );
+    } else if ( before.len != after.len ) {
+        PyErr_SetString( PyExc_ValueError, "old_bytes and new_bytes differ in length" );
+    } else if ( ( offset > total ) || ( ( unsigned long long )before.len > total - offset ) ) {
+        PyErr_SetString( PyExc_ValueError, "the range is out of the message" );
+    } else {
+        result = PyLong_FromUnsignedLongLong( hexin_crc24_update_range( param, ( unsigned int )crc, ( const unsigned char * )before.buf, ( const unsigned char * )after.buf,
+                                                                       ( size_t )before.len, total - offset - ( unsigned long long )before.len ) );
+    }
+    PyBuffer_Release( &before );
+    PyBuffer_Release( &after );
+    return result;
+}
 
-    crc24_param_hacker.is_initial = ( reinit == FALSE ) ? crc24_param_hacker.is_initial : FALSE;
-    crc24_param_hacker.result = hexin_crc24_compute( (const unsigned char *)data.buf, (unsigned int)data.len, &crc24_param_hacker, crc24_param_hacker.init );
-    
-    if ( data.obj )
-       PyBuffer_Release( &data );
+static unsigned long long hexin_crc24_hasher_begin( const void *param )
+{
+    struct _hexin_crc24 local = *( const struct _hexin_crc24 * )param;
 
-    return Py_BuildValue( "I", crc24_param_hacker.result );
+    local.is_gradual = FALSE;
+    return hexin_crc24_compute_begin( &local, local.init );
+}
+
+static unsigned long long hexin_crc24_hasher_update( const void *param, unsigned long long crc, const unsigned char *pSrc, size_t len )
+{
+    return hexin_crc24_compute_update( ( const struct _hexin_crc24 * )param, ( unsigned int )crc, pSrc, len );
+}
+
+static unsigned long long hexin_crc24_hasher_end( const void *param, unsigned long long crc )
+{
+    return hexin_crc24_compute_end( ( const struct _hexin_crc24 * )param, ( unsigned int )crc );
+}
+
+static const struct _hexin_hasher_ops crc24_hasher_ops = { hexin_crc24_hasher_begin, hexin_crc24_hasher_update, hexin_crc24_hasher_end };
+
+static PyObject * _crc24_new( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    const struct _hexin_crc24 *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "s", &name ) ) {
+        return NULL;
+    }
+
+    param = hexin_crc24_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+    return hexin_hasher_new( &crc24_hasher_ops, param, name, param->width, NULL );
+}
+
+static PyObject * _crc24_batch( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    PyObject *data = NULL, *out = NULL, *offsets = Py_None, *lengths = Py_None, *expected = Py_None;
+    int rows = 0;
+    const struct _hexin_crc24 *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "sOO|OOOi", &name, &data, &out, &offsets, &lengths, &expected, &rows ) ) {
+        return NULL;
+    }
+
+    param = hexin_crc24_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+    return hexin_batch_compute( &crc24_hasher_ops, param, param->width, data, out,
+                                ( offsets  == Py_None ) ? NULL : offsets,
+                                ( lengths  == Py_None ) ? NULL : lengths,
+                                ( expected == Py_None ) ? NULL : expected, rows );
+}
+
+static PyObject * _crc24_file( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    PyObject *file = NULL;
+    const struct _hexin_crc24 *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "sO", &name, &file ) ) {
+        return NULL;
+    }
+
+    param = hexin_crc24_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+    return hexin_file_compute( &crc24_hasher_ops, param, file );
+}
+
+static PyObject * _crc24_files( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    PyObject *files = NULL;
+    unsigned int threads = 0;
+    const struct _hexin_crc24 *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "sO|O&", &name, &files, hexin_PyArg_threads, &threads ) ) {
+        return NULL;
+    }
+
+    param = hexin_crc24_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+    return hexin_file_compute_many( &crc24_hasher_ops, param, files, threads );
+}
+
+static PyObject * _crc24_capsule( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    const struct _hexin_crc24 *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "s", &name ) ) {
+        return NULL;
+    }
+
+    param = hexin_crc24_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+    return hexin_multi_capsule( &crc24_hasher_ops, param, NULL );
+}
+
+static PyObject * _crc24_kernels( PyObject *self, PyObject *args )
+{
+    return Py_BuildValue( "{s:s}", "crc24", hexin_clmul_kernel() );
+}
+
+static PyObject * _crc24_gil_threshold( PyObject *self, PyObject *args )
+{
+    Py_ssize_t threshold = -1;
+
+    if ( !PyArg_ParseTuple( args, "|n", &threshold ) ) {
+        return NULL;
+    }
+    return PyLong_FromSize_t( hexin_set_gil_threshold( ( threshold < 0 ) ? ( size_t )-1 : ( size_t )threshold ) );
 }
 
 /* method table */
 static PyMethodDef _crc24Methods[] = {
-    { "ble",         (PyCFunction)_crc24_ble,        METH_VARARGS,   "Calculate BLE of CRC24 [Poly=0x00065B, Init=0x555555, Xorout=0x00000000 Refin=True Refout=True]"},
-    { "flexraya",    (PyCFunction)_crc24_flexraya,   METH_VARARGS,   "Calculate FLEXRAY-A of CRC24 [Poly=0x5D6DCB, Init=0xFEDCBA, Xorout=0x00000000 Refin=True Refout=True]"},
-    { "flexrayb",    (PyCFunction)_crc24_flexrayb,   METH_VARARGS,   "Calculate FLEXRAY-B of CRC24 [Poly=0x5D6DCB, Init=0xABCDEF, Xorout=0x00000000 Refin=True Refout=True]"},
-    { "openpgp",     (PyCFunction)_crc24_openpgp,    METH_VARARGS,   "Calculate OPENPGP of CRC24 [Poly=0x864CFB, Init=0xB704CE, Xorout=0x00000000 Refin=True Refout=True]"},
-    { "crc24",       (PyCFunction)_crc24_openpgp,    METH_VARARGS,   "Calculate CRC of CRC24 [Poly=0x864CFB, Init=0xB704CE, Xorout=0x00000000 Refin=True Refout=True]"},
-    { "lte_a",       (PyCFunction)_crc24_lte_a,      METH_VARARGS,   "Calculate LTE-A of CRC24 [Poly=0x864CFB, Init=0x000000, Xorout=0x00000000 Refin=False Refout=False]"},
-    { "lte_b",       (PyCFunction)_crc24_lte_b,      METH_VARARGS,   "Calculate LTE-B of CRC24 [Poly=0x800063, Init=0x000000, Xorout=0x00000000 Refin=False Refout=False]"},
-    { "os9",         (PyCFunction)_crc24_os9,        METH_VARARGS,   "Calculate OS-9 of CRC24 [Poly=0x800063, Init=0xFFFFFF, Xorout=0xFFFFFF Refin=False Refout=False]"},
-    { "interlaken",  (PyCFunction)_crc24_interlaken, METH_VARARGS,   "Calculate INTERLAKEN of CRC24 [Poly=0x328B63, Init=0xFFFFFF, Xorout=0xFFFFFF Refin=False Refout=False]"},
-    { "hacker24",    (PyCFunction)_crc24_hacker,     METH_KEYWORDS|METH_VARARGS, "User calculation CRC24\n"
+    { "ble",         (PyCFunction)_crc24_ble,        HEXIN_METH_FASTCALL,   "Calculate BLE of CRC24 [Poly=0x00065B, Init=0x555555, Xorout=0x00000000 Refin=True Refout=True]"},
+    { "flexraya",    (PyCFunction)_crc24_flexraya,   HEXIN_METH_FASTCALL,   "Calculate FLEXRAY-A of CRC24 [Poly=0x5D6DCB, Init=0xFEDCBA, Xorout=0x00000000 Refin=True Refout=True]"},
+    { "flexrayb",    (PyCFunction)_crc24_flexrayb,   HEXIN_METH_FASTCALL,   "Calculate FLEXRAY-B of CRC24 [Poly=0x5D6DCB, Init=0xABCDEF, Xorout=0x00000000 Refin=True Refout=True]"},
+    { "openpgp",     (PyCFunction)_crc24_openpgp,    HEXIN_METH_FASTCALL,   "Calculate OPENPGP of CRC24 [Poly=0x864CFB, Init=0xB704CE, Xorout=0x00000000 Refin=True Refout=True]"},
+    { "crc24",       (PyCFunction)_crc24_openpgp,    HEXIN_METH_FASTCALL,   "Calculate CRC of CRC24 [Poly=0x864CFB, Init=0xB704CE, Xorout=0x00000000 Refin=True Refout=True]"},
+    { "lte_a",       (PyCFunction)_crc24_lte_a,      HEXIN_METH_FASTCALL,   "Calculate LTE-A of CRC24 [Poly=0x864CFB, Init=0x000000, Xorout=0x00000000 Refin=False Refout=False]"},
+    { "lte_b",       (PyCFunction)_crc24_lte_b,      HEXIN_METH_FASTCALL,   "Calculate LTE-B of CRC24 [Poly=0x800063, Init=0x000000, Xorout=0x00000000 Refin=False Refout=False]"},
+    { "os9",         (PyCFunction)_crc24_os9,        HEXIN_METH_FASTCALL,   "Calculate OS-9 of CRC24 [Poly=0x800063, Init=0xFFFFFF, Xorout=0xFFFFFF Refin=False Refout=False]"},
+    { "interlaken",  (PyCFunction)_crc24_interlaken, HEXIN_METH_FASTCALL,   "Calculate INTERLAKEN of CRC24 [Poly=0x328B63, Init=0xFFFFFF, Xorout=0xFFFFFF Refin=False Refout=False]"},
+    { "hacker24",    (PyCFunction)_crc24_hacker,     HEXIN_METH_FASTCALL, "User calculation CRC24\n"
                                                                                  "@data   : bytes\n"
                                                                                  "@poly   : default=0x00800063\n"
                                                                                  "@init   : default=0x00FFFFFF\n"
@@ -273,6 +628,19 @@ static PyMethodDef _crc24Methods[] = {
                                                                                  "@refin  : default=False\n"
                                                                                  "@refout : default=False\n"
                                                                                  "@reinit : default=False" },
+    { "_kernels",    (PyCFunction)_crc24_kernels, METH_NOARGS, "The kernel tier every family of this module is bound to." },
+    { "_gil_threshold", (PyCFunction)_crc24_gil_threshold, METH_VARARGS, "Release the GIL for buffers of at least this many bytes, returns the previous value." },
+    { "_presets",    (PyCFunction)_crc24_presets_list, METH_NOARGS, "The names of the presets of this module." },
+    { "_combine",    (PyCFunction)_crc24_combine, METH_VARARGS, "CRC( A || B ) of a preset : _combine( name, crc_a, crc_b, len_b )" },
+    { "_extend_zeros",  (PyCFunction)_crc24_extend_zeros,  METH_VARARGS, "CRC( A || n zero bytes ) : _extend_zeros( name, crc, n )" },
+    { "_extend_repeat", (PyCFunction)_crc24_extend_repeat, METH_VARARGS, "CRC( A || block * count ) : _extend_repeat( name, crc, block, count )" },
+    { "_update_range",  (PyCFunction)_crc24_update_range,  METH_VARARGS, "CRC after a range was rewritten : _update_range( name, crc, offset, old, new, total_len )" },
+    { "_new",        (PyCFunction)_crc24_new, METH_VARARGS, "A hashlib-style hasher of a preset : _new( name )" },
+    { "_batch",      (PyCFunction)_crc24_batch, METH_VARARGS, "CRC of many buffers into an integer array : _batch( name, data, out, offsets, lengths, expected, rows )" },
+    { "_file",       (PyCFunction)_crc24_file, METH_VARARGS, "CRC of a file without the GIL : _file( name, path or fd )" },
+    { "_files",      (PyCFunction)_crc24_files, METH_VARARGS, "( crc, size ) of many files on a thread pool : _files( name, files, threads=0 )" },
+    { "_capsule",    (PyCFunction)_crc24_capsule, METH_VARARGS, "The kernel of a preset for _multi : _capsule( name )" },
+    { "_multi",      (PyCFunction)hexin_multi_compute, METH_VARARGS, "Many CRCs of data in one pass : _multi( data, capsules )" },
     { NULL, NULL, 0, NULL }        /* Sentinel */
 };
 
@@ -314,9 +682,28 @@ PyInit__crc24( void )
         return NULL;
     }
 
+    if ( ( hexin_hasher_ready( m ) < 0 ) || ( hexin_hacker_ready( &crc24_hacker_cache ) < 0 ) ) {
+        Py_DECREF( m );
+        return NULL;
+    }
+
     PyModule_AddStringConstant( m, "__version__", "1.7"  );
     PyModule_AddStringConstant( m, "__author__",  "Heyn" );
 
+    /* Probe the CPU once and pick the kernel tier ( AVX-512 / PCLMULQDQ / tables ), LIBSCRC_KERNEL may lower it. */
+    hexin_clmul_level();
+    hexin_gil_threshold();
+
+    if ( !hexin_kernel_is_known() && ( PyErr_WarnEx( PyExc_RuntimeWarning, HEXIN_KERNEL_UNKNOWN, 1 ) < 0 ) ) {
+        Py_DECREF( m );
+        return NULL;
+    }
+
+#ifdef Py_GIL_DISABLED
+    /* The presets are read-only and every call keeps its state on the stack. */
+    PyUnstable_Module_SetGIL( m, Py_MOD_GIL_NOT_USED );
+#endif
+
     return m;
 }
 
@@ -326,7 +713,12 @@ PyInit__crc24( void )
 PyMODINIT_FUNC
 init_crc24( void )
 {
-    ( void ) Py_InitModule3( "_crc24", _crc24Methods, _crc24_doc );
+    PyObject *m = Py_InitModule3( "_crc24", _crc24Methods, _crc24_doc );
+
+    if ( m != NULL ) {
+        hexin_hasher_ready( m );
+        hexin_hacker_ready( &crc24_hacker_cache );
+    }
 }
 
 #endif /* PY_MAJOR_VERSION */
@@ -19,6 +19,9 @@
 #ifndef __CRC24_TABLES_H__
 #define __CRC24_TABLES_H__
 
+#include "_clmulfold.h"
+#include "_parallel.h"
+
 #ifndef TRUE
 #define                 TRUE                                    1
 #endif
@@ -31,6 +34,10 @@
 #define                 MAX_TABLE_ARRAY                         256
 #endif
 
+#ifndef MAX_SLICING_ARRAY
+#define                 MAX_SLICING_ARRAY                       16      /* Slicing-by-16 (table[0] is the classic table) */
+#endif
+
 #define                 HEXIN_CRC24_WIDTH                       24
 
 #define                 HEXIN_POLYNOMIAL_IS_HIGH(x)             ( x & 0x800000L )
@@ -38,6 +45,9 @@
 #define                 HEXIN_REFOUT_IS_TRUE(x)                 ( x->refout == TRUE )
 #define                 HEXIN_REFIN_REFOUT_IS_TRUE(x)           ( ( x->refin == TRUE ) && ( x->refout == TRUE ) )
 #define                 HEXIN_GRADUAL_CALCULATE_IS_TRUE(x)      ( x->is_gradual == 2 )
+#define                 HEXIN_TABLE_IS_NORMAL                   1       /* is_initial : MSB-first table */
+#define                 HEXIN_TABLE_IS_REFLECTED                2       /* is_initial : LSB-first table ( refin == refout == TRUE ) */
+#define                 HEXIN_TABLE_TYPE(x)                     ( HEXIN_REFIN_REFOUT_IS_TRUE((x)) ? HEXIN_TABLE_IS_REFLECTED : HEXIN_TABLE_IS_NORMAL )
 
 #define                 CRC24_POLYNOMIAL_00065B                 0x00065B
 #define                 CRC24_POLYNOMIAL_5D6DCB                 0x5D6DCB
@@ -55,10 +65,20 @@ struct _hexin_crc24 {
     unsigned int  refin;
     unsigned int  refout;
     unsigned int  xorout;
-    unsigned int  result;
-    unsigned int  table[MAX_TABLE_ARRAY];
+    const unsigned int (*table)[MAX_TABLE_ARRAY];        /* static const presets, see _crc24presets.h */
+    const struct _hexin_clmul *clmul;
+    const struct _hexin_combine *combine;                /* x^( 8 * 2^k ) mod P(x), see _combine.h */
 };
 
-unsigned int hexin_crc24_compute( const unsigned char *pSrc, unsigned int len, struct _hexin_crc24 *param, unsigned int init );
+unsigned int hexin_crc24_compute_init_table( struct _hexin_crc24 *param, unsigned int (*table)[MAX_TABLE_ARRAY], struct _hexin_clmul *clmul );
+unsigned int hexin_crc24_compute_begin(  const struct _hexin_crc24 *param, unsigned int init );
+unsigned int hexin_crc24_compute_update( const struct _hexin_crc24 *param, unsigned int crc, const unsigned char *pSrc, size_t len );
+unsigned int hexin_crc24_compute_end(    const struct _hexin_crc24 *param, unsigned int crc );
+unsigned int hexin_crc24_compute( const unsigned char *pSrc, size_t len, const struct _hexin_crc24 *param, unsigned int init );
+unsigned int hexin_crc24_compute_parallel( const unsigned char *pSrc, size_t len, const struct _hexin_crc24 *param, unsigned int init, unsigned int threads );
+unsigned int hexin_crc24_combine( const struct _hexin_crc24 *param, unsigned int crc_a, unsigned int crc_b, unsigned long long len_b );
+unsigned int hexin_crc24_extend_zeros(  const struct _hexin_crc24 *param, unsigned int crc, unsigned long long len );
+unsigned int hexin_crc24_extend_repeat( const struct _hexin_crc24 *param, unsigned int crc, const unsigned char *pBlock, size_t len, unsigned long long count );
+unsigned int hexin_crc24_update_range(  const struct _hexin_crc24 *param, unsigned int crc, const unsigned char *pOld, const unsigned char *pNew, size_t len, unsigned long long len_after );
 
 #endif //__CRC24_TABLES_H__
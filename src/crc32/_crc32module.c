@@ -28,34 +28,42 @@
 
 #define PY_SSIZE_T_CLEAN
 #include <Python.h>
+#include <string.h>
 #include "_crc32tables.h"
-
-static unsigned char hexin_PyArg_ParseTuple( PyObject *self, PyObject *args,
+#include "_crc32presets.h"
+#include "_hasher.h"
+#include "_batch.h"
+#include "_file.h"
+#include "_multi.h"
+#include "_fastcall.h"
+#include "_hacker.h"
+
+static unsigned char hexin_PyArg_ParseTuple( PyObject *self, HEXIN_FASTCALL_PARAMS,
                                              unsigned int init,
                                              unsigned int (*function)( const unsigned char *,
-                                                                       unsigned int,
+                                                                       size_t,
                                                                        unsigned int ),
                                              unsigned int *result )
 {
+    static const char *const kwlist[] = { "data", "init", NULL };
     Py_buffer data = { NULL, NULL };
+    PyObject *values[2];
+    unsigned long long value = init;
 
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTuple( args, "y*|I", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
-    }
-#else
-    if ( !PyArg_ParseTuple( args, "s*|I", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
+    if ( ( hexin_fastcall_parse( HEXIN_FASTCALL_ARGS, kwlist, 1, 2, values ) < 0 )
+      || ( ( values[1] != NULL ) && ( hexin_fastcall_mask( values[1], &value ) < 0 ) )
+      || ( hexin_fastcall_buffer( values[0], &data ) < 0 ) ) {
         return FALSE;
     }
-#endif /* PY_MAJOR_VERSION */
+    init = ( unsigned int )value;
 
-    *result = (* function)( (const unsigned char *)data.buf, (unsigned int)data.len, init );
+    if ( ( size_t )data.len < hexin_gil_threshold() ) {
+        *result = (* function)( (const unsigned char *)data.buf, (size_t)data.len, init );
+    } else {
+        Py_BEGIN_ALLOW_THREADS
+        *result = (* function)( (const unsigned char *)data.buf, (size_t)data.len, init );
+        Py_END_ALLOW_THREADS
+    }
 
     if ( data.obj )
        PyBuffer_Release( &data );
@@ -63,75 +71,84 @@ static unsigned char hexin_PyArg_ParseTuple( PyObject *self, PyObject *args,
     return TRUE;
 }
 
-static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, PyObject *args, struct _hexin_crc32 *param )
+static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, HEXIN_FASTCALL_PARAMS, const struct _hexin_crc32 *preset, unsigned int *result )
 {
+    struct _hexin_crc32 local = *preset;       /* Per-call state, the preset is shared by every thread */
+    struct _hexin_crc32 *param = &local;
     Py_buffer data = { NULL, NULL };
-    unsigned int init = param->init;          /* Fixed Issues #4  */
+    unsigned long long value = param->init;     /* Fixed Issues #4  */
+    unsigned int threads = 1;
+    int is_gradual = hexin_fastcall_preset( HEXIN_FASTCALL_ARGS, &data, &value, &threads );
+    unsigned int init = ( unsigned int )value;
 
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTuple( args, "y*|I", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
-    }
-#else
-    if ( !PyArg_ParseTuple( args, "s*|I", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
+    if ( is_gradual < 0 ) {
         return FALSE;
     }
-#endif /* PY_MAJOR_VERSION */
 
     /* Fixed Issues #4  */
-    param->is_gradual = ( unsigned int )PyTuple_Size( args );   // Fixed warning C4244
+    param->is_gradual = ( unsigned int )is_gradual;
     if ( HEXIN_GRADUAL_CALCULATE_IS_TRUE( param ) ) {
         init = ( init ^ param->xorout );
     }
-    
-    param->result = hexin_crc32_compute( (const unsigned char *)data.buf, (unsigned int)data.len, param, init );
 
-    if ( data.obj )
-       PyBuffer_Release( &data );
+    if ( hexin_parallel_threads( ( size_t )data.len, threads ) > 1 ) {
+        Py_BEGIN_ALLOW_THREADS
+        *result = hexin_crc32_compute_parallel( (const unsigned char *)data.buf, (size_t)data.len, param, init, threads );
+        Py_END_ALLOW_THREADS
+    } else if ( ( size_t )data.len < hexin_gil_threshold() ) {
+        *result = hexin_crc32_compute( (const unsigned char *)data.buf, (size_t)data.len, param, init );
+    } else {
+        Py_BEGIN_ALLOW_THREADS
+        *result = hexin_crc32_compute( (const unsigned char *)data.buf, (size_t)data.len, param, init );
+        Py_END_ALLOW_THREADS
+    }
 
+    PyBuffer_Release( &data );
     return TRUE;
 }
 
-static PyObject * _crc32_mpeg_2( PyObject *self, PyObject *args )
+static const struct _hexin_crc32 crc32_param_mpeg2 = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                 .width  = HEXIN_CRC32_WIDTH,
+                                                 .poly   = CRC32_POLYNOMIAL_04C11DB7,
+                                                 .init   = 0xFFFFFFFFL,
+                                                 .refin  = FALSE,
+                                                 .refout = FALSE,
+                                                 .xorout = 0x00000000L,
+                                                 .table  = hexin_crc32_table_04C11DB7_normal,
+                                                 .clmul  = &hexin_crc32_clmul_04C11DB7,
+                                                 .combine= &hexin_crc32_combine_04C11DB7 };
+
+static PyObject * _crc32_mpeg_2( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc32 crc32_param_mpeg2 = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC32_WIDTH,
-                                                     .poly   = CRC32_POLYNOMIAL_04C11DB7,
-                                                     .init   = 0xFFFFFFFFL,
-                                                     .refin  = FALSE,
-                                                     .refout = FALSE,
-                                                     .xorout = 0x00000000L,
-                                                     .result = 0 };
+    unsigned int result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc32_param_mpeg2 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc32_param_mpeg2 , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc32_param_mpeg2.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc32_crc32( PyObject *self, PyObject *args )
+static const struct _hexin_crc32 crc32_param_crc32 = { .is_initial=HEXIN_TABLE_IS_REFLECTED,
+                                                 .width  = HEXIN_CRC32_WIDTH,
+                                                 .poly   = CRC32_POLYNOMIAL_04C11DB7,
+                                                 .init   = 0xFFFFFFFFL,
+                                                 .refin  = TRUE,
+                                                 .refout = TRUE,
+                                                 .xorout = 0xFFFFFFFFL,
+                                                 .table  = hexin_crc32_table_04C11DB7_reflected,
+                                                 .clmul  = &hexin_crc32_clmul_04C11DB7,
+                                                 .combine= &hexin_crc32_combine_04C11DB7 };
+
+static PyObject * _crc32_crc32( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc32 crc32_param_crc32 = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC32_WIDTH,
-                                                     .poly   = CRC32_POLYNOMIAL_04C11DB7,
-                                                     .init   = 0xFFFFFFFFL,
-                                                     .refin  = TRUE,
-                                                     .refout = TRUE,
-                                                     .xorout = 0xFFFFFFFFL,
-                                                     .result = 0 };
+    unsigned int result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc32_param_crc32 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc32_param_crc32 , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc32_param_crc32.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
 static PyObject * _crc32_table( PyObject *self, PyObject *args )
@@ -162,329 +179,729 @@ static PyObject * _crc32_table( PyObject *self, PyObject *args )
     }
 
     for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
-        PyList_SetItem( plist, i, Py_BuildValue( "I", table[i] ) );
+        PyList_SetItem( plist, i, PyLong_FromUnsignedLong( table[i] ) );
     }
 
     return plist;
 }
 
-static PyObject * _crc32_hacker( PyObject *self, PyObject *args, PyObject* kws )
+static unsigned int hexin_crc32_hacker_init( void *param, void *table, struct _hexin_clmul *clmul )
+{
+    return hexin_crc32_compute_init_table( ( struct _hexin_crc32 * )param, ( unsigned int (*)[MAX_TABLE_ARRAY] )table, clmul );
+}
+
+static struct _hexin_hacker_cache crc32_hacker_cache = { NULL, sizeof( unsigned int [MAX_SLICING_ARRAY][MAX_TABLE_ARRAY] ), hexin_crc32_hacker_init, 0 };
+
+static PyObject * _crc32_hacker( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
     unsigned int reinit = FALSE;
+    unsigned int result = 0;
+    struct _hexin_hacker_entry *entry = NULL;
     Py_buffer data = { NULL, NULL };
-    static struct _hexin_crc32 crc32_param_hacker = { .is_initial = FALSE,
-                                                      .is_gradual = FALSE,
-                                                      .width  = HEXIN_CRC32_WIDTH,
-                                                      .poly   = CRC32_POLYNOMIAL_04C11DB7,
-                                                      .init   = 0xFFFFFFFFL,
-                                                      .refin  = TRUE,
-                                                      .refout = TRUE,
-                                                      .xorout = 0xFFFFFFFFL,
-                                                      .result = 0 };
-
-    static char* kwlist[]={ "data", "poly", "init", "xorout", "refin", "refout", "reinit", NULL };
-
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTupleAndKeywords( args, kws, "y*|IIIppp", kwlist, &data,
-                                                                       &crc32_param_hacker.poly,
-                                                                       &crc32_param_hacker.init,
-                                                                       &crc32_param_hacker.xorout,
-                                                                       &crc32_param_hacker.refin,
-                                                                       &crc32_param_hacker.refout,
-                                                                       &reinit ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return NULL;        
+    struct _hexin_crc32 crc32_param_hacker = { .is_initial = FALSE,
+                                               .is_gradual = FALSE,
+                                               .width  = HEXIN_CRC32_WIDTH,
+                                               .poly   = CRC32_POLYNOMIAL_04C11DB7,
+                                               .init   = 0xFFFFFFFFL,
+                                               .refin  = TRUE,
+                                               .refout = TRUE,
+                                               .xorout = 0xFFFFFFFFL };
+
+    static const char *const kwlist[] = { "data", "poly", "init", "xorout", "refin", "refout", "reinit", NULL };
+    PyObject *values[7];
+    unsigned long long poly = crc32_param_hacker.poly, init = crc32_param_hacker.init, xorout = crc32_param_hacker.xorout;
+    unsigned int refin = crc32_param_hacker.refin, refout = crc32_param_hacker.refout;
+
+    if ( ( hexin_fastcall_parse( HEXIN_FASTCALL_ARGS, kwlist, 1, 7, values ) < 0 )
+      || ( ( values[1] != NULL ) && ( hexin_fastcall_mask( values[1], &poly   ) < 0 ) )
+      || ( ( values[2] != NULL ) && ( hexin_fastcall_mask( values[2], &init   ) < 0 ) )
+      || ( ( values[3] != NULL ) && ( hexin_fastcall_mask( values[3], &xorout ) < 0 ) )
+      || ( ( values[4] != NULL ) && ( hexin_fastcall_bool( values[4], &refin  ) < 0 ) )
+      || ( ( values[5] != NULL ) && ( hexin_fastcall_bool( values[5], &refout ) < 0 ) )
+      || ( ( values[6] != NULL ) && ( hexin_fastcall_bool( values[6], &reinit ) < 0 ) )
+      || ( hexin_fastcall_buffer( values[0], &data ) < 0 ) ) {
+        return NULL;
     }
-#else
-    if ( !PyArg_ParseTupleAndKeywords( args, kws, "s*|IIIIII", kwlist, &data,
-                                                                       &crc32_param_hacker.poly,
-                                                                       &crc32_param_hacker.init,
-                                                                       &crc32_param_hacker.xorout,
-                                                                       &crc32_param_hacker.refin,
-                                                                       &crc32_param_hacker.refout,
-                                                                       &reinit ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return NULL;  
+    crc32_param_hacker.poly   = ( unsigned int )poly;
+    crc32_param_hacker.init   = ( unsigned int )init;
+    crc32_param_hacker.xorout = ( unsigned int )xorout;
+    crc32_param_hacker.refin  = refin;
+    crc32_param_hacker.refout = refout;
+
+    /* The tables of the last HEXIN_HACKER_CACHE_SIZE ( poly, orientation ) are kept, reinit=True builds them again. */
+    entry = hexin_hacker_acquire( &crc32_hacker_cache, &crc32_param_hacker, crc32_param_hacker.poly, HEXIN_TABLE_TYPE( &crc32_param_hacker ), reinit );
+    if ( entry == NULL ) {
+        PyBuffer_Release( &data );
+        return NULL;
     }
-#endif /* PY_MAJOR_VERSION */
+    crc32_param_hacker.is_initial = entry->type;
+    crc32_param_hacker.table      = entry->table;
+    crc32_param_hacker.clmul      = &entry->clmul;
 
-    crc32_param_hacker.is_initial = ( reinit == FALSE ) ? crc32_param_hacker.is_initial : FALSE;
-    crc32_param_hacker.result = hexin_crc32_compute( (const unsigned char *)data.buf, (unsigned int)data.len, &crc32_param_hacker, crc32_param_hacker.init );
+    if ( ( size_t )data.len < hexin_gil_threshold() ) {
+        result = hexin_crc32_compute( (const unsigned char *)data.buf, (size_t)data.len, &crc32_param_hacker, crc32_param_hacker.init );
+    } else {
+        Py_BEGIN_ALLOW_THREADS
+        result = hexin_crc32_compute( (const unsigned char *)data.buf, (size_t)data.len, &crc32_param_hacker, crc32_param_hacker.init );
+        Py_END_ALLOW_THREADS
+    }
 
-    if ( data.obj )
-       PyBuffer_Release( &data );
+    hexin_hacker_release( &crc32_hacker_cache, entry );
+    PyBuffer_Release( &data );
 
-    return Py_BuildValue( "I", crc32_param_hacker.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc32_adler32( PyObject *self, PyObject *args )
+static PyObject * _crc32_adler32( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
     unsigned int result   = 0x00000000L;
     unsigned int reserved = 0x00000000L;
  
-    if ( !hexin_PyArg_ParseTuple( self, args, reserved, hexin_calc_crc32_adler, ( unsigned int * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( self, HEXIN_FASTCALL_ARGS, reserved, hexin_calc_crc32_adler, ( unsigned int * )&result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc32_fletcher32( PyObject *self, PyObject *args )
+static PyObject * _crc32_fletcher32( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
     unsigned int result   = 0x00000000L;
     unsigned int reserved = 0x00000000L;
  
-    if ( !hexin_PyArg_ParseTuple( self, args, reserved, hexin_calc_crc32_fletcher, ( unsigned int * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( self, HEXIN_FASTCALL_ARGS, reserved, hexin_calc_crc32_fletcher, ( unsigned int * )&result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc32_posix( PyObject *self, PyObject *args )
+static const struct _hexin_crc32 crc32_param_posix = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                 .width  = HEXIN_CRC32_WIDTH,
+                                                 .poly   = CRC32_POLYNOMIAL_04C11DB7,
+                                                 .init   = 0x00000000L,
+                                                 .refin  = FALSE,
+                                                 .refout = FALSE,
+                                                 .xorout = 0xFFFFFFFFL,
+                                                 .table  = hexin_crc32_table_04C11DB7_normal,
+                                                 .clmul  = &hexin_crc32_clmul_04C11DB7,
+                                                 .combine= &hexin_crc32_combine_04C11DB7 };
+
+static PyObject * _crc32_posix( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc32 crc32_param_posix = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC32_WIDTH,
-                                                     .poly   = CRC32_POLYNOMIAL_04C11DB7,
-                                                     .init   = 0x00000000L,
-                                                     .refin  = FALSE,
-                                                     .refout = FALSE,
-                                                     .xorout = 0xFFFFFFFFL,
-                                                     .result = 0 };
+    unsigned int result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc32_param_posix ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc32_param_posix , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc32_param_posix.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
 /*
 * Alias: CRC-32/AAL5, CRC-32/DECT-B, B-CRC-32
 */
-static PyObject * _crc32_bzip2( PyObject *self, PyObject *args )
+static const struct _hexin_crc32 crc32_param_bzip2 = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                 .width  = HEXIN_CRC32_WIDTH,
+                                                 .poly   = CRC32_POLYNOMIAL_04C11DB7,
+                                                 .init   = 0xFFFFFFFFL,
+                                                 .refin  = FALSE,
+                                                 .refout = FALSE,
+                                                 .xorout = 0xFFFFFFFFL,
+                                                 .table  = hexin_crc32_table_04C11DB7_normal,
+                                                 .clmul  = &hexin_crc32_clmul_04C11DB7,
+                                                 .combine= &hexin_crc32_combine_04C11DB7 };
+
+static PyObject * _crc32_bzip2( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc32 crc32_param_bzip2 = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC32_WIDTH,
-                                                     .poly   = CRC32_POLYNOMIAL_04C11DB7,
-                                                     .init   = 0xFFFFFFFFL,
-                                                     .refin  = FALSE,
-                                                     .refout = FALSE,
-                                                     .xorout = 0xFFFFFFFFL,
-                                                     .result = 0 };
+    unsigned int result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc32_param_bzip2 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc32_param_bzip2 , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc32_param_bzip2.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc32_jamcrc( PyObject *self, PyObject *args )
+static const struct _hexin_crc32 crc32_param_jamcrc = { .is_initial=HEXIN_TABLE_IS_REFLECTED,
+                                                  .width  = HEXIN_CRC32_WIDTH,
+                                                  .poly   = 0x04C11DB7L,
+                                                  .init   = 0xFFFFFFFFL,
+                                                  .refin  = TRUE,
+                                                  .refout = TRUE,
+                                                  .xorout = 0x00000000L,
+                                                  .table  = hexin_crc32_table_04C11DB7_reflected,
+                                                  .clmul  = &hexin_crc32_clmul_04C11DB7,
+                                                  .combine= &hexin_crc32_combine_04C11DB7 };
+
+static PyObject * _crc32_jamcrc( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc32 crc32_param_jamcrc = { .is_initial=FALSE,
-                                                      .width  = HEXIN_CRC32_WIDTH,
-                                                      .poly   = 0x04C11DB7L,
-                                                      .init   = 0xFFFFFFFFL,
-                                                      .refin  = TRUE,
-                                                      .refout = TRUE,
-                                                      .xorout = 0x00000000L,
-                                                      .result = 0 };
+    unsigned int result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc32_param_jamcrc ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc32_param_jamcrc , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc32_param_jamcrc.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc32_autosar( PyObject *self, PyObject *args )
+static const struct _hexin_crc32 crc32_param_autosar = { .is_initial=HEXIN_TABLE_IS_REFLECTED,
+                                                   .width  = HEXIN_CRC32_WIDTH,
+                                                   .poly   = 0xF4ACFB13L,
+                                                   .init   = 0xFFFFFFFFL,
+                                                   .refin  = TRUE,
+                                                   .refout = TRUE,
+                                                   .xorout = 0xFFFFFFFFL,
+                                                   .table  = hexin_crc32_table_F4ACFB13_reflected,
+                                                   .clmul  = &hexin_crc32_clmul_F4ACFB13,
+                                                   .combine= &hexin_crc32_combine_F4ACFB13 };
+
+static PyObject * _crc32_autosar( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc32 crc32_param_autosar = { .is_initial=FALSE,
-                                                       .width  = HEXIN_CRC32_WIDTH,
-                                                       .poly   = 0xF4ACFB13L,
-                                                       .init   = 0xFFFFFFFFL,
-                                                       .refin  = TRUE,
-                                                       .refout = TRUE,
-                                                       .xorout = 0xFFFFFFFFL,
-                                                       .result = 0 };
+    unsigned int result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc32_param_autosar ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc32_param_autosar , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc32_param_autosar.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc32_crc32_c( PyObject *self, PyObject *args )
+static const struct _hexin_crc32 crc32_iscsi = { .is_initial=HEXIN_TABLE_IS_REFLECTED,
+                                           .width  = HEXIN_CRC32_WIDTH,
+                                           .poly   = 0x1EDC6F41L,
+                                           .init   = 0xFFFFFFFFL,
+                                           .refin  = TRUE,
+                                           .refout = TRUE,
+                                           .xorout = 0xFFFFFFFFL,
+                                           .table  = hexin_crc32_table_1EDC6F41_reflected,
+                                           .clmul  = &hexin_crc32_clmul_1EDC6F41,
+                                           .combine= &hexin_crc32_combine_1EDC6F41 };
+
+static PyObject * _crc32_crc32_c( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc32 crc32_iscsi = { .is_initial=FALSE,
-                                               .width  = HEXIN_CRC32_WIDTH,
-                                               .poly   = 0x1EDC6F41L,
-                                               .init   = 0xFFFFFFFFL,
-                                               .refin  = TRUE,
-                                               .refout = TRUE,
-                                               .xorout = 0xFFFFFFFFL,
-                                               .result = 0 };
+    unsigned int result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc32_iscsi ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc32_iscsi , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc32_iscsi.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc32_crc32_d( PyObject *self, PyObject *args )
+static const struct _hexin_crc32 crc32_base91 = { .is_initial=HEXIN_TABLE_IS_REFLECTED,
+                                            .width  = HEXIN_CRC32_WIDTH,
+                                            .poly   = 0xA833982BL,
+                                            .init   = 0xFFFFFFFFL,
+                                            .refin  = TRUE,
+                                            .refout = TRUE,
+                                            .xorout = 0xFFFFFFFFL,
+                                            .table  = hexin_crc32_table_A833982B_reflected,
+                                            .clmul  = &hexin_crc32_clmul_A833982B,
+                                            .combine= &hexin_crc32_combine_A833982B };
+
+static PyObject * _crc32_crc32_d( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc32 crc32_base91 = { .is_initial=FALSE,
-                                                .width  = HEXIN_CRC32_WIDTH,
-                                                .poly   = 0xA833982BL,
-                                                .init   = 0xFFFFFFFFL,
-                                                .refin  = TRUE,
-                                                .refout = TRUE,
-                                                .xorout = 0xFFFFFFFFL,
-                                                .result = 0 };
+    unsigned int result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc32_base91 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc32_base91 , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc32_base91.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc32_crc32_q( PyObject *self, PyObject *args )
+static const struct _hexin_crc32 crc32_aixm = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                          .width  = HEXIN_CRC32_WIDTH,
+                                          .poly   = 0x814141ABL,
+                                          .init   = 0,
+                                          .refin  = FALSE,
+                                          .refout = FALSE,
+                                          .xorout = 0,
+                                          .table  = hexin_crc32_table_814141AB_normal,
+                                          .clmul  = &hexin_crc32_clmul_814141AB,
+                                          .combine= &hexin_crc32_combine_814141AB };
+
+static PyObject * _crc32_crc32_q( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc32 crc32_aixm = { .is_initial=FALSE,
-                                              .width  = HEXIN_CRC32_WIDTH,
-                                              .poly   = 0x814141ABL,
-                                              .init   = 0,
-                                              .refin  = FALSE,
-                                              .refout = FALSE,
-                                              .xorout = 0,
-                                              .result = 0 };
+    unsigned int result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc32_aixm ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc32_aixm , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc32_aixm.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc32_xfer( PyObject *self, PyObject *args )
+static const struct _hexin_crc32 crc32_param_xfer = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                .width  = HEXIN_CRC32_WIDTH,
+                                                .poly   = 0x000000AFL,
+                                                .init   = 0x00000000L,
+                                                .refin  = FALSE,
+                                                .refout = FALSE,
+                                                .xorout = 0x00000000L,
+                                                .table  = hexin_crc32_table_000000AF_normal,
+                                                .clmul  = &hexin_crc32_clmul_000000AF,
+                                                .combine= &hexin_crc32_combine_000000AF };
+
+static PyObject * _crc32_xfer( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc32 crc32_param_xfer = { .is_initial=FALSE,
-                                                    .width  = HEXIN_CRC32_WIDTH,
-                                                    .poly   = 0x000000AFL,
-                                                    .init   = 0x00000000L,
-                                                    .refin  = FALSE,
-                                                    .refout = FALSE,
-                                                    .xorout = 0x00000000L,
-                                                    .result = 0 };
+    unsigned int result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc32_param_xfer ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc32_param_xfer , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc32_param_xfer.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc30_cdma( PyObject *self, PyObject *args )
+static const struct _hexin_crc32 crc30_cdma_param = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                .width  = 30,
+                                                .poly   = CRC30_POLYNOMIAL_2030B9C7,
+                                                .init   = 0x3FFFFFFFL,
+                                                .refin  = FALSE,
+                                                .refout = FALSE,
+                                                .xorout = 0x3FFFFFFFL,
+                                                .table  = hexin_crc30_table_2030B9C7_normal,
+                                                .clmul  = &hexin_crc30_clmul_2030B9C7,
+                                                .combine= &hexin_crc30_combine_2030B9C7 };
+
+static PyObject * _crc30_cdma( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc32 crc30_cdma_param = { .is_initial=FALSE,
-                                                    .width  = 30,
-                                                    .poly   = CRC30_POLYNOMIAL_2030B9C7,
-                                                    .init   = 0x3FFFFFFFL,
-                                                    .refin  = FALSE,
-                                                    .refout = FALSE,
-                                                    .xorout = 0x3FFFFFFFL,
-                                                    .result = 0 };
+    unsigned int result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc30_cdma_param ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc30_cdma_param , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc30_cdma_param.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc31_philips( PyObject *self, PyObject *args )
+static const struct _hexin_crc32 crc31_philips_param = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                   .width  = 31,
+                                                   .poly   = CRC31_POLYNOMIAL_04C11DB7,
+                                                   .init   = 0x7FFFFFFFL,
+                                                   .refin  = FALSE,
+                                                   .refout = FALSE,
+                                                   .xorout = 0x7FFFFFFFL,
+                                                   .table  = hexin_crc31_table_04C11DB7_normal,
+                                                   .clmul  = &hexin_crc31_clmul_04C11DB7,
+                                                   .combine= &hexin_crc31_combine_04C11DB7 };
+
+static PyObject * _crc31_philips( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc32 crc31_philips_param = { .is_initial=FALSE,
-                                                       .width  = 31,
-                                                       .poly   = CRC31_POLYNOMIAL_04C11DB7,
-                                                       .init   = 0x7FFFFFFFL,
-                                                       .refin  = FALSE,
-                                                       .refout = FALSE,
-                                                       .xorout = 0x7FFFFFFFL,
-                                                       .result = 0 };
+    unsigned int result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc31_philips_param ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc31_philips_param , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "I", crc31_philips_param.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc32_stm32( PyObject *self, PyObject *args )
+static PyObject * _crc32_stm32( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc32 crc32_stm32_param = {   .is_initial=FALSE,
-                                                       .width  = 32,
-                                                       .poly   = CRC32_POLYNOMIAL_04C11DB7,
-                                                       .init   = 0xFFFFFFFFL,
-                                                       .refin  = FALSE,
-                                                       .refout = FALSE,
-                                                       .xorout = 0x00000000L,
-                                                       .result = 0 };
-
+    static const struct _hexin_crc32 crc32_stm32_preset = {   .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                              .width  = 32,
+                                                              .poly   = CRC32_POLYNOMIAL_04C11DB7,
+                                                              .init   = 0xFFFFFFFFL,
+                                                              .refin  = FALSE,
+                                                              .refout = FALSE,
+                                                              .xorout = 0x00000000L,
+                                                              .table  = hexin_crc32_table_04C11DB7_normal,
+                                                              .clmul  = &hexin_crc32_clmul_04C11DB7,
+                                                              .combine= &hexin_crc32_combine_04C11DB7 };
+
+    static const char *const kwlist[] = { "data", "init", NULL };
+    struct _hexin_crc32 crc32_stm32_param = crc32_stm32_preset;     /* Per-call state */
     Py_buffer data = { NULL, NULL };
-    unsigned int init = crc32_stm32_param.init;          /* Fixed Issues #4  */
+    PyObject *values[2];
+    unsigned long long value = crc32_stm32_param.init;  /* Fixed Issues #4  */
+    unsigned int init = 0, result = 0;
 
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTuple( args, "y*|I", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
-    }
-#else
-    if ( !PyArg_ParseTuple( args, "s*|I", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
+    if ( ( hexin_fastcall_parse( HEXIN_FASTCALL_ARGS, kwlist, 1, 2, values ) < 0 )
+      || ( ( values[1] != NULL ) && ( hexin_fastcall_mask( values[1], &value ) < 0 ) )
+      || ( hexin_fastcall_buffer( values[0], &data ) < 0 ) ) {
+        return NULL;
     }
-#endif /* PY_MAJOR_VERSION */
+    init = ( unsigned int )value;
 
     /* Fixed Issues #4  */
-    crc32_stm32_param.is_gradual = ( unsigned int )PyTuple_Size( args );   // Fixed warning C4244
+    crc32_stm32_param.is_gradual = ( values[1] != NULL ) ? 2 : 1;
     if ( crc32_stm32_param.is_gradual == 2 ) {
         init = ( init ^ crc32_stm32_param.xorout );
     }
     
-    crc32_stm32_param.result = hexin_crc32_compute_stm32( (const unsigned char *)data.buf, (unsigned int)data.len, &crc32_stm32_param, init );
+    if ( ( size_t )data.len < hexin_gil_threshold() ) {
+        result = hexin_crc32_compute_stm32( (const unsigned char *)data.buf, (size_t)data.len, &crc32_stm32_param, init );
+    } else {
+        Py_BEGIN_ALLOW_THREADS
+        result = hexin_crc32_compute_stm32( (const unsigned char *)data.buf, (size_t)data.len, &crc32_stm32_param, init );
+        Py_END_ALLOW_THREADS
+    }
 
     if ( data.obj )
        PyBuffer_Release( &data );
 
 
-    return Py_BuildValue( "I", crc32_stm32_param.result );
+    return PyLong_FromUnsignedLong( result );
+}
+
+/* Named presets, the method names of the table below */
+static struct {
+    const char          *name;
+    const struct _hexin_crc32 *param;
+} _crc32_presets[] = {
+    { "mpeg2",     &crc32_param_mpeg2 },
+    { "fsc",       &crc32_param_mpeg2 },
+    { "crc32",     &crc32_param_crc32 },
+    { "iso_hdlc32",&crc32_param_crc32 },
+    { "xz32",      &crc32_param_crc32 },
+    { "pkzip",     &crc32_param_crc32 },
+    { "adccp",     &crc32_param_crc32 },
+    { "v_42",      &crc32_param_crc32 },
+    { "posix",     &crc32_param_posix },
+    { "cksum",     &crc32_param_posix },
+    { "bzip2",     &crc32_param_bzip2 },
+    { "aal5",      &crc32_param_bzip2 },
+    { "jamcrc",    &crc32_param_jamcrc },
+    { "autosar",   &crc32_param_autosar },
+    { "crc32_c",   &crc32_iscsi },
+    { "iscsi",     &crc32_iscsi },
+    { "base91_c",  &crc32_iscsi },
+    { "crc32_d",   &crc32_base91 },
+    { "base91_d",  &crc32_base91 },
+    { "crc32_q",   &crc32_aixm },
+    { "aixm",      &crc32_aixm },
+    { "xfer",      &crc32_param_xfer },
+    { "cdma",      &crc30_cdma_param },
+    { "philips",   &crc31_philips_param },
+    { "ecmxf",     &crc32_param_crc32 },
+    { NULL, NULL }
+};
+
+static const struct _hexin_crc32 *hexin_crc32_preset( const char *name )
+{
+    unsigned int i = 0;
+
+    for ( i=0; _crc32_presets[i].name != NULL; i++ ) {
+        if ( 0 == strcmp( _crc32_presets[i].name, name ) ) {
+            return _crc32_presets[i].param;
+        }
+    }
+    return NULL;
+}
+
+static PyObject * _crc32_presets_list( PyObject *self, PyObject *args )
+{
+    unsigned int i = 0;
+    PyObject *names = PyList_New( 0 );
+
+    for ( i=0; ( names != NULL ) && ( _crc32_presets[i].name != NULL ); i++ ) {
+        PyObject *name = Py_BuildValue( "s", _crc32_presets[i].name );
+        if ( ( name == NULL ) || ( PyList_Append( names, name ) < 0 ) ) {
+            Py_XDECREF( name );
+            Py_DECREF( names );
+            return NULL;
+        }
+        Py_DECREF( name );
+    }
+    return names;
+}
+
+static PyObject * _crc32_combine( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    unsigned long long crc_a = 0, crc_b = 0, len_b = 0, mask = 0;
+    const struct _hexin_crc32 *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "sO&O&O&", &name, hexin_PyArg_count, &crc_a, hexin_PyArg_count, &crc_b, hexin_PyArg_count, &len_b ) ) {
+        return NULL;
+    }
+
+    param = hexin_crc32_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+
+    mask = ( param->width >= 64 ) ? ~0ULL : ( ( 1ULL << param->width ) - 1 );
+    if ( ( crc_a | crc_b ) & ~mask ) {
+        PyErr_Format( PyExc_ValueError, "%s is a %u-bit CRC", name, ( unsigned int )param->width );
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLongLong( hexin_crc32_combine( param, ( unsigned int )crc_a, ( unsigned int )crc_b, len_b ) );
+}
+
+static PyObject * _crc32_extend_zeros( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    unsigned long long crc = 0, len = 0, mask = 0;
+    const struct _hexin_crc32 *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "sO&O&", &name, hexin_PyArg_count, &crc, hexin_PyArg_count, &len ) ) {
+        return NULL;
+    }
+
+    param = hexin_crc32_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+
+    mask = ( param->width >= 64 ) ? ~0ULL : ( ( 1ULL << param->width ) - 1 );
+    if ( crc & ~mask ) {
+        PyErr_Format( PyExc_ValueError, "%s is a %u-bit CRC", name, ( unsigned int )param->width );
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLongLong( hexin_crc32_extend_zeros( param, ( unsigned int )crc, len ) );
+}
+
+static PyObject * _crc32_extend_repeat( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    unsigned long long crc = 0, count = 0, mask = 0;
+    const struct _hexin_crc32 *param = NULL;
+    Py_buffer data = { NULL, NULL };
+    unsigned int result = 0;
+
+#if PY_MAJOR_VERSION >= 3
+    if ( !PyArg_ParseTuple( args, "sO&y*O&", &name, hexin_PyArg_count, &crc, &data, hexin_PyArg_count, &count ) ) {
+#else
+    if ( !PyArg_ParseTuple( args, "sO&s*O&", &name, hexin_PyArg_count, &crc, &data, hexin_PyArg_count, &count ) ) {
+#endif /* PY_MAJOR_VERSION */
+        return NULL;
+    }
+
+    param = hexin_crc32_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        PyBuffer_Release( &data );
+        return NULL;
+    }
+
+    mask = ( param->width >= 64 ) ? ~0ULL : ( ( 1ULL << param->width ) - 1 );
+    if ( crc & ~mask ) {
+        PyErr_Format( PyExc_ValueError, "%s is a %u-bit CRC", name, ( unsigned int )param->width );
+        PyBuffer_Release( &data );
+        return NULL;
+    }
+
+    if ( ( size_t )data.len < hexin_gil_threshold() ) {
+        result = hexin_crc32_extend_repeat( param, ( unsigned int )crc, ( const unsigned char * )data.buf, ( size_t )data.len, count );
+    } else {
+        Py_BEGIN_ALLOW_THREADS
+        result = hexin_crc32_extend_repeat( param, ( unsigned int )crc, ( const unsigned char * )data.buf, ( size_t )data.len, count );
+        Py_END_ALLOW_THREADS
+    }
+    PyBuffer_Release( &data );
+    return PyLong_FromUnsignedLongLong( result );
+}
+
+static PyObject * _crc32_update_range( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    unsigned long long crc = 0, offset = 0, total = 0, mask = 0;
+    const struct _hexin_crc32 *param = NULL;
+    Py_buffer before = { NULL, NULL }, after = { NULL, NULL };
+    PyObject *result = NULL;
+
+#if PY_MAJOR_VERSION >= 3
+    if ( !PyArg_ParseTuple( args, "sO&O&y*y*O&", &name, hexin_PyArg_count, &crc, hexin_PyArg_count, &offset, &before, &after, hexin_PyArg_count, &total ) ) {
+#else
+    if ( !PyArg_ParseTuple( args, "sO&O&s*s*O&", &name, hexin_PyArg_count, &crc, hexin_PyArg_count, &offset, &before, &after, hexin_PyArg_count, &total ) ) {
+#endif /* PY_MAJOR_VERSION */
+        return NULL;
+    }
+
+    param = hexin_crc32_preset( name );
+    mask  = ( ( param == NULL ) || ( param->width >= 64 ) ) ? ~0ULL : ( ( 1ULL << param->width ) - 1 );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+    } else if ( crc & ~mask ) {
+        PyErr_Format( PyExc_ValueError, "%s is a %u-bit CRC", name, ( unsigned int )param->width );
+    } else if ( before.len != after.len ) {
+        PyErr_SetString( PyExc_ValueError, "old_bytes and new_bytes differ in length" );
+    } else if ( ( offset > total ) || ( ( unsigned long long )before.len > total - offset ) ) {
+        PyErr_SetString( PyExc_ValueError, "the range is out of the message" );
+    } else {
+        result = PyLong_FromUnsignedLongLong( hexin_crc32_update_range( param, ( unsigned int )crc, ( const unsigned char * )before.buf, ( const unsigned char * )after.buf,
+                                                                       ( size_t )before.len, total - offset - ( unsigned long long )before.len ) );
+    }
+    PyBuffer_Release( &before );
+    PyBuffer_Release( &after );
+    return result;
+}
+
+static unsigned long long hexin_crc32_hasher_begin( const void *param )
+{
+    struct _hexin_crc32 local = *( const struct _hexin_crc32 * )param;
+
+    local.is_gradual = FALSE;
+    return hexin_crc32_compute_begin( &local, local.init );
+}
+
+static unsigned long long hexin_crc32_hasher_update( const void *param, unsigned long long crc, const unsigned char *pSrc, size_t len )
+{
+    return hexin_crc32_compute_update( ( const struct _hexin_crc32 * )param, ( unsigned int )crc, pSrc, len );
+}
+
+static unsigned long long hexin_crc32_hasher_end( const void *param, unsigned long long crc )
+{
+    return hexin_crc32_compute_end( ( const struct _hexin_crc32 * )param, ( unsigned int )crc );
+}
+
+static const struct _hexin_hasher_ops crc32_hasher_ops = { hexin_crc32_hasher_begin, hexin_crc32_hasher_update, hexin_crc32_hasher_end };
+
+/* adler32 is no CRC, but it rides along in _multi : 1 to begin, the sums carried block by block, no final step. */
+static unsigned long long hexin_adler32_hasher_begin( const void *param )
+{
+    return 1;
+}
+
+static unsigned long long hexin_adler32_hasher_update( const void *param, unsigned long long adler, const unsigned char *pSrc, size_t len )
+{
+    return hexin_crc32_adler_update( ( unsigned int )adler, pSrc, len );
+}
+
+static unsigned long long hexin_adler32_hasher_end( const void *param, unsigned long long adler )
+{
+    return adler;
+}
+
+static const struct _hexin_hasher_ops adler32_hasher_ops = { hexin_adler32_hasher_begin, hexin_adler32_hasher_update, hexin_adler32_hasher_end };
+
+static PyObject * _crc32_new( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    const struct _hexin_crc32 *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "s", &name ) ) {
+        return NULL;
+    }
+
+    param = hexin_crc32_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+    return hexin_hasher_new( &crc32_hasher_ops, param, name, param->width, NULL );
+}
+
+static PyObject * _crc32_batch( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    PyObject *data = NULL, *out = NULL, *offsets = Py_None, *lengths = Py_None, *expected = Py_None;
+    int rows = 0;
+    const struct _hexin_crc32 *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "sOO|OOOi", &name, &data, &out, &offsets, &lengths, &expected, &rows ) ) {
+        return NULL;
+    }
+
+    param = hexin_crc32_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+    return hexin_batch_compute( &crc32_hasher_ops, param, param->width, data, out,
+                                ( offsets  == Py_None ) ? NULL : offsets,
+                                ( lengths  == Py_None ) ? NULL : lengths,
+                                ( expected == Py_None ) ? NULL : expected, rows );
+}
+
+static PyObject * _crc32_file( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    PyObject *file = NULL;
+    const struct _hexin_crc32 *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "sO", &name, &file ) ) {
+        return NULL;
+    }
+
+    param = hexin_crc32_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+    return hexin_file_compute( &crc32_hasher_ops, param, file );
+}
+
+static PyObject * _crc32_files( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    PyObject *files = NULL;
+    unsigned int threads = 0;
+    const struct _hexin_crc32 *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "sO|O&", &name, &files, hexin_PyArg_threads, &threads ) ) {
+        return NULL;
+    }
+
+    param = hexin_crc32_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+    return hexin_file_compute_many( &crc32_hasher_ops, param, files, threads );
+}
+
+static PyObject * _crc32_capsule( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    const struct _hexin_crc32 *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "s", &name ) ) {
+        return NULL;
+    }
+
+    if ( strcmp( name, "adler32" ) == 0 ) {
+        return hexin_multi_capsule( &adler32_hasher_ops, NULL, NULL );
+    }
+
+    param = hexin_crc32_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+    return hexin_multi_capsule( &crc32_hasher_ops, param, NULL );
+}
+
+static PyObject * _crc32_kernels( PyObject *self, PyObject *args )
+{
+    const char *crc32c = hexin_clmul_kernel();
+
+    if ( hexin_crc32c_is_supported() ) {
+        crc32c = ( hexin_clmul_level() == HEXIN_CLMUL_LEVEL_VPCLMUL ) ? "vpclmul+sse42" : "sse42";
+    }
+    return Py_BuildValue( "{s:s,s:s}", "crc32", hexin_clmul_kernel(), "crc32c", crc32c );
+}
+
+static PyObject * _crc32_gil_threshold( PyObject *self, PyObject *args )
+{
+    Py_ssize_t threshold = -1;
+
+    if ( !PyArg_ParseTuple( args, "|n", &threshold ) ) {
+        return NULL;
+    }
+    return PyLong_FromSize_t( hexin_set_gil_threshold( ( threshold < 0 ) ? ( size_t )-1 : ( size_t )threshold ) );
 }
 
 /* method table */
 static PyMethodDef _crc32Methods[] = {
-    { "mpeg2",       (PyCFunction)_crc32_mpeg_2,     METH_VARARGS,   "Calculate CRC (MPEG2) of CRC32 [Poly=0x04C11DB7, Init=0xFFFFFFFF, Xorout=0x00000000 Refin=False Refout=False]"},
-    { "fsc",         (PyCFunction)_crc32_mpeg_2,     METH_VARARGS,   "Calculate CRC (Ethernt's FSC) of CRC32 [Poly=0x04C11DB7, Init=0xFFFFFFFF, Xorout=0x00000000 Refin=False Refout=False]"},
-    { "crc32",       (PyCFunction)_crc32_crc32,      METH_VARARGS,   "Calculate CRC (WinRAR, File) of CRC32  [Poly=0xEDB88320, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "iso_hdlc32",  (PyCFunction)_crc32_crc32,      METH_VARARGS,   "Calculate ISO-HDLC of CRC32  [Poly=0xEDB88320, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "xz32",        (PyCFunction)_crc32_crc32,      METH_VARARGS,   "Calculate XZ of CRC32  [Poly=0xEDB88320, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "pkzip",       (PyCFunction)_crc32_crc32,      METH_VARARGS,   "Calculate PKZIP of CRC32  [Poly=0xEDB88320, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "adccp",       (PyCFunction)_crc32_crc32,      METH_VARARGS,   "Calculate ADCCP of CRC32  [Poly=0xEDB88320, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "v_42",        (PyCFunction)_crc32_crc32,      METH_VARARGS,   "Calculate V-42 of CRC32  [Poly=0xEDB88320, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "mpeg2",       (PyCFunction)_crc32_mpeg_2,     HEXIN_METH_FASTCALL,   "Calculate CRC (MPEG2) of CRC32 [Poly=0x04C11DB7, Init=0xFFFFFFFF, Xorout=0x00000000 Refin=False Refout=False]"},
+    { "fsc",         (PyCFunction)_crc32_mpeg_2,     HEXIN_METH_FASTCALL,   "Calculate CRC (Ethernt's FSC) of CRC32 [Poly=0x04C11DB7, Init=0xFFFFFFFF, Xorout=0x00000000 Refin=False Refout=False]"},
+    { "crc32",       (PyCFunction)_crc32_crc32,      HEXIN_METH_FASTCALL,   "Calculate CRC (WinRAR, File) of CRC32  [Poly=0xEDB88320, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "iso_hdlc32",  (PyCFunction)_crc32_crc32,      HEXIN_METH_FASTCALL,   "Calculate ISO-HDLC of CRC32  [Poly=0xEDB88320, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "xz32",        (PyCFunction)_crc32_crc32,      HEXIN_METH_FASTCALL,   "Calculate XZ of CRC32  [Poly=0xEDB88320, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "pkzip",       (PyCFunction)_crc32_crc32,      HEXIN_METH_FASTCALL,   "Calculate PKZIP of CRC32  [Poly=0xEDB88320, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "adccp",       (PyCFunction)_crc32_crc32,      HEXIN_METH_FASTCALL,   "Calculate ADCCP of CRC32  [Poly=0xEDB88320, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "v_42",        (PyCFunction)_crc32_crc32,      HEXIN_METH_FASTCALL,   "Calculate V-42 of CRC32  [Poly=0xEDB88320, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
     { "table32",     (PyCFunction)_crc32_table,      METH_VARARGS,   "Print CRC32 table to list. libscrc.table32( polynomial, False, 32 )" },
-    { "hacker32",    (PyCFunction)_crc32_hacker,     METH_KEYWORDS|METH_VARARGS, "User calculation CRC32\n"
+    { "hacker32",    (PyCFunction)_crc32_hacker,     HEXIN_METH_FASTCALL, "User calculation CRC32\n"
                                                                                  "@data   : bytes\n"
                                                                                  "@poly   : default=0x04C11DB7\n"
                                                                                  "@init   : default=0xFFFFFFFF\n"
@@ -492,26 +909,39 @@ static PyMethodDef _crc32Methods[] = {
                                                                                  "@refin  : default=True\n"
                                                                                  "@refout : default=True\n"
                                                                                  "@reinit : default=False" },
-    { "adler32",    (PyCFunction)_crc32_adler32,     METH_VARARGS,   "Calculate adler32 (MOD=65521)" },
-    { "fletcher32", (PyCFunction)_crc32_fletcher32,  METH_VARARGS,   "Calculate fletcher32" },
-    { "posix",      (PyCFunction)_crc32_posix,       METH_VARARGS,   "Calculate CRC (POSIX) of CRC32 [Poly=0x04C11DB7, Init=0x00000000, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "cksum",      (PyCFunction)_crc32_posix,       METH_VARARGS,   "Calculate CRC (CKSUM) of CRC32 [Poly=0x04C11DB7, Init=0x00000000, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "bzip2",      (PyCFunction)_crc32_bzip2,       METH_VARARGS,   "Calculate CRC (BZIP2) of CRC32 [Poly=0x04C11DB7, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "aal5",       (PyCFunction)_crc32_bzip2,       METH_VARARGS,   "Calculate CRC (AAL5) of CRC32 [Poly=0x04C11DB7, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "jamcrc",     (PyCFunction)_crc32_jamcrc,      METH_VARARGS,   "Calculate CRC (JAMCRC) of CRC32 [Poly=0x04C11DB7, Init=0xFFFFFFFF, Xorout=0x00000000 Refin=True Refout=True]"},
-    { "autosar",    (PyCFunction)_crc32_autosar,     METH_VARARGS,   "Calculate CRC (AUTOSAR) of CRC32 [Poly=0xF4ACFB13, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "crc32_c",    (PyCFunction)_crc32_crc32_c,     METH_VARARGS,   "Calculate CRC (CRC32-C) of CRC32 [Poly=0x1EDC6F41, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "iscsi",      (PyCFunction)_crc32_crc32_c,     METH_VARARGS,   "Calculate CRC (ISCSI) of CRC32 [Poly=0x1EDC6F41, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "base91_c",   (PyCFunction)_crc32_crc32_c,     METH_VARARGS,   "Calculate CRC (BASE91-C) of CRC32 [Poly=0x1EDC6F41, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "crc32_d",    (PyCFunction)_crc32_crc32_d,     METH_VARARGS,   "Calculate CRC (CRC32-D) of CRC32 [Poly=0xA833982B, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "base91_d",   (PyCFunction)_crc32_crc32_d,     METH_VARARGS,   "Calculate CRC (BASE91-D) of CRC32 [Poly=0xA833982B, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
-    { "crc32_q",    (PyCFunction)_crc32_crc32_q,     METH_VARARGS,   "Calculate CRC (CRC32-Q) of CRC32 [Poly=0x814141AB, Init=0x00000000, Xorout=0x00000000 Refin=True Refout=True]"},
-    { "aixm",       (PyCFunction)_crc32_crc32_q,     METH_VARARGS,   "Calculate CRC (AIXM) of CRC32 [Poly=0x814141AB, Init=0x00000000, Xorout=0x00000000 Refin=True Refout=True]"},
-    { "xfer",       (PyCFunction)_crc32_xfer,        METH_VARARGS,   "Calculate CRC (XFER) of CRC32 [Poly=0x000000AF, Init=0x00000000, Xorout=0x00000000 Refin=True Refout=True]"},
-    { "cdma",       (PyCFunction)_crc30_cdma,        METH_VARARGS,   "Calculate CDMA of CRC30 [Poly=0x2030B9C7, Init=0x3FFFFFFF, Xorout=0x3FFFFFFF Refin=False Refout=False]"},
-    { "philips",    (PyCFunction)_crc31_philips,     METH_VARARGS,   "Calculate PHILIPS of CRC31 [Poly=0x04C11DB7, Init=0x7FFFFFFF, Xorout=0x7FFFFFFF Refin=False Refout=False]"},
-    { "stm32",      (PyCFunction)_crc32_stm32,       METH_VARARGS,   "Calculate STM32 of CRC32 (Hardware calculate CRC32)"},
-    { "ecmxf",      (PyCFunction)_crc32_crc32,       METH_VARARGS,   "Calculate ECMXF of CRC32" },
+    { "adler32",    (PyCFunction)_crc32_adler32,     HEXIN_METH_FASTCALL,   "Calculate adler32 (MOD=65521)" },
+    { "fletcher32", (PyCFunction)_crc32_fletcher32,  HEXIN_METH_FASTCALL,   "Calculate fletcher32" },
+    { "posix",      (PyCFunction)_crc32_posix,       HEXIN_METH_FASTCALL,   "Calculate CRC (POSIX) of CRC32 [Poly=0x04C11DB7, Init=0x00000000, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "cksum",      (PyCFunction)_crc32_posix,       HEXIN_METH_FASTCALL,   "Calculate CRC (CKSUM) of CRC32 [Poly=0x04C11DB7, Init=0x00000000, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "bzip2",      (PyCFunction)_crc32_bzip2,       HEXIN_METH_FASTCALL,   "Calculate CRC (BZIP2) of CRC32 [Poly=0x04C11DB7, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "aal5",       (PyCFunction)_crc32_bzip2,       HEXIN_METH_FASTCALL,   "Calculate CRC (AAL5) of CRC32 [Poly=0x04C11DB7, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "jamcrc",     (PyCFunction)_crc32_jamcrc,      HEXIN_METH_FASTCALL,   "Calculate CRC (JAMCRC) of CRC32 [Poly=0x04C11DB7, Init=0xFFFFFFFF, Xorout=0x00000000 Refin=True Refout=True]"},
+    { "autosar",    (PyCFunction)_crc32_autosar,     HEXIN_METH_FASTCALL,   "Calculate CRC (AUTOSAR) of CRC32 [Poly=0xF4ACFB13, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "crc32_c",    (PyCFunction)_crc32_crc32_c,     HEXIN_METH_FASTCALL,   "Calculate CRC (CRC32-C) of CRC32 [Poly=0x1EDC6F41, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "iscsi",      (PyCFunction)_crc32_crc32_c,     HEXIN_METH_FASTCALL,   "Calculate CRC (ISCSI) of CRC32 [Poly=0x1EDC6F41, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "base91_c",   (PyCFunction)_crc32_crc32_c,     HEXIN_METH_FASTCALL,   "Calculate CRC (BASE91-C) of CRC32 [Poly=0x1EDC6F41, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "crc32_d",    (PyCFunction)_crc32_crc32_d,     HEXIN_METH_FASTCALL,   "Calculate CRC (CRC32-D) of CRC32 [Poly=0xA833982B, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "base91_d",   (PyCFunction)_crc32_crc32_d,     HEXIN_METH_FASTCALL,   "Calculate CRC (BASE91-D) of CRC32 [Poly=0xA833982B, Init=0xFFFFFFFF, Xorout=0xFFFFFFFF Refin=True Refout=True]"},
+    { "crc32_q",    (PyCFunction)_crc32_crc32_q,     HEXIN_METH_FASTCALL,   "Calculate CRC (CRC32-Q) of CRC32 [Poly=0x814141AB, Init=0x00000000, Xorout=0x00000000 Refin=True Refout=True]"},
+    { "aixm",       (PyCFunction)_crc32_crc32_q,     HEXIN_METH_FASTCALL,   "Calculate CRC (AIXM) of CRC32 [Poly=0x814141AB, Init=0x00000000, Xorout=0x00000000 Refin=True Refout=True]"},
+    { "xfer",       (PyCFunction)_crc32_xfer,        HEXIN_METH_FASTCALL,   "Calculate CRC (XFER) of CRC32 [Poly=0x000000AF, Init=0x00000000, Xorout=0x00000000 Refin=True Refout=True]"},
+    { "cdma",       (PyCFunction)_crc30_cdma,        HEXIN_METH_FASTCALL,   "Calculate CDMA of CRC30 [Poly=0x2030B9C7, Init=0x3FFFFFFF, Xorout=0x3FFFFFFF Refin=False Refout=False]"},
+    { "philips",    (PyCFunction)_crc31_philips,     HEXIN_METH_FASTCALL,   "Calculate PHILIPS of CRC31 [Poly=0x04C11DB7, Init=0x7FFFFFFF, Xorout=0x7FFFFFFF Refin=False Refout=False]"},
+    { "stm32",      (PyCFunction)_crc32_stm32,       HEXIN_METH_FASTCALL,   "Calculate STM32 of CRC32 (Hardware calculate CRC32)"},
+    { "ecmxf",      (PyCFunction)_crc32_crc32,       HEXIN_METH_FASTCALL,   "Calculate ECMXF of CRC32" },
+    { "_kernels",    (PyCFunction)_crc32_kernels, METH_NOARGS, "The kernel tier every family of this module is bound to." },
+    { "_gil_threshold", (PyCFunction)_crc32_gil_threshold, METH_VARARGS, "Release the GIL for buffers of at least this many bytes, returns the previous value." },
+    { "_presets",    (PyCFunction)_crc32_presets_list, METH_NOARGS, "The names of the presets of this module." },
+    { "_combine",    (PyCFunction)_crc32_combine, METH_VARARGS, "CRC( A || B ) of a preset : _combine( name, crc_a, crc_b, len_b )" },
+    { "_extend_zeros",  (PyCFunction)_crc32_extend_zeros,  METH_VARARGS, "CRC( A || n zero bytes ) : _extend_zeros( name, crc, n )" },
+    { "_extend_repeat", (PyCFunction)_crc32_extend_repeat, METH_VARARGS, "CRC( A || block * count ) : _extend_repeat( name, crc, block, count )" },
+    { "_update_range",  (PyCFunction)_crc32_update_range,  METH_VARARGS, "CRC after a range was rewritten : _update_range( name, crc, offset, old, new, total_len )" },
+    { "_new",        (PyCFunction)_crc32_new, METH_VARARGS, "A hashlib-style hasher of a preset : _new( name )" },
+    { "_batch",      (PyCFunction)_crc32_batch, METH_VARARGS, "CRC of many buffers into an integer array : _batch( name, data, out, offsets, lengths, expected, rows )" },
+    { "_file",       (PyCFunction)_crc32_file, METH_VARARGS, "CRC of a file without the GIL : _file( name, path or fd )" },
+    { "_files",      (PyCFunction)_crc32_files, METH_VARARGS, "( crc, size ) of many files on a thread pool : _files( name, files, threads=0 )" },
+    { "_capsule",    (PyCFunction)_crc32_capsule, METH_VARARGS, "The kernel of a preset ( or adler32 ) for _multi : _capsule( name )" },
+    { "_multi",      (PyCFunction)hexin_multi_compute, METH_VARARGS, "Many CRCs of data in one pass : _multi( data, capsules )" },
     { NULL, NULL, 0, NULL }        /* Sentinel */
 };
 
@@ -570,9 +1000,29 @@ PyInit__crc32( void )
         return NULL;
     }
 
+    if ( ( hexin_hasher_ready( m ) < 0 ) || ( hexin_hacker_ready( &crc32_hacker_cache ) < 0 ) ) {
+        Py_DECREF( m );
+        return NULL;
+    }
+
     PyModule_AddStringConstant( m, "__version__", "1.7"  );
     PyModule_AddStringConstant( m, "__author__",  "Heyn" );
 
+    /* Probe the CPU once and pick the kernel tier ( AVX-512 / PCLMULQDQ / tables ), LIBSCRC_KERNEL may lower it. */
+    hexin_clmul_level();
+    hexin_crc32c_is_supported();
+    hexin_gil_threshold();
+
+    if ( !hexin_kernel_is_known() && ( PyErr_WarnEx( PyExc_RuntimeWarning, HEXIN_KERNEL_UNKNOWN, 1 ) < 0 ) ) {
+        Py_DECREF( m );
+        return NULL;
+    }
+
+#ifdef Py_GIL_DISABLED
+    /* The presets are read-only and every call keeps its state on the stack. */
+    PyUnstable_Module_SetGIL( m, Py_MOD_GIL_NOT_USED );
+#endif
+
     return m;
 }
 
@@ -582,7 +1032,12 @@ PyInit__crc32( void )
 PyMODINIT_FUNC
 init_crc32( void )
 {
-    ( void ) Py_InitModule3( "_crc32", _crc32Methods, _crc32_doc );
+    PyObject *m = Py_InitModule3( "_crc32", _crc32Methods, _crc32_doc );
+
+    if ( m != NULL ) {
+        hexin_hasher_ready( m );
+        hexin_hacker_ready( &crc32_hacker_cache );
+    }
 }
 
 #endif /* PY_MAJOR_VERSION */
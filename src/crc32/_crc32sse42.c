@@ -0,0 +1,170 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2017-2022, Hexin
+*                                           All Rights Reserved
+* File    : _crc32sse42.c
+* Version : V1.7
+*
+*   The crc32 instruction has a latency of 3 cycles and a throughput of 1 per cycle, so three
+*   independent streams keep the unit busy. The stream registers are merged with zero-shift tables:
+*   crc( A || B ) = crc( A ) * x^( 8 * len(B) ) mod P + crc0( B ).
+*
+*********************************************************************************************************
+*/
+
+#include <string.h>
+#include "_crc32sse42.h"
+#include "_dispatch.h"
+
+#ifndef TRUE
+#define                 TRUE                                    1
+#endif
+
+#ifndef FALSE
+#define                 FALSE                                   0
+#endif
+
+#define                 HEXIN_CRC32C_POLYNOMIAL_REFLECTED       0x82F63B78L
+#define                 HEXIN_CRC32C_LONG                       8192    /* Bytes per stream */
+#define                 HEXIN_CRC32C_SHORT                      256
+
+#if defined( __x86_64__ ) || defined( _M_X64 )
+
+#if defined( _MSC_VER )
+#include <nmmintrin.h>
+#include <intrin.h>
+#define HEXIN_SSE42_TARGET
+#define HEXIN_CRC32C_BARRIER()  _ReadWriteBarrier()
+#else
+#include <nmmintrin.h>
+#define HEXIN_SSE42_TARGET  __attribute__( ( target( "sse4.2" ) ) )
+#define HEXIN_CRC32C_BARRIER()  __sync_synchronize()
+#endif
+
+static int          __hexin_crc32c_supported = -1;
+static unsigned int __hexin_crc32c_long[4][256];
+static unsigned int __hexin_crc32c_short[4][256];
+
+/* a * b mod P(x), both bit-reflected */
+static unsigned int hexin_crc32c_multiply( unsigned int a, unsigned int b )
+{
+    unsigned int i = 0;
+    unsigned int p = 0;
+
+    for ( i=0; i<32; i++ ) {
+        if ( a & ( 0x80000000L >> i ) ) {
+            p ^= b;
+        }
+        b = ( b & 0x01 ) ? ( ( b >> 1 ) ^ HEXIN_CRC32C_POLYNOMIAL_REFLECTED ) : ( b >> 1 );
+    }
+    return p;
+}
+
+static void hexin_crc32c_init_shift_table( unsigned int len, unsigned int (*table)[256] )
+{
+    unsigned int i = 0, k = 0;
+    unsigned int xn = 0x80000000L;      /* x^0 */
+
+    for ( i=0; i<len*8; i++ ) {
+        xn = ( xn & 0x01 ) ? ( ( xn >> 1 ) ^ HEXIN_CRC32C_POLYNOMIAL_REFLECTED ) : ( xn >> 1 );
+    }
+
+    for ( k=0; k<4; k++ ) {
+        for ( i=0; i<256; i++ ) {
+            table[k][i] = hexin_crc32c_multiply( i << ( 8*k ), xn );
+        }
+    }
+}
+
+static unsigned int hexin_crc32c_shift( unsigned int crc, unsigned int (*table)[256] )
+{
+    return table[0][ crc & 0xFF ] ^ table[1][ ( crc >> 8 ) & 0xFF ] ^ table[2][ ( crc >> 16 ) & 0xFF ] ^ table[3][ crc >> 24 ];
+}
+
+/*
+ * The shift tables are built before the flag is published : a caller that sees TRUE ( another thread
+ * under Py_GIL_DISABLED ) never reads a table still being filled. Racing builders write the same values.
+ */
+unsigned int hexin_crc32c_is_supported( void )
+{
+    int supported = __hexin_crc32c_supported;
+
+    if ( supported < 0 ) {
+        supported = ( ( hexin_kernel_tier() >= HEXIN_KERNEL_SSE42 ) && ( hexin_cpu_features() & HEXIN_CPU_SSE42 ) ) ? TRUE : FALSE;
+        if ( supported ) {
+            hexin_crc32c_init_shift_table( HEXIN_CRC32C_LONG,  __hexin_crc32c_long  );
+            hexin_crc32c_init_shift_table( HEXIN_CRC32C_SHORT, __hexin_crc32c_short );
+        }
+        HEXIN_CRC32C_BARRIER();
+        __hexin_crc32c_supported = supported;
+    }
+    return ( unsigned int )supported;
+}
+
+static unsigned long long hexin_crc32c_load( const unsigned char *p )
+{
+    unsigned long long v = 0;
+    memcpy( &v, p, sizeof( v ) );
+    return v;
+}
+
+HEXIN_SSE42_TARGET
+static unsigned long long hexin_crc32c_streams( unsigned long long crc0, const unsigned char *pSrc, size_t size, unsigned int (*table)[256] )
+{
+    unsigned long long crc1 = 0, crc2 = 0;
+    const unsigned char *end = pSrc + size;
+
+    do {
+        crc0 = _mm_crc32_u64( crc0, hexin_crc32c_load( pSrc ) );
+        crc1 = _mm_crc32_u64( crc1, hexin_crc32c_load( pSrc + size ) );
+        crc2 = _mm_crc32_u64( crc2, hexin_crc32c_load( pSrc + size*2 ) );
+        pSrc += 8;
+    } while ( pSrc < end );
+
+    crc0 = hexin_crc32c_shift( ( unsigned int )crc0, table ) ^ crc1;
+    crc0 = hexin_crc32c_shift( ( unsigned int )crc0, table ) ^ crc2;
+    return crc0;
+}
+
+HEXIN_SSE42_TARGET
+unsigned int hexin_crc32c_compute( unsigned int crc, const unsigned char *pSrc, size_t len )
+{
+    unsigned long long crc0 = crc;
+
+    while ( len >= HEXIN_CRC32C_LONG*3 ) {
+        crc0  = hexin_crc32c_streams( crc0, pSrc, HEXIN_CRC32C_LONG, __hexin_crc32c_long );
+        pSrc += HEXIN_CRC32C_LONG*3;
+        len  -= HEXIN_CRC32C_LONG*3;
+    }
+
+    while ( len >= HEXIN_CRC32C_SHORT*3 ) {
+        crc0  = hexin_crc32c_streams( crc0, pSrc, HEXIN_CRC32C_SHORT, __hexin_crc32c_short );
+        pSrc += HEXIN_CRC32C_SHORT*3;
+        len  -= HEXIN_CRC32C_SHORT*3;
+    }
+
+    for ( ; len >= 8; len -= 8, pSrc += 8 ) {
+        crc0 = _mm_crc32_u64( crc0, hexin_crc32c_load( pSrc ) );
+    }
+
+    for ( ; len > 0; len--, pSrc++ ) {
+        crc0 = _mm_crc32_u8( ( unsigned int )crc0, *pSrc );
+    }
+
+    return ( unsigned int )crc0;
+}
+
+#else
+
+unsigned int hexin_crc32c_is_supported( void )
+{
+    return FALSE;
+}
+
+unsigned int hexin_crc32c_compute( unsigned int crc, const unsigned char *pSrc, size_t len )
+{
+    ( void )pSrc; ( void )len;
+    return crc;
+}
+
+#endif
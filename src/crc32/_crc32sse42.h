@@ -0,0 +1,27 @@
+/*
+*********************************************************************************************************
+*                              		(c) Copyright 2017-2022, Hexin
+*                                           All Rights Reserved
+* File    : _crc32sse42.h
+* Version : V1.7
+*
+*   CRC-32C (Castagnoli) with the SSE4.2 crc32 instruction.
+*
+*********************************************************************************************************
+*/
+
+#ifndef __CRC32_SSE42_H__
+#define __CRC32_SSE42_H__
+
+#include <stddef.h>
+
+#define                 CRC32_POLYNOMIAL_1EDC6F41               0x1EDC6F41L
+
+unsigned int hexin_crc32c_is_supported( void );
+
+/*
+ * crc : bit-reflected register ( LSB-first ), neither pre- nor post-inverted.
+ */
+unsigned int hexin_crc32c_compute( unsigned int crc, const unsigned char *pSrc, size_t len );
+
+#endif //__CRC32_SSE42_H__
@@ -33,12 +33,11 @@ static unsigned char __hexin_reverse8( unsigned char data )
 
 unsigned int hexin_reverse32( unsigned int data )
 {
-    unsigned int i = 0;
-    unsigned int t = 0;
-    for ( i=0; i<32; i++ ) {
-        t |= ( ( data >> i ) & 0x00000001 ) << ( 31-i );
-    }
-    return t;
+    data = ( ( data >> 1 ) & 0x55555555L ) | ( ( data & 0x55555555L ) << 1 );
+    data = ( ( data >> 2 ) & 0x33333333L ) | ( ( data & 0x33333333L ) << 2 );
+    data = ( ( data >> 4 ) & 0x0F0F0F0FL ) | ( ( data & 0x0F0F0F0FL ) << 4 );
+    data = ( ( data >> 8 ) & 0x00FF00FFL ) | ( ( data & 0x00FF00FFL ) << 8 );
+    return ( data >> 16 ) | ( data << 16 );
 }
 
 unsigned int hexin_crc32_init_table_poly_is_high( unsigned int polynomial, unsigned int *table )
@@ -102,10 +101,10 @@ unsigned int hexin_crc32_poly_is_low_calc( unsigned int crc32, unsigned char c,
     return crc;
 }
 
-unsigned int hexin_calc_crc32_adler( const unsigned char *pSrc, unsigned int len, unsigned int crc32 /*reserved*/ )
+unsigned int hexin_calc_crc32_adler( const unsigned char *pSrc, size_t len, unsigned int crc32 /*reserved*/ )
 {
     unsigned int sum1 = 1, sum2 = 0;
-    unsigned int i = 0x00000000L;
+    size_t i = 0;
 
     for ( i = 0; i < len; i++ ) {
         sum1 = ( sum1 + pSrc[i] ) % HEXIN_MOD_ADLER;
@@ -114,7 +113,30 @@ unsigned int hexin_calc_crc32_adler( const unsigned char *pSrc, unsigned int len
     return ( sum2 << 16 ) | sum1;
 }
 
-unsigned int hexin_calc_crc32_fletcher( const unsigned char *pSrc, unsigned int len, unsigned int crc32 /*reserved*/ )
+/*
+ * Adler-32 carried on from a previous value ( ( sum2 << 16 ) | sum1 ), the sums are reduced once per
+ * 5552 bytes : the largest run whose sum2 cannot overflow 32 bits.
+ */
+unsigned int hexin_crc32_adler_update( unsigned int adler, const unsigned char *pSrc, size_t len )
+{
+    unsigned int sum1 = adler & 0xFFFF, sum2 = adler >> 16;
+    size_t i = 0, block = 0;
+
+    while ( len ) {
+        block = ( len < 5552 ) ? len : 5552;
+        for ( i = 0; i < block; i++ ) {
+            sum1 += pSrc[i];
+            sum2 += sum1;
+        }
+        sum1 %= HEXIN_MOD_ADLER;
+        sum2 %= HEXIN_MOD_ADLER;
+        pSrc += block;
+        len  -= block;
+    }
+    return ( sum2 << 16 ) | sum1;
+}
+
+unsigned int hexin_calc_crc32_fletcher( const unsigned char *pSrc, size_t len, unsigned int crc32 /*reserved*/ )
 {
     unsigned long sum1 = 0xFFFF, sum2 = 0xFFFF;
 
@@ -137,46 +159,108 @@ unsigned int hexin_calc_crc32_fletcher( const unsigned char *pSrc, unsigned int
     return ( sum1 & 0xFFFF ) | ( sum2 << 16 );
 }
 
-unsigned int hexin_crc32_compute_init_table( struct _hexin_crc32 *param )
+unsigned int hexin_crc32_compute_init_table( struct _hexin_crc32 *param, unsigned int (*table)[MAX_TABLE_ARRAY], struct _hexin_clmul *clmul )
 {
     unsigned int i = 0, j = 0;
     unsigned int crc = 0x00000000L;
     unsigned int c   = 0x00000000L;
+    unsigned int poly = ( param->poly << ( HEXIN_CRC32_WIDTH - param->width ) );
+
+    param->table = ( const unsigned int (*)[MAX_TABLE_ARRAY] )table;
+    param->clmul = clmul;
+
+    /* The folding kernel takes the left-aligned polynomial in either orientation. */
+    hexin_clmul_init( clmul, ( unsigned long long )poly << 32 );
+
+    if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
+        hexin_crc32_init_table_poly_is_high( hexin_reverse32( poly ), table[0] );
+        for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
+            crc = table[0][i];
+            for ( j=1; j<MAX_SLICING_ARRAY; j++ ) {
+                crc = ( crc >> 8 ) ^ table[0][ crc & 0xFF ];
+                table[j][i] = crc;
+            }
+        }
+        return HEXIN_TABLE_IS_REFLECTED;
+    }
 
     for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
         crc = 0;
         c	= ( ( unsigned int )i ) << 24;
         for ( j=0; j<8; j++ ) {
-            if ( ( crc ^ c ) & 0x80000000L )  crc = ( crc << 1 ) ^ param->poly;
+            if ( ( crc ^ c ) & 0x80000000L )  crc = ( crc << 1 ) ^ poly;
             else                              crc = ( crc << 1 );
             c = c << 1;
         }
-        param->table[i] = crc;
+        table[0][i] = crc;
     }
 
-    return TRUE;
+    /* Slicing tables : table[k][i] is the CRC of byte i followed by k zero bytes. */
+    for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
+        crc = table[0][i];
+        for ( j=1; j<MAX_SLICING_ARRAY; j++ ) {
+            crc = ( crc << 8 ) ^ table[0][ crc >> 24 ];
+            table[j][i] = crc;
+        }
+    }
+
+    return HEXIN_TABLE_IS_NORMAL;
 }
 
-unsigned int hexin_crc32_compute_char( unsigned int crc32, unsigned char c, struct _hexin_crc32 *param )
+unsigned int hexin_crc32_compute_char( unsigned int crc32, unsigned char c, const struct _hexin_crc32 *param )
 {
     unsigned int crc = crc32;
-    crc = (crc << 8) ^ param->table[ ((crc >> 24) ^ (0x000000FFL & (unsigned int)c)) & 0xFF ];
+    crc = (crc << 8) ^ param->table[0][ ((crc >> 24) ^ (0x000000FFL & (unsigned int)c)) & 0xFF ];
     return crc;
 }
 
-unsigned int hexin_crc32_compute( const unsigned char *pSrc, unsigned int len, struct _hexin_crc32 *param, unsigned int init )
+static unsigned int hexin_crc32_compute_slicing8( unsigned int crc, const unsigned char *p, const unsigned int (*table)[MAX_TABLE_ARRAY] )
 {
-    unsigned int i = 0, result = 0;
-    unsigned int crc  = ( init << ( HEXIN_CRC32_WIDTH - param->width ) );       /* Fixed Issues #4  */
+    crc ^= ( ( unsigned int )p[0] << 24 ) | ( ( unsigned int )p[1] << 16 ) | ( ( unsigned int )p[2] << 8 ) | p[3];
+    return table[7][ crc >> 24 ] ^ table[6][ ( crc >> 16 ) & 0xFF ] ^ table[5][ ( crc >> 8 ) & 0xFF ] ^ table[4][ crc & 0xFF ]
+         ^ table[3][ p[4] ] ^ table[2][ p[5] ] ^ table[1][ p[6] ] ^ table[0][ p[7] ];
+}
 
-    if ( param->is_initial == FALSE ) {
-        param->poly = ( param->poly << ( HEXIN_CRC32_WIDTH - param->width ) );
-        param->is_initial = hexin_crc32_compute_init_table( param );
+static unsigned int hexin_crc32_compute_slicing16( unsigned int crc, const unsigned char *p, const unsigned int (*table)[MAX_TABLE_ARRAY] )
+{
+    crc ^= ( ( unsigned int )p[0] << 24 ) | ( ( unsigned int )p[1] << 16 ) | ( ( unsigned int )p[2] << 8 ) | p[3];
+    return table[15][ crc >> 24 ] ^ table[14][ ( crc >> 16 ) & 0xFF ] ^ table[13][ ( crc >> 8 ) & 0xFF ] ^ table[12][ crc & 0xFF ]
+         ^ table[11][ p[4]  ] ^ table[10][ p[5]  ] ^ table[9][ p[6]  ] ^ table[8][ p[7]  ]
+         ^ table[7][  p[8]  ] ^ table[6][  p[9]  ] ^ table[5][ p[10] ] ^ table[4][ p[11] ]
+         ^ table[3][  p[12] ] ^ table[2][  p[13] ] ^ table[1][ p[14] ] ^ table[0][ p[15] ];
+}
+
+/*
+ * Slicing-by-16 over the bulk of the buffer, one slicing-by-8 step and the byte loop for the tail.
+ */
+static unsigned int hexin_crc32_compute_slicing( unsigned int crc, const unsigned char *pSrc, size_t len, const struct _hexin_crc32 *param )
+{
+    size_t        i = 0;
+    unsigned char buffer[MAX_SLICING_ARRAY];
+    const unsigned int (*table)[MAX_TABLE_ARRAY] = param->table;
+
+    for ( ; len >= 16; len -= 16, pSrc += 16 ) {
+        if ( HEXIN_REFIN_IS_TRUE( param ) ) {
+            for ( i=0; i<16; i++ ) {
+                buffer[i] = __hexin_reverse8( pSrc[i] );
+            }
+            crc = hexin_crc32_compute_slicing16( crc, buffer, table );
+        } else {
+            crc = hexin_crc32_compute_slicing16( crc, pSrc, table );
+        }
     }
 
-    /* Fixed Issues #4 #8 */
-    if ( HEXIN_REFOUT_IS_TRUE( param ) && ( HEXIN_GRADUAL_CALCULATE_IS_TRUE( param ) ) ) { 
-        crc = hexin_reverse32( init );
+    if ( len >= 8 ) {
+        if ( HEXIN_REFIN_IS_TRUE( param ) ) {
+            for ( i=0; i<8; i++ ) {
+                buffer[i] = __hexin_reverse8( pSrc[i] );
+            }
+            crc = hexin_crc32_compute_slicing8( crc, buffer, table );
+        } else {
+            crc = hexin_crc32_compute_slicing8( crc, pSrc, table );
+        }
+        len  -= 8;
+        pSrc += 8;
     }
 
     /* Fixed Issues #8 */
@@ -190,29 +274,237 @@ unsigned int hexin_crc32_compute( const unsigned char *pSrc, unsigned int len, s
         }
     }
 
+    return crc;
+}
+
+static unsigned int hexin_crc32_compute_slicing8_reflected( unsigned int crc, const unsigned char *p, const unsigned int (*table)[MAX_TABLE_ARRAY] )
+{
+    crc ^= ( ( unsigned int )p[3] << 24 ) | ( ( unsigned int )p[2] << 16 ) | ( ( unsigned int )p[1] << 8 ) | p[0];
+    return table[7][ crc & 0xFF ] ^ table[6][ ( crc >> 8 ) & 0xFF ] ^ table[5][ ( crc >> 16 ) & 0xFF ] ^ table[4][ crc >> 24 ]
+         ^ table[3][ p[4] ] ^ table[2][ p[5] ] ^ table[1][ p[6] ] ^ table[0][ p[7] ];
+}
+
+static unsigned int hexin_crc32_compute_slicing16_reflected( unsigned int crc, const unsigned char *p, const unsigned int (*table)[MAX_TABLE_ARRAY] )
+{
+    crc ^= ( ( unsigned int )p[3] << 24 ) | ( ( unsigned int )p[2] << 16 ) | ( ( unsigned int )p[1] << 8 ) | p[0];
+    return table[15][ crc & 0xFF ] ^ table[14][ ( crc >> 8 ) & 0xFF ] ^ table[13][ ( crc >> 16 ) & 0xFF ] ^ table[12][ crc >> 24 ]
+         ^ table[11][ p[4]  ] ^ table[10][ p[5]  ] ^ table[9][ p[6]  ] ^ table[8][ p[7]  ]
+         ^ table[7][  p[8]  ] ^ table[6][  p[9]  ] ^ table[5][ p[10] ] ^ table[4][ p[11] ]
+         ^ table[3][  p[12] ] ^ table[2][  p[13] ] ^ table[1][ p[14] ] ^ table[0][ p[15] ];
+}
+
+/*
+ * Right-shifting register over the reflected tables : the input bytes are used as they are.
+ */
+static unsigned int hexin_crc32_compute_slicing_reflected( unsigned int crc, const unsigned char *pSrc, size_t len, const struct _hexin_crc32 *param )
+{
+    size_t i = 0;
+    const unsigned int (*table)[MAX_TABLE_ARRAY] = param->table;
+
+    for ( ; len >= 16; len -= 16, pSrc += 16 ) {
+        crc = hexin_crc32_compute_slicing16_reflected( crc, pSrc, table );
+    }
+
+    if ( len >= 8 ) {
+        crc   = hexin_crc32_compute_slicing8_reflected( crc, pSrc, table );
+        len  -= 8;
+        pSrc += 8;
+    }
+
+    for ( i=0; i<len; i++ ) {
+        crc = ( crc >> 8 ) ^ table[0][ ( crc ^ pSrc[i] ) & 0xFF ];
+    }
+
+    return crc;
+}
+
+/*
+ * Carry-less multiplication folding over the 16-byte aligned bulk, when the CPU supports PCLMULQDQ.
+ */
+static unsigned int hexin_crc32_compute_clmul( unsigned int crc, const unsigned char *pSrc, size_t len, const struct _hexin_crc32 *param )
+{
+    if ( HEXIN_REFIN_IS_TRUE( param ) ) {
+        return hexin_reverse32( ( unsigned int )hexin_clmul_compute( param->clmul, hexin_reverse32( crc ), pSrc, len, TRUE ) );
+    }
+    return ( unsigned int )( hexin_clmul_compute( param->clmul, ( unsigned long long )crc << 32, pSrc, len, FALSE ) >> 32 );
+}
+
+/*
+ * The register of a new calculation, or of a gradual one ( is_gradual, init = crc ^ xorout ).
+ */
+unsigned int hexin_crc32_compute_begin( const struct _hexin_crc32 *param, unsigned int init )
+{
+    if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
+        return HEXIN_GRADUAL_CALCULATE_IS_TRUE( param ) ? init : hexin_reverse32( init << ( HEXIN_CRC32_WIDTH - param->width ) );
+    }
+
+    /* Fixed Issues #4 #8 */
+    if ( HEXIN_REFOUT_IS_TRUE( param ) && ( HEXIN_GRADUAL_CALCULATE_IS_TRUE( param ) ) ) {
+        return hexin_reverse32( init );
+    }
+    return ( init << ( HEXIN_CRC32_WIDTH - param->width ) );       /* Fixed Issues #4  */
+}
+
+/*
+ * Feed the register, no fix-up between two calls.
+ */
+unsigned int hexin_crc32_compute_update( const struct _hexin_crc32 *param, unsigned int crc, const unsigned char *pSrc, size_t len )
+{
+    if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
+        if ( HEXIN_CASTAGNOLI_IS_TRUE( param ) && hexin_crc32c_is_supported()
+          && ( ( len < HEXIN_VPCLMUL_MIN_LENGTH ) || ( hexin_clmul_level() < HEXIN_CLMUL_LEVEL_VPCLMUL ) ) ) {
+            return hexin_crc32c_compute( crc, pSrc, len );
+        }
+        if ( ( len >= HEXIN_CLMUL_MIN_LENGTH ) && hexin_clmul_is_supported() ) {
+            crc   = ( unsigned int )hexin_clmul_compute( param->clmul, crc, pSrc, len & ~( size_t )15, TRUE );
+            pSrc += len & ~( size_t )15;
+            len  &= 15U;
+        }
+        return hexin_crc32_compute_slicing_reflected( crc, pSrc, len, param );
+    }
+
+    /* The 4x512 bits folding outruns even the crc32 instruction. */
+    if ( HEXIN_CASTAGNOLI_IS_TRUE( param ) && hexin_crc32c_is_supported()
+      && ( ( len < HEXIN_VPCLMUL_MIN_LENGTH ) || ( hexin_clmul_level() < HEXIN_CLMUL_LEVEL_VPCLMUL ) ) ) {
+        return hexin_reverse32( hexin_crc32c_compute( hexin_reverse32( crc ), pSrc, len ) );
+    }
+    if ( ( len >= HEXIN_CLMUL_MIN_LENGTH ) && hexin_clmul_is_supported() ) {
+        crc   = hexin_crc32_compute_clmul( crc, pSrc, len & ~( size_t )15, param );
+        pSrc += len & ~( size_t )15;
+        len  &= 15U;
+    }
+    return hexin_crc32_compute_slicing( crc, pSrc, len, param );
+}
+
+/*
+ * The CRC of the register : refout and xorout.
+ */
+unsigned int hexin_crc32_compute_end( const struct _hexin_crc32 *param, unsigned int crc )
+{
+    if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
+        return ( crc ^ param->xorout );
+    }
+
     /* Fixed Issues #8 */
     if ( HEXIN_REFOUT_IS_TRUE( param ) ) {
         crc = hexin_reverse32( crc );
     }
+    return ( ( crc >> ( HEXIN_CRC32_WIDTH - param->width ) ) ^ param->xorout );
+}
+
+unsigned int hexin_crc32_compute( const unsigned char *pSrc, size_t len, const struct _hexin_crc32 *param, unsigned int init )
+{
+    unsigned int crc = hexin_crc32_compute_begin( param, init );
 
-    result = ( crc >> ( HEXIN_CRC32_WIDTH - param->width ) );
-	return ( result ^ param->xorout ); 
+    crc = hexin_crc32_compute_update( param, crc, pSrc, len );
+    return hexin_crc32_compute_end( param, crc );
 }
 
-unsigned int hexin_crc32_compute_stm32( const unsigned char *pSrc, unsigned int len, struct _hexin_crc32 *param, unsigned int init )
+static unsigned long long hexin_crc32_compute_chunk( const void *param, const unsigned char *pSrc, size_t len, unsigned long long init )
 {
-    unsigned int i = 0, j = 0, result = 0;
-    unsigned int crc  = init;
+    return hexin_crc32_compute( pSrc, len, ( const struct _hexin_crc32 * )param, ( unsigned int )init );
+}
 
-    if ( param->is_initial == FALSE ) {
-        param->poly = ( param->poly << ( HEXIN_CRC32_WIDTH - param->width ) );
-        param->is_initial = hexin_crc32_compute_init_table( param );
+/*
+ * Split the buffer over threads ( 0 : every CPU ), the result is the same as hexin_crc32_compute().
+ */
+unsigned int hexin_crc32_compute_parallel( const unsigned char *pSrc, size_t len, const struct _hexin_crc32 *param, unsigned int init, unsigned int threads )
+{
+    struct _hexin_crc32 rest = *param;
+    struct _hexin_parallel job = { .compute = hexin_crc32_compute_chunk,
+                                   .first   = param,
+                                   .rest    = &rest,
+                                   .combine = param->combine,
+                                   .init    = init,
+                                   .reinit  = param->init,
+                                   .width   = param->width,
+                                   .poly    = param->poly,
+                                   .refout  = param->refout };
+
+    rest.is_gradual = FALSE;
+    return ( unsigned int )hexin_parallel_compute( &job, pSrc, len, threads );
+}
+
+/*
+ * CRC( A || B ) from CRC( A ), CRC( B ) and len( B ), O( log( len_b ) ).
+ */
+unsigned int hexin_crc32_combine( const struct _hexin_crc32 *param, unsigned int crc_a, unsigned int crc_b, unsigned long long len_b )
+{
+    struct _hexin_crc32 local = *param;
+    struct _hexin_combine combine;
+    unsigned int empty = 0;
+
+    local.is_gradual = FALSE;
+    empty = hexin_crc32_compute( ( const unsigned char * )"", 0, &local, local.init );
+
+    if ( param->combine == NULL ) {
+        hexin_combine_init( &combine, param->width, param->poly );
+    }
+    return ( unsigned int )hexin_combine( ( param->combine != NULL ) ? param->combine : &combine, param->refout, crc_a, crc_b, len_b, empty );
+}
+
+/*
+ * CRC( A || len zero bytes ) from CRC( A ), O( log( len ) ).
+ */
+unsigned int hexin_crc32_extend_zeros( const struct _hexin_crc32 *param, unsigned int crc, unsigned long long len )
+{
+    struct _hexin_combine combine;
+
+    if ( param->combine == NULL ) {
+        hexin_combine_init( &combine, param->width, param->poly );
     }
+    return ( unsigned int )hexin_combine_zeros( ( param->combine != NULL ) ? param->combine : &combine, param->refout, crc, len, param->xorout );
+}
+
+/*
+ * CRC( A || count copies of block ) from CRC( A ), one pass over the block and O( log( count ) ).
+ */
+unsigned int hexin_crc32_extend_repeat( const struct _hexin_crc32 *param, unsigned int crc, const unsigned char *pBlock, size_t len, unsigned long long count )
+{
+    struct _hexin_crc32 local = *param;
+    struct _hexin_combine combine;
+    unsigned int empty = 0, block = 0;
+
+    local.is_gradual = FALSE;
+    empty = hexin_crc32_compute( ( const unsigned char * )"", 0, &local, local.init );
+    block = hexin_crc32_compute( pBlock, len, &local, local.init );
+
+    if ( param->combine == NULL ) {
+        hexin_combine_init( &combine, param->width, param->poly );
+    }
+    return ( unsigned int )hexin_combine_repeat( ( param->combine != NULL ) ? param->combine : &combine, param->refout, crc, block, len, count, empty );
+}
+
+/*
+ * CRC( A ) after len bytes of A, followed by len_after bytes, were rewritten from pOld to pNew, O( len + log( len_after ) ).
+ */
+unsigned int hexin_crc32_update_range( const struct _hexin_crc32 *param, unsigned int crc, const unsigned char *pOld, const unsigned char *pNew,
+                                      size_t len, unsigned long long len_after )
+{
+    struct _hexin_crc32 local = *param;
+    struct _hexin_combine combine;
+    unsigned int crc_old = 0, crc_new = 0;
+
+    local.is_gradual = FALSE;
+    crc_old = hexin_crc32_compute( pOld, len, &local, local.init );
+    crc_new = hexin_crc32_compute( pNew, len, &local, local.init );
+
+    if ( param->combine == NULL ) {
+        hexin_combine_init( &combine, param->width, param->poly );
+    }
+    return ( unsigned int )hexin_combine_patch( ( param->combine != NULL ) ? param->combine : &combine, param->refout, crc, crc_old, crc_new, len_after );
+}
+
+unsigned int hexin_crc32_compute_stm32( const unsigned char *pSrc, size_t len, const struct _hexin_crc32 *param, unsigned int init )
+{
+    size_t i = 0;
+    unsigned int j = 0, result = 0;
+    unsigned int crc  = init;
 
 	for ( i=0; i<len; i++ ) {
         crc ^= ( unsigned int )pSrc[i];
         for ( j = 0; j < 4; j++ ) {
-            result = param->table[ ( crc >> 24 ) & 0xFF ];
+            result = param->table[0][ ( crc >> 24 ) & 0xFF ];
             crc  <<= 8;
             crc   ^= result;   
         }
@@ -19,6 +19,10 @@
 #ifndef __CRC32_TABLES_H__
 #define __CRC32_TABLES_H__
 
+#include "_clmulfold.h"
+#include "_parallel.h"
+#include "_crc32sse42.h"
+
 #ifndef TRUE
 #define                 TRUE                                    1
 #endif
@@ -31,6 +35,10 @@
 #define                 MAX_TABLE_ARRAY                         256
 #endif
 
+#ifndef MAX_SLICING_ARRAY
+#define                 MAX_SLICING_ARRAY                       16      /* Slicing-by-16 (table[0] is the classic table) */
+#endif
+
 #define                 HEXIN_MOD_ADLER                         65521
 
 #define                 HEXIN_CRC32_WIDTH                       32
@@ -40,6 +48,10 @@
 #define                 HEXIN_REFOUT_IS_TRUE(x)                 ( x->refout == TRUE )
 #define                 HEXIN_REFIN_REFOUT_IS_TRUE(x)           ( ( x->refin == TRUE ) && ( x->refout == TRUE ) )
 #define                 HEXIN_GRADUAL_CALCULATE_IS_TRUE(x)      ( x->is_gradual == 2 )
+#define                 HEXIN_TABLE_IS_NORMAL                   1       /* is_initial : MSB-first table */
+#define                 HEXIN_TABLE_IS_REFLECTED                2       /* is_initial : LSB-first table ( refin == refout == TRUE ) */
+#define                 HEXIN_TABLE_TYPE(x)                     ( HEXIN_REFIN_REFOUT_IS_TRUE((x)) ? HEXIN_TABLE_IS_REFLECTED : HEXIN_TABLE_IS_NORMAL )
+#define                 HEXIN_CASTAGNOLI_IS_TRUE(x)             ( ( x->width == HEXIN_CRC32_WIDTH ) && ( x->poly == CRC32_POLYNOMIAL_1EDC6F41 ) && ( x->refin == TRUE ) )
 
 #define                 CRC30_POLYNOMIAL_2030B9C7               0x2030B9C7L
 #define                 CRC31_POLYNOMIAL_04C11DB7               0x04C11DB7L
@@ -55,8 +67,9 @@ struct _hexin_crc32 {
     unsigned int  refin;
     unsigned int  refout;
     unsigned int  xorout;
-    unsigned int  result;
-    unsigned int  table[MAX_TABLE_ARRAY];
+    const unsigned int (*table)[MAX_TABLE_ARRAY];        /* static const presets, see _crc32presets.h */
+    const struct _hexin_clmul *clmul;
+    const struct _hexin_combine *combine;                /* x^( 8 * 2^k ) mod P(x), see _combine.h */
 };
 
 
@@ -65,9 +78,19 @@ unsigned int hexin_reverse32( unsigned int data );
 unsigned int hexin_crc32_init_table_poly_is_high( unsigned int polynomial, unsigned int *table );
 unsigned int hexin_crc32_init_table_poly_is_low(  unsigned int polynomial, unsigned int *table );
 
-unsigned int hexin_calc_crc32_adler(    const unsigned char *pSrc, unsigned int len, unsigned int crc32 /*reserved*/ );
-unsigned int hexin_calc_crc32_fletcher( const unsigned char *pSrc, unsigned int len, unsigned int crc32 /*reserved*/ );
-unsigned int hexin_crc32_compute(       const unsigned char *pSrc, unsigned int len, struct _hexin_crc32 *param, unsigned int init );
-unsigned int hexin_crc32_compute_stm32( const unsigned char *pSrc, unsigned int len, struct _hexin_crc32 *param, unsigned int init );
+unsigned int hexin_calc_crc32_adler(    const unsigned char *pSrc, size_t len, unsigned int crc32 /*reserved*/ );
+unsigned int hexin_crc32_adler_update( unsigned int adler, const unsigned char *pSrc, size_t len );
+unsigned int hexin_calc_crc32_fletcher( const unsigned char *pSrc, size_t len, unsigned int crc32 /*reserved*/ );
+unsigned int hexin_crc32_compute_init_table( struct _hexin_crc32 *param, unsigned int (*table)[MAX_TABLE_ARRAY], struct _hexin_clmul *clmul );
+unsigned int hexin_crc32_compute_begin(  const struct _hexin_crc32 *param, unsigned int init );
+unsigned int hexin_crc32_compute_update( const struct _hexin_crc32 *param, unsigned int crc, const unsigned char *pSrc, size_t len );
+unsigned int hexin_crc32_compute_end(    const struct _hexin_crc32 *param, unsigned int crc );
+unsigned int hexin_crc32_compute(       const unsigned char *pSrc, size_t len, const struct _hexin_crc32 *param, unsigned int init );
+unsigned int hexin_crc32_compute_parallel( const unsigned char *pSrc, size_t len, const struct _hexin_crc32 *param, unsigned int init, unsigned int threads );
+unsigned int hexin_crc32_combine( const struct _hexin_crc32 *param, unsigned int crc_a, unsigned int crc_b, unsigned long long len_b );
+unsigned int hexin_crc32_extend_zeros(  const struct _hexin_crc32 *param, unsigned int crc, unsigned long long len );
+unsigned int hexin_crc32_extend_repeat( const struct _hexin_crc32 *param, unsigned int crc, const unsigned char *pBlock, size_t len, unsigned long long count );
+unsigned int hexin_crc32_update_range(  const struct _hexin_crc32 *param, unsigned int crc, const unsigned char *pOld, const unsigned char *pNew, size_t len, unsigned long long len_after );
+unsigned int hexin_crc32_compute_stm32( const unsigned char *pSrc, size_t len, const struct _hexin_crc32 *param, unsigned int init );
 
 #endif //__CRC32_TABLES_H__
@@ -25,186 +25,236 @@
 
 #define PY_SSIZE_T_CLEAN
 #include <Python.h>
+#include <string.h>
+#include <stddef.h>
 #include "_crc64tables.h"
+#include "_crc64presets.h"
+#include "_hasher.h"
+#include "_batch.h"
+#include "_file.h"
+#include "_multi.h"
+#include "_fastcall.h"
+#include "_hacker.h"
 
-static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, PyObject *args, struct _hexin_crc64 *param )
+static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, HEXIN_FASTCALL_PARAMS, const struct _hexin_crc64 *preset, unsigned long long *result )
 {
+    struct _hexin_crc64 local = *preset;       /* Per-call state, the preset is shared by every thread */
+    struct _hexin_crc64 *param = &local;
     Py_buffer data = { NULL, NULL };
-    unsigned long long init = param->init;
+    unsigned long long value = param->init;     /* Fixed Issues #4  */
+    unsigned int threads = 1;
+    int is_gradual = hexin_fastcall_preset( HEXIN_FASTCALL_ARGS, &data, &value, &threads );
+    unsigned long long init = ( unsigned long long )value;
 
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTuple( args, "y*|K", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
-    }
-#else
-    if ( !PyArg_ParseTuple( args, "s*|K", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
+    if ( is_gradual < 0 ) {
         return FALSE;
     }
-#endif /* PY_MAJOR_VERSION */
 
     /* Fixed Issues #4  */
-    param->is_gradual = ( unsigned int )PyTuple_Size( args );   // Fixed warning C4244
+    param->is_gradual = ( unsigned int )is_gradual;
     if ( HEXIN_GRADUAL_CALCULATE_IS_TRUE( param ) ) {
         init = ( init ^ param->xorout );
     }
 
-    param->result = hexin_crc64_compute( (const unsigned char *)data.buf, (unsigned int)data.len, param, init );
-
-    if ( data.obj )
-       PyBuffer_Release( &data );
+    if ( hexin_parallel_threads( ( size_t )data.len, threads ) > 1 ) {
+        Py_BEGIN_ALLOW_THREADS
+        *result = hexin_crc64_compute_parallel( (const unsigned char *)data.buf, (size_t)data.len, param, init, threads );
+        Py_END_ALLOW_THREADS
+    } else if ( ( size_t )data.len < hexin_gil_threshold() ) {
+        *result = hexin_crc64_compute( (const unsigned char *)data.buf, (size_t)data.len, param, init );
+    } else {
+        Py_BEGIN_ALLOW_THREADS
+        *result = hexin_crc64_compute( (const unsigned char *)data.buf, (size_t)data.len, param, init );
+        Py_END_ALLOW_THREADS
+    }
 
+    PyBuffer_Release( &data );
     return TRUE;
 }
 
-static PyObject * _crc64_iso( PyObject *self, PyObject *args )
-{
 #if PY_MAJOR_VERSION >= 3
-    static struct _hexin_crc64 crc64_param_goiso = { .is_initial=FALSE,
-                                                     .width  = HEXIN_CRC64_WIDTH,
-                                                     .poly   = 0x000000000000001BL,
-                                                     .init   = 0xFFFFFFFFFFFFFFFFL,
-                                                     .refin  = TRUE,
-                                                     .refout = TRUE,
-                                                     .xorout = 0xFFFFFFFFFFFFFFFFL,
-                                                     .result = 0 };
+static const struct _hexin_crc64 crc64_param_goiso = { .is_initial=HEXIN_TABLE_IS_REFLECTED,
+                                                 .width  = HEXIN_CRC64_WIDTH,
+                                                 .poly   = 0x000000000000001BL,
+                                                 .init   = 0xFFFFFFFFFFFFFFFFL,
+                                                 .refin  = TRUE,
+                                                 .refout = TRUE,
+                                                 .xorout = 0xFFFFFFFFFFFFFFFFL,
+                                                 .table  = hexin_crc64_table_000000000000001B_reflected,
+                                                 .clmul  = &hexin_crc64_clmul_000000000000001B,
+                                                 .combine= &hexin_crc64_combine_000000000000001B };
 #else
-    static struct _hexin_crc64 crc64_param_goiso = { FALSE,
-                                                     HEXIN_CRC64_WIDTH,
-                                                     0x000000000000001BL,
-                                                     0xFFFFFFFFFFFFFFFFL,
-                                                     TRUE,
-                                                     TRUE,
-                                                     0xFFFFFFFFFFFFFFFFL,
-                                                     0 };
+static const struct _hexin_crc64 crc64_param_goiso = { HEXIN_TABLE_IS_REFLECTED,
+                                                 FALSE,
+                                                 HEXIN_CRC64_WIDTH,
+                                                 0x000000000000001BL,
+                                                 0xFFFFFFFFFFFFFFFFL,
+                                                 TRUE,
+                                                 TRUE,
+                                                 0xFFFFFFFFFFFFFFFFL,
+                                                 0,
+                                                 hexin_crc64_table_000000000000001B_reflected,
+                                                 &hexin_crc64_clmul_000000000000001B,
+                                                 &hexin_crc64_combine_000000000000001B };
 #endif /* PY_MAJOR_VERSION */
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc64_param_goiso ) ) {
+static PyObject * _crc64_iso( PyObject *self, HEXIN_FASTCALL_PARAMS )
+{
+    unsigned long long result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc64_param_goiso , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "K", crc64_param_goiso.result );
+    return PyLong_FromUnsignedLongLong( result );
 }
 
-static PyObject * _crc64_ecma182( PyObject *self, PyObject *args )
-{
 #if PY_MAJOR_VERSION >= 3
-    static struct _hexin_crc64 crc64_param_ecma = { .is_initial=FALSE,
-                                                    .width  = HEXIN_CRC64_WIDTH,
-                                                    .poly   = CRC64_POLYNOMIAL_ECMA182,
-                                                    .init   = 0x0000000000000000L,
-                                                    .refin  = FALSE,
-                                                    .refout = FALSE,
-                                                    .xorout = 0x0000000000000000L,
-                                                    .result = 0 };
+static const struct _hexin_crc64 crc64_param_ecma = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                .width  = HEXIN_CRC64_WIDTH,
+                                                .poly   = CRC64_POLYNOMIAL_ECMA182,
+                                                .init   = 0x0000000000000000L,
+                                                .refin  = FALSE,
+                                                .refout = FALSE,
+                                                .xorout = 0x0000000000000000L,
+                                                .table  = hexin_crc64_table_42F0E1EBA9EA3693_normal,
+                                                .clmul  = &hexin_crc64_clmul_42F0E1EBA9EA3693,
+                                                .combine= &hexin_crc64_combine_42F0E1EBA9EA3693 };
 #else
-    static struct _hexin_crc64 crc64_param_ecma = { FALSE,
-                                                    HEXIN_CRC64_WIDTH,
-                                                    CRC64_POLYNOMIAL_ECMA182,
-                                                    0,
-                                                    FALSE,
-                                                    FALSE,
-                                                    0,
-                                                    0 };
+static const struct _hexin_crc64 crc64_param_ecma = { HEXIN_TABLE_IS_NORMAL,
+                                                FALSE,
+                                                HEXIN_CRC64_WIDTH,
+                                                CRC64_POLYNOMIAL_ECMA182,
+                                                0x0000000000000000L,
+                                                FALSE,
+                                                FALSE,
+                                                0x0000000000000000L,
+                                                0,
+                                                hexin_crc64_table_42F0E1EBA9EA3693_normal,
+                                                &hexin_crc64_clmul_42F0E1EBA9EA3693,
+                                                &hexin_crc64_combine_42F0E1EBA9EA3693 };
 #endif /* PY_MAJOR_VERSION */
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc64_param_ecma ) ) {
+static PyObject * _crc64_ecma182( PyObject *self, HEXIN_FASTCALL_PARAMS )
+{
+    unsigned long long result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc64_param_ecma , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "K", crc64_param_ecma.result );
+    return PyLong_FromUnsignedLongLong( result );
 }
 
-static PyObject * _crc64_we( PyObject *self, PyObject *args )
-{
 #if PY_MAJOR_VERSION >= 3
-    static struct _hexin_crc64 crc64_param_we = { .is_initial=FALSE,
-                                                  .width  = HEXIN_CRC64_WIDTH,
-                                                  .poly   = CRC64_POLYNOMIAL_ECMA182,
-                                                  .init   = 0xFFFFFFFFFFFFFFFFL,
-                                                  .refin  = FALSE,
-                                                  .refout = FALSE,
-                                                  .xorout = 0xFFFFFFFFFFFFFFFFL,
-                                                  .result = 0 };
+static const struct _hexin_crc64 crc64_param_we = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                              .width  = HEXIN_CRC64_WIDTH,
+                                              .poly   = CRC64_POLYNOMIAL_ECMA182,
+                                              .init   = 0xFFFFFFFFFFFFFFFFL,
+                                              .refin  = FALSE,
+                                              .refout = FALSE,
+                                              .xorout = 0xFFFFFFFFFFFFFFFFL,
+                                              .table  = hexin_crc64_table_42F0E1EBA9EA3693_normal,
+                                              .clmul  = &hexin_crc64_clmul_42F0E1EBA9EA3693,
+                                              .combine= &hexin_crc64_combine_42F0E1EBA9EA3693 };
 #else
-    static struct _hexin_crc64 crc64_param_we = { FALSE,
-                                                  HEXIN_CRC64_WIDTH,
-                                                  CRC64_POLYNOMIAL_ECMA182,
-                                                  0xFFFFFFFFFFFFFFFFL,
-                                                  FALSE,
-                                                  FALSE,
-                                                  0xFFFFFFFFFFFFFFFFL,
-                                                  0 };
+static const struct _hexin_crc64 crc64_param_we = { HEXIN_TABLE_IS_NORMAL,
+                                              FALSE,
+                                              HEXIN_CRC64_WIDTH,
+                                              CRC64_POLYNOMIAL_ECMA182,
+                                              0xFFFFFFFFFFFFFFFFL,
+                                              FALSE,
+                                              FALSE,
+                                              0xFFFFFFFFFFFFFFFFL,
+                                              0,
+                                              hexin_crc64_table_42F0E1EBA9EA3693_normal,
+                                              &hexin_crc64_clmul_42F0E1EBA9EA3693,
+                                              &hexin_crc64_combine_42F0E1EBA9EA3693 };
 #endif /* PY_MAJOR_VERSION */
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc64_param_we ) ) {
+static PyObject * _crc64_we( PyObject *self, HEXIN_FASTCALL_PARAMS )
+{
+    unsigned long long result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc64_param_we , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "K", crc64_param_we.result );
+    return PyLong_FromUnsignedLongLong( result );
 }
 
-static PyObject * _crc64_xz( PyObject *self, PyObject *args )
-{
 #if PY_MAJOR_VERSION >= 3
-    static struct _hexin_crc64 crc64_param_xz = { .is_initial=FALSE,
-                                                  .width  = HEXIN_CRC64_WIDTH,
-                                                  .poly   = CRC64_POLYNOMIAL_ECMA182,
-                                                  .init   = 0xFFFFFFFFFFFFFFFFL,
-                                                  .refin  = TRUE,
-                                                  .refout = TRUE,
-                                                  .xorout = 0xFFFFFFFFFFFFFFFFL,
-                                                  .result = 0 };
+static const struct _hexin_crc64 crc64_param_xz = { .is_initial=HEXIN_TABLE_IS_REFLECTED,
+                                              .width  = HEXIN_CRC64_WIDTH,
+                                              .poly   = CRC64_POLYNOMIAL_ECMA182,
+                                              .init   = 0xFFFFFFFFFFFFFFFFL,
+                                              .refin  = TRUE,
+                                              .refout = TRUE,
+                                              .xorout = 0xFFFFFFFFFFFFFFFFL,
+                                              .table  = hexin_crc64_table_42F0E1EBA9EA3693_reflected,
+                                              .clmul  = &hexin_crc64_clmul_42F0E1EBA9EA3693,
+                                              .combine= &hexin_crc64_combine_42F0E1EBA9EA3693 };
 #else
-    static struct _hexin_crc64 crc64_param_xz = { FALSE,
-                                                  HEXIN_CRC64_WIDTH,
-                                                  CRC64_POLYNOMIAL_ECMA182,
-                                                  0xFFFFFFFFFFFFFFFFL,
-                                                  TRUE,
-                                                  TRUE,
-                                                  0xFFFFFFFFFFFFFFFFL,
-                                                  0 };
+static const struct _hexin_crc64 crc64_param_xz = { HEXIN_TABLE_IS_REFLECTED,
+                                              FALSE,
+                                              HEXIN_CRC64_WIDTH,
+                                              CRC64_POLYNOMIAL_ECMA182,
+                                              0xFFFFFFFFFFFFFFFFL,
+                                              TRUE,
+                                              TRUE,
+                                              0xFFFFFFFFFFFFFFFFL,
+                                              0,
+                                              hexin_crc64_table_42F0E1EBA9EA3693_reflected,
+                                              &hexin_crc64_clmul_42F0E1EBA9EA3693,
+                                              &hexin_crc64_combine_42F0E1EBA9EA3693 };
 #endif /* PY_MAJOR_VERSION */
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc64_param_xz ) ) {
+static PyObject * _crc64_xz( PyObject *self, HEXIN_FASTCALL_PARAMS )
+{
+    unsigned long long result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc64_param_xz , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "K", crc64_param_xz.result );
+    return PyLong_FromUnsignedLongLong( result );
 }
 
-static PyObject * _crc64_gsm40( PyObject *self, PyObject *args )
-{
 #if PY_MAJOR_VERSION >= 3
-    static struct _hexin_crc64 crc64_param_gsm = { .is_initial=FALSE,
-                                                   .width  = 40,
-                                                   .poly   = 0x0004820009,
-                                                   .init   = 0x0000000000,
-                                                   .refin  = FALSE,
-                                                   .refout = FALSE,
-                                                   .xorout = 0xFFFFFFFFFFL,
-                                                   .result = 0 };
+static const struct _hexin_crc64 crc64_param_gsm = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                               .width  = 40,
+                                               .poly   = 0x0004820009,
+                                               .init   = 0x0000000000,
+                                               .refin  = FALSE,
+                                               .refout = FALSE,
+                                               .xorout = 0xFFFFFFFFFFL,
+                                               .table  = hexin_crc40_table_0004820009_normal,
+                                               .clmul  = &hexin_crc40_clmul_0004820009,
+                                               .combine= &hexin_crc40_combine_0004820009 };
 #else
-    static struct _hexin_crc64 crc64_param_gsm = { FALSE,
-                                                   40,
-                                                   0x0004820009,
-                                                   0x0000000000,
-                                                   FALSE,
-                                                   FALSE,
-                                                   0xFFFFFFFFFFL,
-                                                   0 };
+static const struct _hexin_crc64 crc64_param_gsm = { HEXIN_TABLE_IS_NORMAL,
+                                               FALSE,
+                                               40,
+                                               0x0004820009,
+                                               0x0000000000,
+                                               FALSE,
+                                               FALSE,
+                                               0xFFFFFFFFFFL,
+                                               0,
+                                               hexin_crc40_table_0004820009_normal,
+                                               &hexin_crc40_clmul_0004820009,
+                                               &hexin_crc40_combine_0004820009 };
 #endif /* PY_MAJOR_VERSION */
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc64_param_gsm ) ) {
+static PyObject * _crc64_gsm40( PyObject *self, HEXIN_FASTCALL_PARAMS )
+{
+    unsigned long long result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc64_param_gsm , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "K", crc64_param_gsm.result );
+    return PyLong_FromUnsignedLongLong( result );
 }
 
 static PyObject * _crc64_table( PyObject *self, PyObject *args )
@@ -230,80 +280,784 @@ static PyObject * _crc64_table( PyObject *self, PyObject *args )
     }
 
     for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
-        PyList_SetItem( plist, i, Py_BuildValue( "K", table[i] ) );
+        PyList_SetItem( plist, i, PyLong_FromUnsignedLongLong( table[i] ) );
     }
 
     return plist;
 }
 
-static PyObject * _crc64_hacker( PyObject *self, PyObject *args, PyObject* kws )
+static unsigned int hexin_crc64_hacker_init( void *param, void *table, struct _hexin_clmul *clmul )
+{
+    return hexin_crc64_compute_init_table( ( struct _hexin_crc64 * )param, ( unsigned long long (*)[MAX_TABLE_ARRAY] )table, clmul );
+}
+
+static struct _hexin_hacker_cache crc64_hacker_cache = { NULL, sizeof( unsigned long long [MAX_SLICING_ARRAY][MAX_TABLE_ARRAY] ), hexin_crc64_hacker_init, 0 };
+
+static PyObject * _crc64_hacker( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
     unsigned int reinit = FALSE;
+    unsigned long long result = 0;
+    struct _hexin_hacker_entry *entry = NULL;
     Py_buffer data = { NULL, NULL };
 
-    static struct _hexin_crc64 crc64_param_hacker = { .is_initial = FALSE,
-                                                      .is_gradual = FALSE,
-                                                      .width  = HEXIN_CRC64_WIDTH,
-                                                      .poly   = CRC64_POLYNOMIAL_ECMA182,
-                                                      .init   = 0x0000000000000000L,
-                                                      .refin  = FALSE,
-                                                      .refout = FALSE,
-                                                      .xorout = 0x0000000000000000L,
-                                                      .result = 0 };
+    struct _hexin_crc64 crc64_param_hacker = { .is_initial = FALSE,
+                                               .is_gradual = FALSE,
+                                               .width  = HEXIN_CRC64_WIDTH,
+                                               .poly   = CRC64_POLYNOMIAL_ECMA182,
+                                               .init   = 0x0000000000000000L,
+                                               .refin  = FALSE,
+                                               .refout = FALSE,
+                                               .xorout = 0x0000000000000000L };
+
+    static const char *const kwlist[] = { "data", "poly", "init", "xorout", "refin", "refout", "reinit", NULL };
+    PyObject *values[7];
+    unsigned long long poly = crc64_param_hacker.poly, init = crc64_param_hacker.init, xorout = crc64_param_hacker.xorout;
+    unsigned int refin = crc64_param_hacker.refin, refout = crc64_param_hacker.refout;
+
+    if ( ( hexin_fastcall_parse( HEXIN_FASTCALL_ARGS, kwlist, 1, 7, values ) < 0 )
+      || ( ( values[1] != NULL ) && ( hexin_fastcall_mask( values[1], &poly   ) < 0 ) )
+      || ( ( values[2] != NULL ) && ( hexin_fastcall_mask( values[2], &init   ) < 0 ) )
+      || ( ( values[3] != NULL ) && ( hexin_fastcall_mask( values[3], &xorout ) < 0 ) )
+      || ( ( values[4] != NULL ) && ( hexin_fastcall_bool( values[4], &refin  ) < 0 ) )
+      || ( ( values[5] != NULL ) && ( hexin_fastcall_bool( values[5], &refout ) < 0 ) )
+      || ( ( values[6] != NULL ) && ( hexin_fastcall_bool( values[6], &reinit ) < 0 ) )
+      || ( hexin_fastcall_buffer( values[0], &data ) < 0 ) ) {
+        return NULL;
+    }
+    crc64_param_hacker.poly   = ( unsigned long long )poly;
+    crc64_param_hacker.init   = ( unsigned long long )init;
+    crc64_param_hacker.xorout = ( unsigned long long )xorout;
+    crc64_param_hacker.refin  = refin;
+    crc64_param_hacker.refout = refout;
+
+    /* The tables of the last HEXIN_HACKER_CACHE_SIZE ( poly, orientation ) are kept, reinit=True builds them again. */
+    entry = hexin_hacker_acquire( &crc64_hacker_cache, &crc64_param_hacker, crc64_param_hacker.poly, HEXIN_TABLE_TYPE( &crc64_param_hacker ), reinit );
+    if ( entry == NULL ) {
+        PyBuffer_Release( &data );
+        return NULL;
+    }
+    crc64_param_hacker.is_initial = entry->type;
+    crc64_param_hacker.table      = entry->table;
+    crc64_param_hacker.clmul      = &entry->clmul;
+
+    if ( ( size_t )data.len < hexin_gil_threshold() ) {
+        result = hexin_crc64_compute( (const unsigned char *)data.buf, (size_t)data.len, &crc64_param_hacker, crc64_param_hacker.init );
+    } else {
+        Py_BEGIN_ALLOW_THREADS
+        result = hexin_crc64_compute( (const unsigned char *)data.buf, (size_t)data.len, &crc64_param_hacker, crc64_param_hacker.init );
+        Py_END_ALLOW_THREADS
+    }
+
+    hexin_hacker_release( &crc64_hacker_cache, entry );
+    PyBuffer_Release( &data );
+
+    return PyLong_FromUnsignedLongLong( result );
+}
+
+/* Named presets, the method names of the table below */
+static struct {
+    const char          *name;
+    const struct _hexin_crc64 *param;
+} _crc64_presets[] = {
+    { "iso",    &crc64_param_goiso },
+    { "ecma182",&crc64_param_ecma },
+    { "we",     &crc64_param_we },
+    { "xz64",   &crc64_param_xz },
+    { "gsm40",  &crc64_param_gsm },
+    { NULL, NULL }
+};
+
+static const struct _hexin_crc64 *hexin_crc64_preset( const char *name )
+{
+    unsigned int i = 0;
 
-    static char* kwlist[]={ "data", "poly", "init", "xorout", "refin", "refout", "reinit", NULL };
+    for ( i=0; _crc64_presets[i].name != NULL; i++ ) {
+        if ( 0 == strcmp( _crc64_presets[i].name, name ) ) {
+            return _crc64_presets[i].param;
+        }
+    }
+    return NULL;
+}
+
+static PyObject * _crc64_presets_list( PyObject *self, PyObject *args )
+{
+    unsigned int i = 0;
+    PyObject *names = PyList_New( 0 );
+
+    for ( i=0; ( names != NULL ) && ( _crc64_presets[i].name != NULL ); i++ ) {
+        PyObject *name = Py_BuildValue( "s", _crc64_presets[i].name );
+        if ( ( name == NULL ) || ( PyList_Append( names, name ) < 0 ) ) {
+            Py_XDECREF( name );
+            Py_DECREF( names );
+            return NULL;
+        }
+        Py_DECREF( name );
+    }
+    return names;
+}
+
+static PyObject * _crc64_combine( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    unsigned long long crc_a = 0, crc_b = 0, len_b = 0, mask = 0;
+    const struct _hexin_crc64 *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "sO&O&O&", &name, hexin_PyArg_count, &crc_a, hexin_PyArg_count, &crc_b, hexin_PyArg_count, &len_b ) ) {
+        return NULL;
+    }
+
+    param = hexin_crc64_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+
+    mask = ( param->width >= 64 ) ? ~0ULL : ( ( 1ULL << param->width ) - 1 );
+    if ( ( crc_a | crc_b ) & ~mask ) {
+        PyErr_Format( PyExc_ValueError, "%s is a %u-bit CRC", name, ( unsigned int )param->width );
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLongLong( hexin_crc64_combine( param, ( unsigned long long )crc_a, ( unsigned long long )crc_b, len_b ) );
+}
+
+static PyObject * _crc64_extend_zeros( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    unsigned long long crc = 0, len = 0, mask = 0;
+    const struct _hexin_crc64 *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "sO&O&", &name, hexin_PyArg_count, &crc, hexin_PyArg_count, &len ) ) {
+        return NULL;
+    }
+
+    param = hexin_crc64_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+
+    mask = ( param->width >= 64 ) ? ~0ULL : ( ( 1ULL << param->width ) - 1 );
+    if ( crc & ~mask ) {
+        PyErr_Format( PyExc_ValueError, "%s is a %u-bit CRC", name, ( unsigned int )param->width );
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLongLong( hexin_crc64_extend_zeros( param, ( unsigned long long )crc, len ) );
+}
+
+static PyObject * _crc64_extend_repeat( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    unsigned long long crc = 0, count = 0, mask = 0;
+    const struct _hexin_crc64 *param = NULL;
+    Py_buffer data = { NULL, NULL };
+    unsigned long long result = 0;
 
 #if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTupleAndKeywords( args, kws, "y*|KKKppp", kwlist, &data,
-                                                                       &crc64_param_hacker.poly,
-                                                                       &crc64_param_hacker.init,
-                                                                       &crc64_param_hacker.xorout,
-                                                                       &crc64_param_hacker.refin,
-                                                                       &crc64_param_hacker.refout,
-                                                                       &reinit ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
+    if ( !PyArg_ParseTuple( args, "sO&y*O&", &name, hexin_PyArg_count, &crc, &data, hexin_PyArg_count, &count ) ) {
+#else
+    if ( !PyArg_ParseTuple( args, "sO&s*O&", &name, hexin_PyArg_count, &crc, &data, hexin_PyArg_count, &count ) ) {
+#endif /* PY_MAJOR_VERSION */
+        return NULL;
+    }
+
+    param = hexin_crc64_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        PyBuffer_Release( &data );
+        return NULL;
+    }
+
+    mask = ( param->width >= 64 ) ? ~0ULL : ( ( 1ULL << param->width ) - 1 );
+    if ( crc & ~mask ) {
+        PyErr_Format( PyExc_ValueError, "%s is a %u-bit CRC", name, ( unsigned int )param->width );
+        PyBuffer_Release( &data );
+        return NULL;
+    }
+
+    if ( ( size_t )data.len < hexin_gil_threshold() ) {
+        result = hexin_crc64_extend_repeat( param, ( unsigned long long )crc, ( const unsigned char * )data.buf, ( size_t )data.len, count );
+    } else {
+        Py_BEGIN_ALLOW_THREADS
+        result = hexin_crc64_extend_repeat( param, ( unsigned long long )crc, ( const unsigned char * )data.buf, ( size_t )data.len, count );
+        Py_END_ALLOW_THREADS
+    }
+    PyBuffer_Release( &data );
+    return PyLong_FromUnsignedLongLong( result );
+}
+
+static PyObject * _crc64_update_range( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    unsigned long long crc = 0, offset = 0, total = 0, mask = 0;
+    const struct _hexin_crc64 *param = NULL;
+    Py_buffer before = { NULL, NULL }, after = { NULL, NULL };
+    PyObject *result = NULL;
+
+#if PY_MAJOR_VERSION >= 3
+    if ( !PyArg_ParseTuple( args, "sO&O&y*y*O&", &name, hexin_PyArg_count, &crc, hexin_PyArg_count, &offset, &before, &after, hexin_PyArg_count, &total ) ) {
+#else
+    if ( !PyArg_ParseTuple( args, "sO&O&s*s*O&", &name, hexin_PyArg_count, &crc, hexin_PyArg_count, &offset, &before, &after, hexin_PyArg_count, &total ) ) {
+#endif /* PY_MAJOR_VERSION */
+        return NULL;
+    }
+
+    param = hexin_crc64_preset( name );
+    mask  = ( ( param == NULL ) || ( param->width >= 64 ) ) ? ~0ULL : ( ( 1ULL << param->width ) - 1 );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+    } else if ( crc & ~mask ) {
+        PyErr_Format( PyExc_ValueError, "%s is a %u-bit CRC", name, ( unsigned int )param->width );
+    } else if ( before.len != after.len ) {
+        PyErr_SetString( PyExc_ValueError, "old_bytes and new_bytes differ in length" );
+    } else if ( ( offset > total ) || ( ( unsigned long long )before.len > total - offset ) ) {
+        PyErr_SetString( PyExc_ValueError, "the range is out of the message" );
+    } else {
+        result = PyLong_FromUnsignedLongLong( hexin_crc64_update_range( param, ( unsigned long long )crc, ( const unsigned char * )before.buf, ( const unsigned char * )after.buf,
+                                                                       ( size_t )before.len, total - offset - ( unsigned long long )before.len ) );
+    }
+    PyBuffer_Release( &before );
+    PyBuffer_Release( &after );
+    return result;
+}
+
+static unsigned long long hexin_crc64_hasher_begin( const void *param )
+{
+    struct _hexin_crc64 local = *( const struct _hexin_crc64 * )param;
+
+    local.is_gradual = FALSE;
+    return hexin_crc64_compute_begin( &local, local.init );
+}
+
+static unsigned long long hexin_crc64_hasher_update( const void *param, unsigned long long crc, const unsigned char *pSrc, size_t len )
+{
+    return hexin_crc64_compute_update( ( const struct _hexin_crc64 * )param, ( unsigned long long )crc, pSrc, len );
+}
+
+static unsigned long long hexin_crc64_hasher_end( const void *param, unsigned long long crc )
+{
+    return hexin_crc64_compute_end( ( const struct _hexin_crc64 * )param, ( unsigned long long )crc );
+}
+
+static const struct _hexin_hasher_ops crc64_hasher_ops = { hexin_crc64_hasher_begin, hexin_crc64_hasher_update, hexin_crc64_hasher_end };
+
+static PyObject * _crc64_new( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    const struct _hexin_crc64 *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "s", &name ) ) {
+        return NULL;
+    }
+
+    param = hexin_crc64_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+    return hexin_hasher_new( &crc64_hasher_ops, param, name, param->width, NULL );
+}
+
+static PyObject * _crc64_batch( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    PyObject *data = NULL, *out = NULL, *offsets = Py_None, *lengths = Py_None, *expected = Py_None;
+    int rows = 0;
+    const struct _hexin_crc64 *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "sOO|OOOi", &name, &data, &out, &offsets, &lengths, &expected, &rows ) ) {
+        return NULL;
+    }
+
+    param = hexin_crc64_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+    return hexin_batch_compute( &crc64_hasher_ops, param, param->width, data, out,
+                                ( offsets  == Py_None ) ? NULL : offsets,
+                                ( lengths  == Py_None ) ? NULL : lengths,
+                                ( expected == Py_None ) ? NULL : expected, rows );
+}
+
+static PyObject * _crc64_file( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    PyObject *file = NULL;
+    const struct _hexin_crc64 *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "sO", &name, &file ) ) {
+        return NULL;
+    }
+
+    param = hexin_crc64_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+    return hexin_file_compute( &crc64_hasher_ops, param, file );
+}
+
+static PyObject * _crc64_files( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    PyObject *files = NULL;
+    unsigned int threads = 0;
+    const struct _hexin_crc64 *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "sO|O&", &name, &files, hexin_PyArg_threads, &threads ) ) {
+        return NULL;
+    }
+
+    param = hexin_crc64_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+    return hexin_file_compute_many( &crc64_hasher_ops, param, files, threads );
+}
+
+static PyObject * _crc64_capsule( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    const struct _hexin_crc64 *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "s", &name ) ) {
+        return NULL;
+    }
+
+    param = hexin_crc64_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+    return hexin_multi_capsule( &crc64_hasher_ops, param, NULL );
+}
+
+static PyObject * _crc64_kernels( PyObject *self, PyObject *args )
+{
+    return Py_BuildValue( "{s:s}", "crc64", hexin_clmul_kernel() );
+}
+
+static PyObject * _crc64_gil_threshold( PyObject *self, PyObject *args )
+{
+    Py_ssize_t threshold = -1;
+
+    if ( !PyArg_ParseTuple( args, "|n", &threshold ) ) {
+        return NULL;
+    }
+    return PyLong_FromSize_t( hexin_set_gil_threshold( ( threshold < 0 ) ? ( size_t )-1 : ( size_t )threshold ) );
+}
+
+/*
+ * libscrc.CRC( width, poly, init=0, refin=False, refout=False, xorout=0 ) : a Rocksoft model of any
+ * width from 1 to 64. The 64-bit register keeps a narrower CRC left-aligned ( MSB-first ) or
+ * right-aligned ( reflected ), so the crc64 kernels serve every width. The tables are taken from
+ * the hacker cache once, by the left-aligned polynomial, and nothing is written after CRC().
+ */
+#if ( PY_VERSION_HEX >= 0x03080000 ) && !defined( PYPY_VERSION )
+#define                 HEXIN_VECTORCALL                        1
+#endif
+
+typedef struct {
+    PyObject_HEAD
+#if defined( HEXIN_VECTORCALL )
+    vectorcallfunc               vectorcall;
+#endif
+    struct _hexin_crc64          param;
+    struct _hexin_combine        combine;
+    struct _hexin_hacker_entry  *entry;
+} hexin_crc64_model_object;
+
+static PyTypeObject hexin_crc64_model_type;
+
+static unsigned long long hexin_crc64_model_mask( unsigned int width )
+{
+    return ( width >= HEXIN_CRC64_WIDTH ) ? ~0ULL : ( ( 1ULL << width ) - 1 );
+}
+
+/* An integer of at most width bits, -1 with an exception set. */
+static int hexin_crc64_model_value( PyObject *object, const char *name, unsigned int width, unsigned long long *value )
+{
+    if ( object == NULL ) {
+        return 0;
+    }
+    if ( PyFloat_Check( object ) ) {
+        PyErr_SetString( PyExc_TypeError, "integer argument expected, got float" );
+        return -1;
+    }
+    *value = PyLong_AsUnsignedLongLong( object );
+    if ( ( *value == ( unsigned long long )-1 ) && PyErr_Occurred() ) {
+        return -1;
+    }
+    if ( *value & ~hexin_crc64_model_mask( width ) ) {
+        PyErr_Format( PyExc_ValueError, "%s does not fit in %u bits", name, width );
+        return -1;
+    }
+    return 0;
+}
+
+static PyObject *hexin_crc64_model_compute( PyObject *self, HEXIN_FASTCALL_PARAMS )
+{
+    unsigned long long result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &( ( hexin_crc64_model_object * )self )->param, &result ) ) {
+        return NULL;
+    }
+    return PyLong_FromUnsignedLongLong( result );
+}
+
+#if defined( HEXIN_VECTORCALL )
+static PyObject *hexin_crc64_model_vectorcall( PyObject *self, PyObject *const *args, size_t nargsf, PyObject *kwnames )
+{
+    return hexin_crc64_model_compute( self, args, PyVectorcall_NARGS( nargsf ), kwnames );
+}
+#elif defined( HEXIN_FASTCALL )
+/* No vectorcall : lay the tuple and the dict out as a fastcall stack. */
+static PyObject *hexin_crc64_model_call( PyObject *self, PyObject *args, PyObject *kws )
+{
+    PyObject *stack[3], *kwnames = NULL, *key = NULL, *value = NULL, *result = NULL;
+    Py_ssize_t count = PyTuple_GET_SIZE( args ), size = ( kws != NULL ) ? PyDict_Size( kws ) : 0, pos = 0, i = 0;
+
+    if ( count + size > 3 ) {
+        PyErr_Format( PyExc_TypeError, "function takes at most 3 arguments (%zd given)", count + size );
+        return NULL;
+    }
+    for ( i=0; i<count; i++ ) {
+        stack[i] = PyTuple_GET_ITEM( args, i );
+    }
+    if ( size > 0 ) {
+        kwnames = PyTuple_New( size );
+        if ( kwnames == NULL ) {
+            return NULL;
+        }
+        for ( i=0; PyDict_Next( kws, &pos, &key, &value ); i++ ) {
+            Py_INCREF( key );
+            PyTuple_SET_ITEM( kwnames, i, key );
+            stack[count + i] = value;
         }
-        return NULL; 
     }
+    result = hexin_crc64_model_compute( self, stack, count, kwnames );
+    Py_XDECREF( kwnames );
+    return result;
+}
+#endif
+
+static PyObject *hexin_crc64_model_new( PyTypeObject *type, PyObject *args, PyObject *kws )
+{
+    static char *kwlist[] = { "width", "poly", "init", "refin", "refout", "xorout", NULL };
+    PyObject *poly = NULL, *init = NULL, *refin = NULL, *refout = NULL, *xorout = NULL;
+    unsigned int width = 0, reflect = FALSE;
+    hexin_crc64_model_object *self = NULL;
+    struct _hexin_crc64 *param = NULL;
+
+    if ( !PyArg_ParseTupleAndKeywords( args, kws, "IO|OOOO:CRC", kwlist, &width, &poly, &init, &refin, &refout, &xorout ) ) {
+        return NULL;
+    }
+    if ( ( width < 1 ) || ( width > HEXIN_CRC64_WIDTH ) ) {
+        PyErr_Format( PyExc_ValueError, "width must be 1 ... 64, not %u", width );
+        return NULL;
+    }
+
+    self = ( hexin_crc64_model_object * )type->tp_alloc( type, 0 );
+    if ( self == NULL ) {
+        return NULL;
+    }
+#if defined( HEXIN_VECTORCALL )
+    self->vectorcall = hexin_crc64_model_vectorcall;
+#endif
+    param = &self->param;
+    param->width = width;
+    if ( ( hexin_crc64_model_value( poly,   "poly",   width, &param->poly   ) < 0 )
+      || ( hexin_crc64_model_value( init,   "init",   width, &param->init   ) < 0 )
+      || ( hexin_crc64_model_value( xorout, "xorout", width, &param->xorout ) < 0 )
+      || ( ( refin  != NULL ) && ( hexin_fastcall_bool( refin,  &param->refin  ) < 0 ) )
+      || ( ( refout != NULL ) && ( hexin_fastcall_bool( refout, &reflect       ) < 0 ) ) ) {
+        Py_DECREF( self );
+        return NULL;
+    }
+    param->refout = reflect;
+
+    /* The tables depend on the left-aligned polynomial only, hacker64 and every width share them. */
+    self->entry = hexin_hacker_acquire( &crc64_hacker_cache, param, param->poly << ( HEXIN_CRC64_WIDTH - width ), HEXIN_TABLE_TYPE( param ), FALSE );
+    if ( self->entry == NULL ) {
+        Py_DECREF( self );
+        return NULL;
+    }
+    param->is_initial = self->entry->type;
+    param->table      = self->entry->table;
+    param->clmul      = &self->entry->clmul;
+
+    hexin_combine_init( &self->combine, width, param->poly );
+    param->combine = &self->combine;
+    return ( PyObject * )self;
+}
+
+static void hexin_crc64_model_dealloc( hexin_crc64_model_object *self )
+{
+    if ( self->entry != NULL ) {
+        hexin_hacker_release( &crc64_hacker_cache, self->entry );
+    }
+    Py_TYPE( self )->tp_free( ( PyObject * )self );
+}
+
+static PyObject *hexin_crc64_model_repr( hexin_crc64_model_object *self )
+{
+    char text[160];
+    const struct _hexin_crc64 *param = &self->param;
+    unsigned int digits = ( param->width + 3 ) / 4;
+
+    PyOS_snprintf( text, sizeof( text ), "libscrc.CRC(width=%u, poly=0x%0*llX, init=0x%0*llX, refin=%s, refout=%s, xorout=0x%0*llX)",
+                   param->width, digits, param->poly, digits, param->init,
+                   param->refin ? "True" : "False", param->refout ? "True" : "False", digits, param->xorout );
+    return Py_BuildValue( "s", text );
+}
+
+static PyObject *hexin_crc64_model_hasher( hexin_crc64_model_object *self, PyObject *args )
+{
+    Py_buffer data = { NULL, NULL };
+    PyObject *hasher = NULL, *result = NULL;
+    char name[8];
+
+#if PY_MAJOR_VERSION >= 3
+    if ( !PyArg_ParseTuple( args, "|y*", &data ) ) {
 #else
-    if ( !PyArg_ParseTupleAndKeywords( args, kws, "s*|KKKIII", kwlist, &data,
-                                                                       &crc64_param_hacker.poly,
-                                                                       &crc64_param_hacker.init,
-                                                                       &crc64_param_hacker.xorout,
-                                                                       &crc64_param_hacker.refin,
-                                                                       &crc64_param_hacker.refout,
-                                                                       &reinit ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
+    if ( !PyArg_ParseTuple( args, "|s*", &data ) ) {
+#endif /* PY_MAJOR_VERSION */
+        return NULL;
+    }
+
+    PyOS_snprintf( name, sizeof( name ), "crc%u", self->param.width );
+    hasher = hexin_hasher_new( &crc64_hasher_ops, &self->param, name, self->param.width, ( PyObject * )self );
+    if ( ( hasher != NULL ) && ( data.buf != NULL ) && ( data.len > 0 ) ) {
+        result = PyObject_CallMethod( hasher, "update", "O", data.obj );
+        if ( result == NULL ) {
+            Py_CLEAR( hasher );
         }
-        return NULL; 
+        Py_XDECREF( result );
+    }
+    if ( data.buf != NULL ) {
+        PyBuffer_Release( &data );
     }
+    return hasher;
+}
+
+/* -1 with ValueError when crc does not fit the width of the model. */
+static int hexin_crc64_model_check( hexin_crc64_model_object *self, unsigned long long crc )
+{
+    unsigned long long mask = ( self->param.width >= 64 ) ? ~0ULL : ( ( 1ULL << self->param.width ) - 1 );
+
+    if ( crc & ~mask ) {
+        PyErr_Format( PyExc_ValueError, "the model is a %u-bit CRC", ( unsigned int )self->param.width );
+        return -1;
+    }
+    return 0;
+}
+
+static PyObject *hexin_crc64_model_combine( hexin_crc64_model_object *self, PyObject *args )
+{
+    unsigned long long crc_a = 0, crc_b = 0, len_b = 0;
+
+    if ( !PyArg_ParseTuple( args, "O&O&O&", hexin_PyArg_count, &crc_a, hexin_PyArg_count, &crc_b, hexin_PyArg_count, &len_b ) ) {
+        return NULL;
+    }
+    if ( ( hexin_crc64_model_check( self, crc_a ) < 0 ) || ( hexin_crc64_model_check( self, crc_b ) < 0 ) ) {
+        return NULL;
+    }
+    return PyLong_FromUnsignedLongLong( hexin_crc64_combine( &self->param, crc_a, crc_b, len_b ) );
+}
+
+static PyObject *hexin_crc64_model_extend_zeros( hexin_crc64_model_object *self, PyObject *args )
+{
+    unsigned long long crc = 0, len = 0;
+
+    if ( !PyArg_ParseTuple( args, "O&O&", hexin_PyArg_count, &crc, hexin_PyArg_count, &len ) ) {
+        return NULL;
+    }
+    if ( hexin_crc64_model_check( self, crc ) < 0 ) {
+        return NULL;
+    }
+    return PyLong_FromUnsignedLongLong( hexin_crc64_extend_zeros( &self->param, crc, len ) );
+}
+
+static PyObject *hexin_crc64_model_extend_repeat( hexin_crc64_model_object *self, PyObject *args )
+{
+    unsigned long long crc = 0, count = 0, result = 0;
+    Py_buffer data = { NULL, NULL };
+
+#if PY_MAJOR_VERSION >= 3
+    if ( !PyArg_ParseTuple( args, "O&y*O&", hexin_PyArg_count, &crc, &data, hexin_PyArg_count, &count ) ) {
+#else
+    if ( !PyArg_ParseTuple( args, "O&s*O&", hexin_PyArg_count, &crc, &data, hexin_PyArg_count, &count ) ) {
 #endif /* PY_MAJOR_VERSION */
+        return NULL;
+    }
+    if ( hexin_crc64_model_check( self, crc ) < 0 ) {
+        PyBuffer_Release( &data );
+        return NULL;
+    }
+    if ( ( size_t )data.len < hexin_gil_threshold() ) {
+        result = hexin_crc64_extend_repeat( &self->param, crc, ( const unsigned char * )data.buf, ( size_t )data.len, count );
+    } else {
+        Py_BEGIN_ALLOW_THREADS
+        result = hexin_crc64_extend_repeat( &self->param, crc, ( const unsigned char * )data.buf, ( size_t )data.len, count );
+        Py_END_ALLOW_THREADS
+    }
+    PyBuffer_Release( &data );
+    return PyLong_FromUnsignedLongLong( result );
+}
 
-    crc64_param_hacker.is_initial = ( reinit == FALSE ) ? crc64_param_hacker.is_initial : FALSE;
-    crc64_param_hacker.result = hexin_crc64_compute( (const unsigned char *)data.buf, (unsigned int)data.len, &crc64_param_hacker, crc64_param_hacker.init );
+static PyObject *hexin_crc64_model_update_range( hexin_crc64_model_object *self, PyObject *args )
+{
+    unsigned long long crc = 0, offset = 0, total = 0;
+    Py_buffer before = { NULL, NULL }, after = { NULL, NULL };
+    PyObject *result = NULL;
 
-    if ( data.obj )
-       PyBuffer_Release( &data );
+#if PY_MAJOR_VERSION >= 3
+    if ( !PyArg_ParseTuple( args, "O&O&y*y*O&", hexin_PyArg_count, &crc, hexin_PyArg_count, &offset, &before, &after, hexin_PyArg_count, &total ) ) {
+#else
+    if ( !PyArg_ParseTuple( args, "O&O&s*s*O&", hexin_PyArg_count, &crc, hexin_PyArg_count, &offset, &before, &after, hexin_PyArg_count, &total ) ) {
+#endif /* PY_MAJOR_VERSION */
+        return NULL;
+    }
 
-    return Py_BuildValue( "K", crc64_param_hacker.result );
+    if ( hexin_crc64_model_check( self, crc ) < 0 ) {
+        result = NULL;
+    } else if ( before.len != after.len ) {
+        PyErr_SetString( PyExc_ValueError, "old_bytes and new_bytes differ in length" );
+    } else if ( ( offset > total ) || ( ( unsigned long long )before.len > total - offset ) ) {
+        PyErr_SetString( PyExc_ValueError, "the range is out of the message" );
+    } else {
+        result = PyLong_FromUnsignedLongLong( hexin_crc64_update_range( &self->param, crc, ( const unsigned char * )before.buf, ( const unsigned char * )after.buf,
+                                                                        ( size_t )before.len, total - offset - ( unsigned long long )before.len ) );
+    }
+    PyBuffer_Release( &before );
+    PyBuffer_Release( &after );
+    return result;
+}
+
+static PyObject *hexin_crc64_model_file( hexin_crc64_model_object *self, PyObject *file )
+{
+    return hexin_file_compute( &crc64_hasher_ops, &self->param, file );
+}
+
+static PyObject *hexin_crc64_model_files( hexin_crc64_model_object *self, PyObject *args )
+{
+    PyObject *files = NULL;
+    unsigned int threads = 0;
+
+    if ( !PyArg_ParseTuple( args, "O|O&", &files, hexin_PyArg_threads, &threads ) ) {
+        return NULL;
+    }
+    return hexin_file_compute_many( &crc64_hasher_ops, &self->param, files, threads );
+}
+
+static PyObject *hexin_crc64_model_capsule( hexin_crc64_model_object *self, PyObject *unused )
+{
+    return hexin_multi_capsule( &crc64_hasher_ops, &self->param, ( PyObject * )self );
+}
+
+static PyObject *hexin_crc64_model_get( hexin_crc64_model_object *self, void *closure )
+{
+    const struct _hexin_crc64 *param = &self->param;
+
+    switch ( ( size_t )closure ) {
+        case 0 : return Py_BuildValue( "I", param->width );
+        case 1 : return PyLong_FromUnsignedLongLong( param->poly );
+        case 2 : return PyLong_FromUnsignedLongLong( param->init );
+        case 3 : return PyBool_FromLong( param->refin );
+        case 4 : return PyBool_FromLong( param->refout );
+        case 5 : return PyLong_FromUnsignedLongLong( param->xorout );
+        default: return PyLong_FromUnsignedLongLong( hexin_crc64_compute( ( const unsigned char * )"123456789", 9, param, param->init ) );
+    }
+}
+
+static PyMethodDef hexin_crc64_model_methods[] = {
+    { "new",     (PyCFunction)hexin_crc64_model_hasher,  METH_VARARGS, "A hashlib-style hasher of the model : new( data=b'' ), see libscrc.new()" },
+    { "combine", (PyCFunction)hexin_crc64_model_combine, METH_VARARGS, "CRC( A || B ) : combine( crc_a, crc_b, len_b ), see libscrc.combine()" },
+    { "extend_zeros",  (PyCFunction)hexin_crc64_model_extend_zeros,  METH_VARARGS, "CRC( A || n zero bytes ) : extend_zeros( crc, n ), see libscrc.extend_zeros()" },
+    { "extend_repeat", (PyCFunction)hexin_crc64_model_extend_repeat, METH_VARARGS, "CRC( A || block * count ) : extend_repeat( crc, block, count )" },
+    { "update_range",  (PyCFunction)hexin_crc64_model_update_range,  METH_VARARGS, "CRC after a range was rewritten : update_range( crc, offset, old_bytes, new_bytes, total_len )" },
+    { "file",    (PyCFunction)hexin_crc64_model_file,    METH_O,       "CRC of a file without the GIL : file( path or fd ), see libscrc.file_crc()" },
+    { "files",   (PyCFunction)hexin_crc64_model_files,   METH_VARARGS, "( crc, size ) of many files : files( files, threads=0 ), see libscrc.files_crc()" },
+    { "_capsule", (PyCFunction)hexin_crc64_model_capsule, METH_NOARGS, "The kernel of the model for libscrc.multi()" },
+    { NULL, NULL, 0, NULL }        /* Sentinel */
+};
+
+static PyGetSetDef hexin_crc64_model_getset[] = {
+    { "width",  (getter)hexin_crc64_model_get, NULL, "The CRC width in bits",           ( void * )0 },
+    { "poly",   (getter)hexin_crc64_model_get, NULL, "The polynomial, MSB-first",       ( void * )1 },
+    { "init",   (getter)hexin_crc64_model_get, NULL, "The initial register",            ( void * )2 },
+    { "refin",  (getter)hexin_crc64_model_get, NULL, "The input bytes are reflected",   ( void * )3 },
+    { "refout", (getter)hexin_crc64_model_get, NULL, "The result is reflected",         ( void * )4 },
+    { "xorout", (getter)hexin_crc64_model_get, NULL, "XORed into the result",           ( void * )5 },
+    { "check",  (getter)hexin_crc64_model_get, NULL, "The CRC of b'123456789'",         ( void * )6 },
+    { NULL, NULL, NULL, NULL, NULL }
+};
+
+static PyTypeObject hexin_crc64_model_type = {
+    PyVarObject_HEAD_INIT( NULL, 0 )
+    "libscrc.CRC",                              /* tp_name */
+    sizeof( hexin_crc64_model_object ),         /* tp_basicsize */
+    0,                                          /* tp_itemsize */
+    (destructor)hexin_crc64_model_dealloc,      /* tp_dealloc */
+};
+
+static int hexin_crc64_model_ready( PyObject *module )
+{
+    hexin_crc64_model_type.tp_flags   = Py_TPFLAGS_DEFAULT;
+    hexin_crc64_model_type.tp_doc     = "CRC( width, poly, init=0, refin=False, refout=False, xorout=0 ) : a CRC model of any width 1 ... 64.\n"
+                                        "model( data [, crc ] [, *, threads ] ) computes like the presets, the tables are built once.";
+    hexin_crc64_model_type.tp_new     = hexin_crc64_model_new;
+    hexin_crc64_model_type.tp_repr    = (reprfunc)hexin_crc64_model_repr;
+    hexin_crc64_model_type.tp_methods = hexin_crc64_model_methods;
+    hexin_crc64_model_type.tp_getset  = hexin_crc64_model_getset;
+#if defined( HEXIN_VECTORCALL )
+    hexin_crc64_model_type.tp_flags  |= Py_TPFLAGS_HAVE_VECTORCALL;
+    hexin_crc64_model_type.tp_vectorcall_offset = offsetof( hexin_crc64_model_object, vectorcall );
+    hexin_crc64_model_type.tp_call    = PyVectorcall_Call;
+#elif defined( HEXIN_FASTCALL )
+    hexin_crc64_model_type.tp_call    = hexin_crc64_model_call;
+#else
+    hexin_crc64_model_type.tp_call    = hexin_crc64_model_compute;
+#endif
+
+    if ( PyType_Ready( &hexin_crc64_model_type ) < 0 ) {
+        return -1;
+    }
+
+    Py_INCREF( &hexin_crc64_model_type );
+    return PyModule_AddObject( module, "CRC", ( PyObject * )&hexin_crc64_model_type );
 }
 
 /* method table */
 static PyMethodDef _crc64Methods[] = {
-    { "iso",         (PyCFunction)_crc64_iso,     METH_VARARGS, "Calculate GO-IOS of CRC64 [Poly=0x000000000000001BL, Init=0xFFFFFFFFFFFFFFFFL, refin=True,  refout=True,  xorout=0xFFFFFFFFFFFFFFFFL]" },
-    { "ecma182",     (PyCFunction)_crc64_ecma182, METH_VARARGS, "Calculate ECMA182 of CRC64 [Poly=0x42F0E1EBA9EA3693L, Init=0x0000000000000000, refin=False, refout=False, xorout=0x0000000000000000]" },
-    { "we",          (PyCFunction)_crc64_we,      METH_VARARGS, "Calculate WE of CRC64 [Poly=0x42F0E1EBA9EA3693L, Init=0xFFFFFFFFFFFFFFFFL, refin=False, refout=False, xorout=0xFFFFFFFFFFFFFFFFL]" },
-    { "xz64",        (PyCFunction)_crc64_xz,      METH_VARARGS, "Calculate XZ of CRC64 [Poly=0x42F0E1EBA9EA3693L, Init=0xFFFFFFFFFFFFFFFFL, refin=True, refout=True, xorout=0xFFFFFFFFFFFFFFFFL]" },
-    { "gsm40",       (PyCFunction)_crc64_gsm40,   METH_VARARGS, "Calculate GSM of CRC40 [Poly=0x0004820009L, Init=0x0000000000, refin=False, refout=False, xorout=0xFFFFFFFFFF ]" },
+    { "iso",         (PyCFunction)_crc64_iso,     HEXIN_METH_FASTCALL, "Calculate GO-IOS of CRC64 [Poly=0x000000000000001BL, Init=0xFFFFFFFFFFFFFFFFL, refin=True,  refout=True,  xorout=0xFFFFFFFFFFFFFFFFL]" },
+    { "ecma182",     (PyCFunction)_crc64_ecma182, HEXIN_METH_FASTCALL, "Calculate ECMA182 of CRC64 [Poly=0x42F0E1EBA9EA3693L, Init=0x0000000000000000, refin=False, refout=False, xorout=0x0000000000000000]" },
+    { "we",          (PyCFunction)_crc64_we,      HEXIN_METH_FASTCALL, "Calculate WE of CRC64 [Poly=0x42F0E1EBA9EA3693L, Init=0xFFFFFFFFFFFFFFFFL, refin=False, refout=False, xorout=0xFFFFFFFFFFFFFFFFL]" },
+    { "xz64",        (PyCFunction)_crc64_xz,      HEXIN_METH_FASTCALL, "Calculate XZ of CRC64 [Poly=0x42F0E1EBA9EA3693L, Init=0xFFFFFFFFFFFFFFFFL, refin=True, refout=True, xorout=0xFFFFFFFFFFFFFFFFL]" },
+    { "gsm40",       (PyCFunction)_crc64_gsm40,   HEXIN_METH_FASTCALL, "Calculate GSM of CRC40 [Poly=0x0004820009L, Init=0x0000000000, refin=False, refout=False, xorout=0xFFFFFFFFFF ]" },
     { "table64",     (PyCFunction)_crc64_table,   METH_VARARGS, "Print CRC64 table to list. libscrc.table64( polynomial )" },
-    { "hacker64",    (PyCFunction)_crc64_hacker,  METH_KEYWORDS|METH_VARARGS, "User calculation CRC64\n"
+    { "hacker64",    (PyCFunction)_crc64_hacker,  HEXIN_METH_FASTCALL, "User calculation CRC64\n"
                                                                               "@data   : bytes\n"
                                                                               "@poly   : default=0x42F0E1EBA9EA3693\n"
                                                                               "@init   : default=0x0000000000000000\n"
                                                                               "@xorout : default=0x0000000000000000\n"
                                                                               "@ref    : default=False" },
+    { "_kernels",    (PyCFunction)_crc64_kernels, METH_NOARGS, "The kernel tier every family of this module is bound to." },
+    { "_gil_threshold", (PyCFunction)_crc64_gil_threshold, METH_VARARGS, "Release the GIL for buffers of at least this many bytes, returns the previous value." },
+    { "_presets",    (PyCFunction)_crc64_presets_list, METH_NOARGS, "The names of the presets of this module." },
+    { "_combine",    (PyCFunction)_crc64_combine, METH_VARARGS, "CRC( A || B ) of a preset : _combine( name, crc_a, crc_b, len_b )" },
+    { "_extend_zeros",  (PyCFunction)_crc64_extend_zeros,  METH_VARARGS, "CRC( A || n zero bytes ) : _extend_zeros( name, crc, n )" },
+    { "_extend_repeat", (PyCFunction)_crc64_extend_repeat, METH_VARARGS, "CRC( A || block * count ) : _extend_repeat( name, crc, block, count )" },
+    { "_update_range",  (PyCFunction)_crc64_update_range,  METH_VARARGS, "CRC after a range was rewritten : _update_range( name, crc, offset, old, new, total_len )" },
+    { "_new",        (PyCFunction)_crc64_new, METH_VARARGS, "A hashlib-style hasher of a preset : _new( name )" },
+    { "_batch",      (PyCFunction)_crc64_batch, METH_VARARGS, "CRC of many buffers into an integer array : _batch( name, data, out, offsets, lengths, expected, rows )" },
+    { "_file",       (PyCFunction)_crc64_file, METH_VARARGS, "CRC of a file without the GIL : _file( name, path or fd )" },
+    { "_files",      (PyCFunction)_crc64_files, METH_VARARGS, "( crc, size ) of many files on a thread pool : _files( name, files, threads=0 )" },
+    { "_capsule",    (PyCFunction)_crc64_capsule, METH_VARARGS, "The kernel of a preset for _multi : _capsule( name )" },
+    { "_multi",      (PyCFunction)hexin_multi_compute, METH_VARARGS, "Many CRCs of data in one pass : _multi( data, capsules )" },
     { NULL, NULL, 0, NULL }        /* Sentinel */
 };
 
@@ -318,6 +1072,7 @@ PyDoc_STRVAR( _crc64_doc,
 "libscrc.xz64     -> Calculate XZ of CRC64 [Poly=0x42F0E1EBA9EA3693L, Init=0xFFFFFFFFFFFFFFFFL, refin=True, refout=True, xorout=0xFFFFFFFFFFFFFFFFL]\n"
 "libscrc.gsm40    -> Calculate GSM of CRC40 [Poly=0x0004820009L, Init=0x0000000000, refin=False, refout=False, xorout=0xFFFFFFFFFF]\n"
 "libscrc.hacker64 -> Free calculation CRC64 Xorout=0 Refin=False Refout=False\n"
+"libscrc.CRC      -> CRC model of any width 1 ... 64, CRC( width, poly, init, refin, refout, xorout )( data )\n"
 "\n" );
 
 
@@ -343,9 +1098,28 @@ PyInit__crc64( void )
         return NULL;
     }
 
+    if ( ( hexin_hasher_ready( m ) < 0 ) || ( hexin_hacker_ready( &crc64_hacker_cache ) < 0 ) || ( hexin_crc64_model_ready( m ) < 0 ) ) {
+        Py_DECREF( m );
+        return NULL;
+    }
+
     PyModule_AddStringConstant( m, "__version__", "1.7" );
     PyModule_AddStringConstant( m, "__author__",  "Heyn");
 
+    /* Probe the CPU once and pick the kernel tier ( AVX-512 / PCLMULQDQ / tables ), LIBSCRC_KERNEL may lower it. */
+    hexin_clmul_level();
+    hexin_gil_threshold();
+
+    if ( !hexin_kernel_is_known() && ( PyErr_WarnEx( PyExc_RuntimeWarning, HEXIN_KERNEL_UNKNOWN, 1 ) < 0 ) ) {
+        Py_DECREF( m );
+        return NULL;
+    }
+
+#ifdef Py_GIL_DISABLED
+    /* The presets are read-only and every call keeps its state on the stack. */
+    PyUnstable_Module_SetGIL( m, Py_MOD_GIL_NOT_USED );
+#endif
+
     return m;
 }
 
@@ -355,7 +1129,13 @@ PyInit__crc64( void )
 PyMODINIT_FUNC
 init_crc64( void )
 {
-    (void) Py_InitModule3( "_crc64", _crc64Methods, _crc64_doc );
+    PyObject *m = Py_InitModule3( "_crc64", _crc64Methods, _crc64_doc );
+
+    if ( m != NULL ) {
+        hexin_hasher_ready( m );
+        hexin_hacker_ready( &crc64_hacker_cache );
+        hexin_crc64_model_ready( m );
+    }
 }
 
 #endif /* PY_MAJOR_VERSION */
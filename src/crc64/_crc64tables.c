@@ -33,12 +33,12 @@ static unsigned char __hexin_reverse8( unsigned char data )
 
 unsigned long long hexin_reverse64( unsigned long long data )
 {
-    unsigned int i = 0;
-    unsigned long long t = 0;
-    for ( i=0; i<64; i++ ) {
-        t |= ( ( data >> i ) & 0x0000000000000001L ) << ( 63-i );
-    }
-    return t;
+    data = ( ( data >> 1  ) & 0x5555555555555555ULL ) | ( ( data & 0x5555555555555555ULL ) << 1  );
+    data = ( ( data >> 2  ) & 0x3333333333333333ULL ) | ( ( data & 0x3333333333333333ULL ) << 2  );
+    data = ( ( data >> 4  ) & 0x0F0F0F0F0F0F0F0FULL ) | ( ( data & 0x0F0F0F0F0F0F0F0FULL ) << 4  );
+    data = ( ( data >> 8  ) & 0x00FF00FF00FF00FFULL ) | ( ( data & 0x00FF00FF00FF00FFULL ) << 8  );
+    data = ( ( data >> 16 ) & 0x0000FFFF0000FFFFULL ) | ( ( data & 0x0000FFFF0000FFFFULL ) << 16 );
+    return ( data >> 32 ) | ( data << 32 );
 }
 
 unsigned char hexin_crc64_init_table_poly_is_high( unsigned long long polynomial, unsigned long long *table )
@@ -104,50 +104,119 @@ unsigned long long hexin_crc64_poly_is_low_calc( unsigned long long crc64, unsig
     return crc;
 }
 
-static unsigned int hexin_crc64_compute_init_table( struct _hexin_crc64 *param )
+unsigned int hexin_crc64_compute_init_table( struct _hexin_crc64 *param, unsigned long long (*table)[MAX_TABLE_ARRAY], struct _hexin_clmul *clmul )
 {
     unsigned int i = 0, j = 0;
     unsigned long long crc = 0x0000000000000000L;
     unsigned long long c   = 0x0000000000000000L;
+    unsigned long long poly = ( param->poly << ( HEXIN_CRC64_WIDTH - param->width ) );
+
+    param->table = ( const unsigned long long (*)[MAX_TABLE_ARRAY] )table;
+    param->clmul = clmul;
+
+    /* The folding kernel takes the left-aligned polynomial in either orientation. */
+    hexin_clmul_init( clmul, poly );
+
+    if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
+        hexin_crc64_init_table_poly_is_high( hexin_reverse64( poly ), table[0] );
+        for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
+            crc = table[0][i];
+            for ( j=1; j<MAX_SLICING_ARRAY; j++ ) {
+                crc = ( crc >> 8 ) ^ table[0][ crc & 0xFF ];
+                table[j][i] = crc;
+            }
+        }
+        return HEXIN_TABLE_IS_REFLECTED;
+    }
 
     for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
         crc = 0;
         c	= ( ( unsigned long long ) i ) << 56;
         for ( j=0; j<8; j++ ) {
             if ( ( crc ^ c ) & 0x8000000000000000L ) {
-                crc = ( crc << 1 ) ^ param->poly;
+                crc = ( crc << 1 ) ^ poly;
             } else { 
                 crc = ( crc << 1 );
             }
             c = c << 1;
         }
-        param->table[i] = crc;
+        table[0][i] = crc;
     }
 
-    return TRUE;
+    /* Slicing tables : table[k][i] is the CRC of byte i followed by k zero bytes. */
+    for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
+        crc = table[0][i];
+        for ( j=1; j<MAX_SLICING_ARRAY; j++ ) {
+            crc = ( crc << 8 ) ^ table[0][ crc >> 56 ];
+            table[j][i] = crc;
+        }
+    }
+
+    return HEXIN_TABLE_IS_NORMAL;
 }
 
-static unsigned long long hexin_crc64_compute_char( unsigned long long crc64, unsigned char c, struct _hexin_crc64 *param )
+static unsigned long long hexin_crc64_compute_char( unsigned long long crc64, unsigned char c, const struct _hexin_crc64 *param )
 {
     unsigned long long crc = crc64;
-    crc = (crc << 8) ^ param->table[ ((crc >> 56) ^ (0x00000000000000FFL & (unsigned long long)c)) & 0xFF ];
+    crc = (crc << 8) ^ param->table[0][ ((crc >> 56) ^ (0x00000000000000FFL & (unsigned long long)c)) & 0xFF ];
     return crc;
 }
 
-unsigned long long hexin_crc64_compute( const unsigned char *pSrc, unsigned int len, struct _hexin_crc64 *param, unsigned long long init )
+static unsigned long long hexin_crc64_load( const unsigned char *p )
+{
+    return ( ( unsigned long long )p[0] << 56 ) | ( ( unsigned long long )p[1] << 48 )
+         | ( ( unsigned long long )p[2] << 40 ) | ( ( unsigned long long )p[3] << 32 )
+         | ( ( unsigned long long )p[4] << 24 ) | ( ( unsigned long long )p[5] << 16 )
+         | ( ( unsigned long long )p[6] << 8  ) | ( ( unsigned long long )p[7] );
+}
+
+static unsigned long long hexin_crc64_compute_slicing8( unsigned long long crc, const unsigned char *p, const unsigned long long (*table)[MAX_TABLE_ARRAY] )
+{
+    crc ^= hexin_crc64_load( p );
+    return table[7][ crc >> 56 ]          ^ table[6][ ( crc >> 48 ) & 0xFF ] ^ table[5][ ( crc >> 40 ) & 0xFF ] ^ table[4][ ( crc >> 32 ) & 0xFF ]
+         ^ table[3][ ( crc >> 24 ) & 0xFF ] ^ table[2][ ( crc >> 16 ) & 0xFF ] ^ table[1][ ( crc >> 8  ) & 0xFF ] ^ table[0][ crc & 0xFF ];
+}
+
+static unsigned long long hexin_crc64_compute_slicing16( unsigned long long crc, const unsigned char *p, const unsigned long long (*table)[MAX_TABLE_ARRAY] )
+{
+    crc ^= hexin_crc64_load( p );
+    return table[15][ crc >> 56 ]           ^ table[14][ ( crc >> 48 ) & 0xFF ] ^ table[13][ ( crc >> 40 ) & 0xFF ] ^ table[12][ ( crc >> 32 ) & 0xFF ]
+         ^ table[11][ ( crc >> 24 ) & 0xFF ] ^ table[10][ ( crc >> 16 ) & 0xFF ] ^ table[9][  ( crc >> 8  ) & 0xFF ] ^ table[8][  crc & 0xFF ]
+         ^ table[7][ p[8]  ] ^ table[6][ p[9]  ] ^ table[5][ p[10] ] ^ table[4][ p[11] ]
+         ^ table[3][ p[12] ] ^ table[2][ p[13] ] ^ table[1][ p[14] ] ^ table[0][ p[15] ];
+}
+
+/*
+ * Slicing-by-16 over the bulk of the buffer, one slicing-by-8 step and the byte loop for the tail.
+ */
+static unsigned long long hexin_crc64_compute_slicing( unsigned long long crc, const unsigned char *pSrc, size_t len, const struct _hexin_crc64 *param )
 {
-    unsigned int i = 0;
-    unsigned long long result = 0;
-    unsigned long long crc  = ( init << ( HEXIN_CRC64_WIDTH - param->width ) );
+    size_t        i = 0;
+    unsigned char buffer[MAX_SLICING_ARRAY];
+    const unsigned long long (*table)[MAX_TABLE_ARRAY] = param->table;
 
-    if ( param->is_initial == FALSE ) {
-        param->poly = ( param->poly << ( HEXIN_CRC64_WIDTH - param->width ) );
-        param->is_initial = hexin_crc64_compute_init_table( param );
+    for ( ; len >= 16; len -= 16, pSrc += 16 ) {
+        if ( HEXIN_REFIN_IS_TRUE( param ) ) {
+            for ( i=0; i<16; i++ ) {
+                buffer[i] = __hexin_reverse8( pSrc[i] );
+            }
+            crc = hexin_crc64_compute_slicing16( crc, buffer, table );
+        } else {
+            crc = hexin_crc64_compute_slicing16( crc, pSrc, table );
+        }
     }
 
-    /* Fixed Issues #4 #8 */
-    if ( HEXIN_REFOUT_IS_TRUE( param ) && ( HEXIN_GRADUAL_CALCULATE_IS_TRUE( param ) ) ) { 
-        crc = hexin_reverse64( init );
+    if ( len >= 8 ) {
+        if ( HEXIN_REFIN_IS_TRUE( param ) ) {
+            for ( i=0; i<8; i++ ) {
+                buffer[i] = __hexin_reverse8( pSrc[i] );
+            }
+            crc = hexin_crc64_compute_slicing8( crc, buffer, table );
+        } else {
+            crc = hexin_crc64_compute_slicing8( crc, pSrc, table );
+        }
+        len  -= 8;
+        pSrc += 8;
     }
 
     /* Fixed Issues #8 */
@@ -161,11 +230,222 @@ unsigned long long hexin_crc64_compute( const unsigned char *pSrc, unsigned int
         }
     }
 
-    /* Fixed Issues #8 */
+    return crc;
+}
+
+static unsigned long long hexin_crc64_load_reflected( const unsigned char *p )
+{
+    return ( ( unsigned long long )p[7] << 56 ) | ( ( unsigned long long )p[6] << 48 )
+         | ( ( unsigned long long )p[5] << 40 ) | ( ( unsigned long long )p[4] << 32 )
+         | ( ( unsigned long long )p[3] << 24 ) | ( ( unsigned long long )p[2] << 16 )
+         | ( ( unsigned long long )p[1] << 8  ) | ( ( unsigned long long )p[0] );
+}
+
+static unsigned long long hexin_crc64_compute_slicing8_reflected( unsigned long long crc, const unsigned char *p, const unsigned long long (*table)[MAX_TABLE_ARRAY] )
+{
+    crc ^= hexin_crc64_load_reflected( p );
+    return table[7][ crc & 0xFF ]          ^ table[6][ ( crc >> 8  ) & 0xFF ] ^ table[5][ ( crc >> 16 ) & 0xFF ] ^ table[4][ ( crc >> 24 ) & 0xFF ]
+         ^ table[3][ ( crc >> 32 ) & 0xFF ] ^ table[2][ ( crc >> 40 ) & 0xFF ] ^ table[1][ ( crc >> 48 ) & 0xFF ] ^ table[0][ crc >> 56 ];
+}
+
+static unsigned long long hexin_crc64_compute_slicing16_reflected( unsigned long long crc, const unsigned char *p, const unsigned long long (*table)[MAX_TABLE_ARRAY] )
+{
+    crc ^= hexin_crc64_load_reflected( p );
+    return table[15][ crc & 0xFF ]          ^ table[14][ ( crc >> 8  ) & 0xFF ] ^ table[13][ ( crc >> 16 ) & 0xFF ] ^ table[12][ ( crc >> 24 ) & 0xFF ]
+         ^ table[11][ ( crc >> 32 ) & 0xFF ] ^ table[10][ ( crc >> 40 ) & 0xFF ] ^ table[9][  ( crc >> 48 ) & 0xFF ] ^ table[8][  crc >> 56 ]
+         ^ table[7][ p[8]  ] ^ table[6][ p[9]  ] ^ table[5][ p[10] ] ^ table[4][ p[11] ]
+         ^ table[3][ p[12] ] ^ table[2][ p[13] ] ^ table[1][ p[14] ] ^ table[0][ p[15] ];
+}
+
+/*
+ * Right-shifting register over the reflected tables : the input bytes are used as they are.
+ */
+static unsigned long long hexin_crc64_compute_slicing_reflected( unsigned long long crc, const unsigned char *pSrc, size_t len, const struct _hexin_crc64 *param )
+{
+    size_t i = 0;
+    const unsigned long long (*table)[MAX_TABLE_ARRAY] = param->table;
+
+    for ( ; len >= 16; len -= 16, pSrc += 16 ) {
+        crc = hexin_crc64_compute_slicing16_reflected( crc, pSrc, table );
+    }
+
+    if ( len >= 8 ) {
+        crc   = hexin_crc64_compute_slicing8_reflected( crc, pSrc, table );
+        len  -= 8;
+        pSrc += 8;
+    }
+
+    for ( i=0; i<len; i++ ) {
+        crc = ( crc >> 8 ) ^ table[0][ ( crc ^ pSrc[i] ) & 0xFF ];
+    }
+
+    return crc;
+}
+
+/*
+ * Carry-less multiplication folding over the 16-byte aligned bulk, when the CPU supports PCLMULQDQ.
+ */
+static unsigned long long hexin_crc64_compute_clmul( unsigned long long crc, const unsigned char *pSrc, size_t len, const struct _hexin_crc64 *param )
+{
+    if ( HEXIN_REFIN_IS_TRUE( param ) ) {
+        return hexin_reverse64( hexin_clmul_compute( param->clmul, hexin_reverse64( crc ), pSrc, len, TRUE ) );
+    }
+    return hexin_clmul_compute( param->clmul, crc, pSrc, len, FALSE );
+}
+
+/*
+ * The register of a new calculation, or of a gradual one ( is_gradual, init = crc ^ xorout ).
+ */
+unsigned long long hexin_crc64_compute_begin( const struct _hexin_crc64 *param, unsigned long long init )
+{
+    if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
+        return HEXIN_GRADUAL_CALCULATE_IS_TRUE( param ) ? init : hexin_reverse64( init << ( HEXIN_CRC64_WIDTH - param->width ) );
+    }
+
+    /* Fixed Issues #4 #8 */
+    if ( HEXIN_REFOUT_IS_TRUE( param ) && ( HEXIN_GRADUAL_CALCULATE_IS_TRUE( param ) ) ) {
+        return hexin_reverse64( init );
+    }
+    return ( init << ( HEXIN_CRC64_WIDTH - param->width ) );
+}
+
+/*
+ * Feed the register, no fix-up between two calls.
+ */
+unsigned long long hexin_crc64_compute_update( const struct _hexin_crc64 *param, unsigned long long crc, const unsigned char *pSrc, size_t len )
+{
+    if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
+        if ( ( len >= HEXIN_CLMUL_MIN_LENGTH ) && hexin_clmul_is_supported() ) {
+            crc   = hexin_clmul_compute( param->clmul, crc, pSrc, len & ~( size_t )15, TRUE );
+            pSrc += len & ~( size_t )15;
+            len  &= 15U;
+        }
+        return hexin_crc64_compute_slicing_reflected( crc, pSrc, len, param );
+    }
+
+    if ( ( len >= HEXIN_CLMUL_MIN_LENGTH ) && hexin_clmul_is_supported() ) {
+        crc   = hexin_crc64_compute_clmul( crc, pSrc, len & ~( size_t )15, param );
+        pSrc += len & ~( size_t )15;
+        len  &= 15U;
+    }
+    return hexin_crc64_compute_slicing( crc, pSrc, len, param );
+}
+
+/*
+ * The CRC of the register : refout and xorout.
+ */
+unsigned long long hexin_crc64_compute_end( const struct _hexin_crc64 *param, unsigned long long crc )
+{
+    if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
+        return ( crc ^ param->xorout );
+    }
+
+    /* Fixed Issues #8 : the reversed register is right-aligned already, whatever the width. */
     if ( HEXIN_REFOUT_IS_TRUE( param ) ) {
-        crc = hexin_reverse64( crc );
+        return ( hexin_reverse64( crc ) ^ param->xorout );
+    }
+    return ( ( crc >> ( HEXIN_CRC64_WIDTH - param->width ) ) ^ param->xorout );
+}
+
+unsigned long long hexin_crc64_compute( const unsigned char *pSrc, size_t len, const struct _hexin_crc64 *param, unsigned long long init )
+{
+    unsigned long long crc = hexin_crc64_compute_begin( param, init );
+
+    crc = hexin_crc64_compute_update( param, crc, pSrc, len );
+    return hexin_crc64_compute_end( param, crc );
+}
+
+static unsigned long long hexin_crc64_compute_chunk( const void *param, const unsigned char *pSrc, size_t len, unsigned long long init )
+{
+    return hexin_crc64_compute( pSrc, len, ( const struct _hexin_crc64 * )param, ( unsigned long long )init );
+}
+
+/*
+ * Split the buffer over threads ( 0 : every CPU ), the result is the same as hexin_crc64_compute().
+ */
+unsigned long long hexin_crc64_compute_parallel( const unsigned char *pSrc, size_t len, const struct _hexin_crc64 *param, unsigned long long init, unsigned int threads )
+{
+    struct _hexin_crc64 rest = *param;
+    struct _hexin_parallel job = { .compute = hexin_crc64_compute_chunk,
+                                   .first   = param,
+                                   .rest    = &rest,
+                                   .combine = param->combine,
+                                   .init    = init,
+                                   .reinit  = param->init,
+                                   .width   = param->width,
+                                   .poly    = param->poly,
+                                   .refout  = param->refout };
+
+    rest.is_gradual = FALSE;
+    return ( unsigned long long )hexin_parallel_compute( &job, pSrc, len, threads );
+}
+
+/*
+ * CRC( A || B ) from CRC( A ), CRC( B ) and len( B ), O( log( len_b ) ).
+ */
+unsigned long long hexin_crc64_combine( const struct _hexin_crc64 *param, unsigned long long crc_a, unsigned long long crc_b, unsigned long long len_b )
+{
+    struct _hexin_crc64 local = *param;
+    struct _hexin_combine combine;
+    unsigned long long empty = 0;
+
+    local.is_gradual = FALSE;
+    empty = hexin_crc64_compute( ( const unsigned char * )"", 0, &local, local.init );
+
+    if ( param->combine == NULL ) {
+        hexin_combine_init( &combine, param->width, param->poly );
     }
+    return ( unsigned long long )hexin_combine( ( param->combine != NULL ) ? param->combine : &combine, param->refout, crc_a, crc_b, len_b, empty );
+}
 
-    result = ( crc >> ( HEXIN_CRC64_WIDTH - param->width ) );
-	return ( result ^ param->xorout ); 
+/*
+ * CRC( A || len zero bytes ) from CRC( A ), O( log( len ) ).
+ */
+unsigned long long hexin_crc64_extend_zeros( const struct _hexin_crc64 *param, unsigned long long crc, unsigned long long len )
+{
+    struct _hexin_combine combine;
+
+    if ( param->combine == NULL ) {
+        hexin_combine_init( &combine, param->width, param->poly );
+    }
+    return ( unsigned long long )hexin_combine_zeros( ( param->combine != NULL ) ? param->combine : &combine, param->refout, crc, len, param->xorout );
+}
+
+/*
+ * CRC( A || count copies of block ) from CRC( A ), one pass over the block and O( log( count ) ).
+ */
+unsigned long long hexin_crc64_extend_repeat( const struct _hexin_crc64 *param, unsigned long long crc, const unsigned char *pBlock, size_t len, unsigned long long count )
+{
+    struct _hexin_crc64 local = *param;
+    struct _hexin_combine combine;
+    unsigned long long empty = 0, block = 0;
+
+    local.is_gradual = FALSE;
+    empty = hexin_crc64_compute( ( const unsigned char * )"", 0, &local, local.init );
+    block = hexin_crc64_compute( pBlock, len, &local, local.init );
+
+    if ( param->combine == NULL ) {
+        hexin_combine_init( &combine, param->width, param->poly );
+    }
+    return ( unsigned long long )hexin_combine_repeat( ( param->combine != NULL ) ? param->combine : &combine, param->refout, crc, block, len, count, empty );
+}
+
+/*
+ * CRC( A ) after len bytes of A, followed by len_after bytes, were rewritten from pOld to pNew, O( len + log( len_after ) ).
+ */
+unsigned long long hexin_crc64_update_range( const struct _hexin_crc64 *param, unsigned long long crc, const unsigned char *pOld, const unsigned char *pNew,
+                                      size_t len, unsigned long long len_after )
+{
+    struct _hexin_crc64 local = *param;
+    struct _hexin_combine combine;
+    unsigned long long crc_old = 0, crc_new = 0;
+
+    local.is_gradual = FALSE;
+    crc_old = hexin_crc64_compute( pOld, len, &local, local.init );
+    crc_new = hexin_crc64_compute( pNew, len, &local, local.init );
+
+    if ( param->combine == NULL ) {
+        hexin_combine_init( &combine, param->width, param->poly );
+    }
+    return ( unsigned long long )hexin_combine_patch( ( param->combine != NULL ) ? param->combine : &combine, param->refout, crc, crc_old, crc_new, len_after );
 }
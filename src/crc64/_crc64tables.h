@@ -19,6 +19,9 @@
 #ifndef __CRC64_TABLES_H__
 #define __CRC64_TABLES_H__
 
+#include "_clmulfold.h"
+#include "_parallel.h"
+
 #ifndef TRUE
 #define                 TRUE                                    1
 #endif
@@ -31,6 +34,10 @@
 #define                 MAX_TABLE_ARRAY                         256
 #endif
 
+#ifndef MAX_SLICING_ARRAY
+#define                 MAX_SLICING_ARRAY                       16      /* Slicing-by-16 (table[0] is the classic table) */
+#endif
+
 #define                 HEXIN_CRC64_WIDTH                       64
 
 #define                 HEXIN_POLYNOMIAL_IS_HIGH(x)             ( x & 0x8000000000000000L )
@@ -38,6 +45,9 @@
 #define                 HEXIN_REFOUT_IS_TRUE(x)                 ( x->refout == TRUE )
 #define                 HEXIN_REFIN_REFOUT_IS_TRUE(x)           ( ( x->refin == TRUE ) && ( x->refout == TRUE ) )
 #define                 HEXIN_GRADUAL_CALCULATE_IS_TRUE(x)      ( x->is_gradual == 2 )
+#define                 HEXIN_TABLE_IS_NORMAL                   1       /* is_initial : MSB-first table */
+#define                 HEXIN_TABLE_IS_REFLECTED                2       /* is_initial : LSB-first table ( refin == refout == TRUE ) */
+#define                 HEXIN_TABLE_TYPE(x)                     ( HEXIN_REFIN_REFOUT_IS_TRUE((x)) ? HEXIN_TABLE_IS_REFLECTED : HEXIN_TABLE_IS_NORMAL )
 
 #define		            CRC64_POLYNOMIAL_ECMA182                0x42F0E1EBA9EA3693L
 
@@ -51,8 +61,9 @@ struct _hexin_crc64 {
     unsigned int  refin;
     unsigned int  refout;
     unsigned long long  xorout;
-    unsigned long long  result;
-    unsigned long long  table[MAX_TABLE_ARRAY];
+    const unsigned long long (*table)[MAX_TABLE_ARRAY];        /* static const presets, see _crc64presets.h */
+    const struct _hexin_clmul *clmul;
+    const struct _hexin_combine *combine;                      /* x^( 8 * 2^k ) mod P(x), see _combine.h */
 };
 
 
@@ -61,6 +72,15 @@ unsigned long long hexin_reverse64( unsigned long long data );
 unsigned char hexin_crc64_init_table_poly_is_high( unsigned long long polynomial, unsigned long long *table );
 unsigned char hexin_crc64_init_table_poly_is_low(  unsigned long long polynomial, unsigned long long *table );
 
-unsigned long long hexin_crc64_compute( const unsigned char *pSrc, unsigned int len, struct _hexin_crc64 *param, unsigned long long init );
+unsigned int hexin_crc64_compute_init_table( struct _hexin_crc64 *param, unsigned long long (*table)[MAX_TABLE_ARRAY], struct _hexin_clmul *clmul );
+unsigned long long hexin_crc64_compute_begin(  const struct _hexin_crc64 *param, unsigned long long init );
+unsigned long long hexin_crc64_compute_update( const struct _hexin_crc64 *param, unsigned long long crc, const unsigned char *pSrc, size_t len );
+unsigned long long hexin_crc64_compute_end(    const struct _hexin_crc64 *param, unsigned long long crc );
+unsigned long long hexin_crc64_compute( const unsigned char *pSrc, size_t len, const struct _hexin_crc64 *param, unsigned long long init );
+unsigned long long hexin_crc64_compute_parallel( const unsigned char *pSrc, size_t len, const struct _hexin_crc64 *param, unsigned long long init, unsigned int threads );
+unsigned long long hexin_crc64_combine( const struct _hexin_crc64 *param, unsigned long long crc_a, unsigned long long crc_b, unsigned long long len_b );
+unsigned long long hexin_crc64_extend_zeros(  const struct _hexin_crc64 *param, unsigned long long crc, unsigned long long len );
+unsigned long long hexin_crc64_extend_repeat( const struct _hexin_crc64 *param, unsigned long long crc, const unsigned char *pBlock, size_t len, unsigned long long count );
+unsigned long long hexin_crc64_update_range(  const struct _hexin_crc64 *param, unsigned long long crc, const unsigned char *pOld, const unsigned char *pNew, size_t len, unsigned long long len_after );
 
 #endif //__CRC64_TABLES_H__
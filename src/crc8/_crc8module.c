@@ -35,34 +35,42 @@
 
 #define PY_SSIZE_T_CLEAN
 #include <Python.h>
+#include <string.h>
 #include "_crc8tables.h"
-
-static unsigned char hexin_PyArg_ParseTuple( PyObject *self, PyObject *args,
+#include "_crc8presets.h"
+#include "_hasher.h"
+#include "_batch.h"
+#include "_file.h"
+#include "_multi.h"
+#include "_fastcall.h"
+#include "_hacker.h"
+
+static unsigned char hexin_PyArg_ParseTuple( PyObject *self, HEXIN_FASTCALL_PARAMS,
                                              unsigned char init,
                                              unsigned char (*function)( const unsigned char *,
-                                                                        unsigned int,
+                                                                        size_t,
                                                                         unsigned char ),
                                              unsigned char *result )
 {
+    static const char *const kwlist[] = { "data", "init", NULL };
     Py_buffer data = { NULL, NULL };
+    PyObject *values[2];
+    unsigned long long value = init;
 
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTuple( args, "y*|B", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
-    }
-#else
-    if ( !PyArg_ParseTuple( args, "s*|B", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
+    if ( ( hexin_fastcall_parse( HEXIN_FASTCALL_ARGS, kwlist, 1, 2, values ) < 0 )
+      || ( ( values[1] != NULL ) && ( hexin_fastcall_mask( values[1], &value ) < 0 ) )
+      || ( hexin_fastcall_buffer( values[0], &data ) < 0 ) ) {
         return FALSE;
     }
-#endif /* PY_MAJOR_VERSION */
+    init = ( unsigned char )value;
 
-    *result = (* function)( (const unsigned char *)data.buf, (unsigned int)data.len, init );
+    if ( ( size_t )data.len < hexin_gil_threshold() ) {
+        *result = (* function)( (const unsigned char *)data.buf, (size_t)data.len, init );
+    } else {
+        Py_BEGIN_ALLOW_THREADS
+        *result = (* function)( (const unsigned char *)data.buf, (size_t)data.len, init );
+        Py_END_ALLOW_THREADS
+    }
 
     if ( data.obj )
        PyBuffer_Release( &data );
@@ -70,159 +78,176 @@ static unsigned char hexin_PyArg_ParseTuple( PyObject *self, PyObject *args,
     return TRUE;
 }
 
-static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, PyObject *args, struct _hexin_crc8 *param )
+static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, HEXIN_FASTCALL_PARAMS, const struct _hexin_crc8 *preset, unsigned char *result )
 {
+    struct _hexin_crc8 local = *preset;       /* Per-call state, the preset is shared by every thread */
+    struct _hexin_crc8 *param = &local;
     Py_buffer data = { NULL, NULL };
-    unsigned char init = param->init;
+    unsigned long long value = param->init;     /* Fixed Issues #4  */
+    unsigned int threads = 1;
+    int is_gradual = hexin_fastcall_preset( HEXIN_FASTCALL_ARGS, &data, &value, &threads );
+    unsigned char init = ( unsigned char )value;
 
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTuple( args, "y*|B", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
-    }
-#else
-    if ( !PyArg_ParseTuple( args, "s*|B", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
+    if ( is_gradual < 0 ) {
         return FALSE;
     }
-#endif /* PY_MAJOR_VERSION */
 
     /* Fixed Issues #4  */
-    param->is_gradual = ( unsigned int )PyTuple_Size( args );   // Fixed warning C4244
+    param->is_gradual = ( unsigned int )is_gradual;
     if ( HEXIN_GRADUAL_CALCULATE_IS_TRUE( param ) ) {
         init = ( init ^ param->xorout );
     }
-    
-    param->result = hexin_crc8_compute( (const unsigned char *)data.buf, (unsigned int)data.len, param, init );
 
-    if ( data.obj )
-       PyBuffer_Release( &data );
+    if ( hexin_parallel_threads( ( size_t )data.len, threads ) > 1 ) {
+        Py_BEGIN_ALLOW_THREADS
+        *result = hexin_crc8_compute_parallel( (const unsigned char *)data.buf, (size_t)data.len, param, init, threads );
+        Py_END_ALLOW_THREADS
+    } else if ( ( size_t )data.len < hexin_gil_threshold() ) {
+        *result = hexin_crc8_compute( (const unsigned char *)data.buf, (size_t)data.len, param, init );
+    } else {
+        Py_BEGIN_ALLOW_THREADS
+        *result = hexin_crc8_compute( (const unsigned char *)data.buf, (size_t)data.len, param, init );
+        Py_END_ALLOW_THREADS
+    }
 
+    PyBuffer_Release( &data );
     return TRUE;
 }
 
-static PyObject * _crc8_intel( PyObject *self, PyObject *args )
+static PyObject * _crc8_intel( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
     unsigned char result = 0x00;
     unsigned char init   = 0x00;
  
-    if ( !hexin_PyArg_ParseTuple( self, args, init, hexin_calc_crc8_lrc, ( unsigned char * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( self, HEXIN_FASTCALL_ARGS, init, hexin_calc_crc8_lrc, ( unsigned char * )&result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_bcc( PyObject *self, PyObject *args )
+static PyObject * _crc8_bcc( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
     unsigned char result = 0x00;
     unsigned char init   = 0x00;
  
-    if ( !hexin_PyArg_ParseTuple( self, args, init, hexin_calc_crc8_bcc, ( unsigned char * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( self, HEXIN_FASTCALL_ARGS, init, hexin_calc_crc8_bcc, ( unsigned char * )&result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_lrc( PyObject *self, PyObject *args )
+static PyObject * _crc8_lrc( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
     unsigned char result = 0x00;
     unsigned char init   = 0x00;
  
-    if ( !hexin_PyArg_ParseTuple( self, args, init, hexin_calc_crc8_lrc, ( unsigned char * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( self, HEXIN_FASTCALL_ARGS, init, hexin_calc_crc8_lrc, ( unsigned char * )&result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_maxim( PyObject *self, PyObject *args )
+static const struct _hexin_crc8 crc8_param_maxim = { .is_initial=HEXIN_TABLE_IS_REFLECTED,
+                                               .width  = HEXIN_CRC8_WIDTH,
+                                               .poly   = CRC8_POLYNOMIAL_31,
+                                               .init   = 0x00,
+                                               .refin  = TRUE,
+                                               .refout = TRUE,
+                                               .xorout = 0x00,
+                                               .table  = hexin_crc8_table_31_reflected,
+                                               .clmul  = &hexin_crc8_clmul_31,
+                                               .combine= &hexin_crc8_combine_31 };
+
+static PyObject * _crc8_maxim( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc8 crc8_param_maxim = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC8_WIDTH,
-                                                   .poly   = CRC8_POLYNOMIAL_31,
-                                                   .init   = 0x00,
-                                                   .refin  = TRUE,
-                                                   .refout = TRUE,
-                                                   .xorout = 0x00,
-                                                   .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_maxim ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc8_param_maxim , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_maxim.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_rohc( PyObject *self, PyObject *args )
+static const struct _hexin_crc8 crc8_param_rohc = { .is_initial=HEXIN_TABLE_IS_REFLECTED,
+                                              .width  = HEXIN_CRC8_WIDTH,
+                                              .poly   = CRC8_POLYNOMIAL_07,
+                                              .init   = 0xFF,
+                                              .refin  = TRUE,
+                                              .refout = TRUE,
+                                              .xorout = 0x00,
+                                              .table  = hexin_crc8_table_07_reflected,
+                                              .clmul  = &hexin_crc8_clmul_07,
+                                              .combine= &hexin_crc8_combine_07 };
+
+static PyObject * _crc8_rohc( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc8 crc8_param_rohc = { .is_initial=FALSE,
-                                                  .width  = HEXIN_CRC8_WIDTH,
-                                                  .poly   = CRC8_POLYNOMIAL_07,
-                                                  .init   = 0xFF,
-                                                  .refin  = TRUE,
-                                                  .refout = TRUE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_rohc ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc8_param_rohc , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_rohc.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_itu( PyObject *self, PyObject *args )
+static const struct _hexin_crc8 crc8_param_itu8 = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                              .width  = HEXIN_CRC8_WIDTH,
+                                              .poly   = CRC8_POLYNOMIAL_07,
+                                              .init   = 0x00,
+                                              .refin  = FALSE,
+                                              .refout = FALSE,
+                                              .xorout = 0x55,
+                                              .table  = hexin_crc8_table_07_normal,
+                                              .clmul  = &hexin_crc8_clmul_07,
+                                              .combine= &hexin_crc8_combine_07 };
+
+static PyObject * _crc8_itu( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc8 crc8_param_itu8 = { .is_initial=FALSE,
-                                                  .width  = HEXIN_CRC8_WIDTH,
-                                                  .poly   = CRC8_POLYNOMIAL_07,
-                                                  .init   = 0x00,
-                                                  .refin  = FALSE,
-                                                  .refout = FALSE,
-                                                  .xorout = 0x55,
-                                                  .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_itu8 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc8_param_itu8 , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_itu8.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_crc8( PyObject *self, PyObject *args )
+static const struct _hexin_crc8 crc8_param_crc8 = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                              .width  = HEXIN_CRC8_WIDTH,
+                                              .poly   = CRC8_POLYNOMIAL_07,
+                                              .init   = 0x00,
+                                              .refin  = FALSE,
+                                              .refout = FALSE,
+                                              .xorout = 0x00,
+                                              .table  = hexin_crc8_table_07_normal,
+                                              .clmul  = &hexin_crc8_clmul_07,
+                                              .combine= &hexin_crc8_combine_07 };
+
+static PyObject * _crc8_crc8( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc8 crc8_param_crc8 = { .is_initial=FALSE,
-                                                  .width  = HEXIN_CRC8_WIDTH,
-                                                  .poly   = CRC8_POLYNOMIAL_07,
-                                                  .init   = 0x00,
-                                                  .refin  = FALSE,
-                                                  .refout = FALSE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_crc8 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc8_param_crc8 , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_crc8.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_sum( PyObject *self, PyObject *args )
+static PyObject * _crc8_sum( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
     unsigned char result = 0x00;
     unsigned char init   = 0x00;
  
-    if ( !hexin_PyArg_ParseTuple( self, args, init, hexin_calc_crc8_sum, ( unsigned char * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( self, HEXIN_FASTCALL_ARGS, init, hexin_calc_crc8_sum, ( unsigned char * )&result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", result );
+    return PyLong_FromUnsignedLong( result );
 }
 
 static PyObject * _crc8_table( PyObject *self, PyObject *args )
@@ -248,339 +273,409 @@ static PyObject * _crc8_table( PyObject *self, PyObject *args )
     }
 
     for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
-        PyList_SetItem( plist, i, Py_BuildValue( "B", table[i] ) );
+        PyList_SetItem( plist, i, PyLong_FromUnsignedLong( table[i] ) );
     }
 
     return plist;
 }
 
-static PyObject * _crc8_hacker( PyObject *self, PyObject *args, PyObject* kws )
+static unsigned int hexin_crc8_hacker_init( void *param, void *table, struct _hexin_clmul *clmul )
 {
-    unsigned int reinit = FALSE;
-    Py_buffer data = { NULL, NULL };
-    static struct _hexin_crc8 crc8_param_hacker = { .is_initial = FALSE,
-                                                    .is_gradual = FALSE,
-                                                    .width  = HEXIN_CRC8_WIDTH,
-                                                    .poly   = CRC8_POLYNOMIAL_31,
-                                                    .init   = 0xFF,
-                                                    .refin  = FALSE,
-                                                    .refout = FALSE,
-                                                    .xorout = 0x00,
-                                                    .result = 0 };
+    return hexin_crc8_compute_init_table( ( struct _hexin_crc8 * )param, ( unsigned char (*)[MAX_TABLE_ARRAY] )table, clmul );
+}
 
-    static char* kwlist[]={ "data", "poly", "init", "xorout", "refin", "refout", "reinit", NULL };
+static struct _hexin_hacker_cache crc8_hacker_cache = { NULL, sizeof( unsigned char [MAX_SLICING_ARRAY][MAX_TABLE_ARRAY] ), hexin_crc8_hacker_init, 0 };
 
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTupleAndKeywords( args, kws, "y*|BBBppp", kwlist, &data,
-                                                                       &crc8_param_hacker.poly,
-                                                                       &crc8_param_hacker.init,
-                                                                       &crc8_param_hacker.xorout,
-                                                                       &crc8_param_hacker.refin,
-                                                                       &crc8_param_hacker.refout,
-                                                                       &reinit ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
+static PyObject * _crc8_hacker( PyObject *self, HEXIN_FASTCALL_PARAMS )
+{
+    unsigned int reinit = FALSE;
+    unsigned char result = 0;
+    struct _hexin_hacker_entry *entry = NULL;
+    Py_buffer data = { NULL, NULL };
+    struct _hexin_crc8 crc8_param_hacker = { .is_initial = FALSE,
+                                             .is_gradual = FALSE,
+                                             .width  = HEXIN_CRC8_WIDTH,
+                                             .poly   = CRC8_POLYNOMIAL_31,
+                                             .init   = 0xFF,
+                                             .refin  = FALSE,
+                                             .refout = FALSE,
+                                             .xorout = 0x00 };
+
+    static const char *const kwlist[] = { "data", "poly", "init", "xorout", "refin", "refout", "reinit", NULL };
+    PyObject *values[7];
+    unsigned long long poly = crc8_param_hacker.poly, init = crc8_param_hacker.init, xorout = crc8_param_hacker.xorout;
+    unsigned int refin = crc8_param_hacker.refin, refout = crc8_param_hacker.refout;
+
+    if ( ( hexin_fastcall_parse( HEXIN_FASTCALL_ARGS, kwlist, 1, 7, values ) < 0 )
+      || ( ( values[1] != NULL ) && ( hexin_fastcall_mask( values[1], &poly   ) < 0 ) )
+      || ( ( values[2] != NULL ) && ( hexin_fastcall_mask( values[2], &init   ) < 0 ) )
+      || ( ( values[3] != NULL ) && ( hexin_fastcall_mask( values[3], &xorout ) < 0 ) )
+      || ( ( values[4] != NULL ) && ( hexin_fastcall_bool( values[4], &refin  ) < 0 ) )
+      || ( ( values[5] != NULL ) && ( hexin_fastcall_bool( values[5], &refout ) < 0 ) )
+      || ( ( values[6] != NULL ) && ( hexin_fastcall_bool( values[6], &reinit ) < 0 ) )
+      || ( hexin_fastcall_buffer( values[0], &data ) < 0 ) ) {
         return NULL;
     }
-#else
-    if ( !PyArg_ParseTupleAndKeywords( args, kws, "s*|BBBIII", kwlist, &data,
-                                                                       &crc8_param_hacker.poly,
-                                                                       &crc8_param_hacker.init,
-                                                                       &crc8_param_hacker.xorout,
-                                                                       &crc8_param_hacker.refin,
-                                                                       &crc8_param_hacker.refout,
-                                                                       &reinit ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
+    crc8_param_hacker.poly   = ( unsigned char )poly;
+    crc8_param_hacker.init   = ( unsigned char )init;
+    crc8_param_hacker.xorout = ( unsigned char )xorout;
+    crc8_param_hacker.refin  = refin;
+    crc8_param_hacker.refout = refout;
+
+    /* The tables of the last HEXIN_HACKER_CACHE_SIZE ( poly, orientation ) are kept, reinit=True builds them again. */
+    entry = hexin_hacker_acquire( &crc8_hacker_cache, &crc8_param_hacker, crc8_param_hacker.poly, HEXIN_TABLE_TYPE( &crc8_param_hacker ), reinit );
+    if ( entry == NULL ) {
+        PyBuffer_Release( &data );
         return NULL;
     }
-#endif /* PY_MAJOR_VERSION */
+    crc8_param_hacker.is_initial = entry->type;
+    crc8_param_hacker.table      = entry->table;
+    crc8_param_hacker.clmul      = &entry->clmul;
 
-    crc8_param_hacker.is_initial = ( reinit == FALSE ) ? crc8_param_hacker.is_initial : FALSE;
-    crc8_param_hacker.result = hexin_crc8_compute( (const unsigned char *)data.buf, (unsigned int)data.len, &crc8_param_hacker, crc8_param_hacker.init );
+    if ( ( size_t )data.len < hexin_gil_threshold() ) {
+        result = hexin_crc8_compute( (const unsigned char *)data.buf, (size_t)data.len, &crc8_param_hacker, crc8_param_hacker.init );
+    } else {
+        Py_BEGIN_ALLOW_THREADS
+        result = hexin_crc8_compute( (const unsigned char *)data.buf, (size_t)data.len, &crc8_param_hacker, crc8_param_hacker.init );
+        Py_END_ALLOW_THREADS
+    }
 
-    if ( data.obj )
-       PyBuffer_Release( &data );
+    hexin_hacker_release( &crc8_hacker_cache, entry );
+    PyBuffer_Release( &data );
 
-    return Py_BuildValue( "B", crc8_param_hacker.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_fletcher( PyObject *self, PyObject *args )
+static PyObject * _crc8_fletcher( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
     unsigned char result   = 0x00;
     unsigned char reserved = 0x00;
  
-    if ( !hexin_PyArg_ParseTuple( self, args, reserved, hexin_calc_crc8_fletcher, ( unsigned char * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( self, HEXIN_FASTCALL_ARGS, reserved, hexin_calc_crc8_fletcher, ( unsigned char * )&result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_autosar8( PyObject *self, PyObject *args )
+static const struct _hexin_crc8 crc8_param_autosar8 = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                  .width  = HEXIN_CRC8_WIDTH,
+                                                  .poly   = CRC8_POLYNOMIAL_2F,
+                                                  .init   = 0xFF,
+                                                  .refin  = FALSE,
+                                                  .refout = FALSE,
+                                                  .xorout = 0xFF,
+                                                  .table  = hexin_crc8_table_2F_normal,
+                                                  .clmul  = &hexin_crc8_clmul_2F,
+                                                  .combine= &hexin_crc8_combine_2F };
+
+static PyObject * _crc8_autosar8( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc8 crc8_param_autosar8 = { .is_initial=FALSE,
-                                                      .width  = HEXIN_CRC8_WIDTH,
-                                                      .poly   = CRC8_POLYNOMIAL_2F,
-                                                      .init   = 0xFF,
-                                                      .refin  = FALSE,
-                                                      .refout = FALSE,
-                                                      .xorout = 0xFF,
-                                                      .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_autosar8 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc8_param_autosar8 , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_autosar8.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_lte8( PyObject *self, PyObject *args )
+static const struct _hexin_crc8 crc8_param_lte8 = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                              .width  = HEXIN_CRC8_WIDTH,
+                                              .poly   = CRC8_POLYNOMIAL_9B,
+                                              .init   = 0x00,
+                                              .refin  = FALSE,
+                                              .refout = FALSE,
+                                              .xorout = 0x00,
+                                              .table  = hexin_crc8_table_9B_normal,
+                                              .clmul  = &hexin_crc8_clmul_9B,
+                                              .combine= &hexin_crc8_combine_9B };
+
+static PyObject * _crc8_lte8( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc8 crc8_param_lte8 = { .is_initial=FALSE,
-                                                  .width  = HEXIN_CRC8_WIDTH,
-                                                  .poly   = CRC8_POLYNOMIAL_9B,
-                                                  .init   = 0x00,
-                                                  .refin  = FALSE,
-                                                  .refout = FALSE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_lte8 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc8_param_lte8 , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_lte8.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_wcdma( PyObject *self, PyObject *args )
+static const struct _hexin_crc8 crc8_param_wcdma = { .is_initial=HEXIN_TABLE_IS_REFLECTED,
+                                               .width  = HEXIN_CRC8_WIDTH,
+                                               .poly   = CRC8_POLYNOMIAL_9B,
+                                               .init   = 0x00,
+                                               .refin  = TRUE,
+                                               .refout = TRUE,
+                                               .xorout = 0x00,
+                                               .table  = hexin_crc8_table_9B_reflected,
+                                               .clmul  = &hexin_crc8_clmul_9B,
+                                               .combine= &hexin_crc8_combine_9B };
+
+static PyObject * _crc8_wcdma( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc8 crc8_param_wcdma = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC8_WIDTH,
-                                                   .poly   = CRC8_POLYNOMIAL_9B,
-                                                   .init   = 0x00,
-                                                   .refin  = TRUE,
-                                                   .refout = TRUE,
-                                                   .xorout = 0x00,
-                                                   .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_wcdma ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc8_param_wcdma , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_wcdma.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_sae_j1850( PyObject *self, PyObject *args )
+static const struct _hexin_crc8 crc8_param_j1850 = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                               .width  = HEXIN_CRC8_WIDTH,
+                                               .poly   = CRC8_POLYNOMIAL_1D,
+                                               .init   = 0xFF,
+                                               .refin  = FALSE,
+                                               .refout = FALSE,
+                                               .xorout = 0xFF,
+                                               .table  = hexin_crc8_table_1D_normal,
+                                               .clmul  = &hexin_crc8_clmul_1D,
+                                               .combine= &hexin_crc8_combine_1D };
+
+static PyObject * _crc8_sae_j1850( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc8 crc8_param_j1850 = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC8_WIDTH,
-                                                   .poly   = CRC8_POLYNOMIAL_1D,
-                                                   .init   = 0xFF,
-                                                   .refin  = FALSE,
-                                                   .refout = FALSE,
-                                                   .xorout = 0xFF,
-                                                   .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_j1850 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc8_param_j1850 , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_j1850.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_icode( PyObject *self, PyObject *args )
+static const struct _hexin_crc8 crc8_param_icode = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                               .width  = HEXIN_CRC8_WIDTH,
+                                               .poly   = CRC8_POLYNOMIAL_1D,
+                                               .init   = 0xFD,
+                                               .refin  = FALSE,
+                                               .refout = FALSE,
+                                               .xorout = 0x00,
+                                               .table  = hexin_crc8_table_1D_normal,
+                                               .clmul  = &hexin_crc8_clmul_1D,
+                                               .combine= &hexin_crc8_combine_1D };
+
+static PyObject * _crc8_icode( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc8 crc8_param_icode = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC8_WIDTH,
-                                                   .poly   = CRC8_POLYNOMIAL_1D,
-                                                   .init   = 0xFD,
-                                                   .refin  = FALSE,
-                                                   .refout = FALSE,
-                                                   .xorout = 0x00,
-                                                   .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_icode ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc8_param_icode , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_icode.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_gsm8_a( PyObject *self, PyObject *args )
+static const struct _hexin_crc8 crc8_param_gsm8a = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                               .width  = HEXIN_CRC8_WIDTH,
+                                               .poly   = CRC8_POLYNOMIAL_1D,
+                                               .init   = 0x00,
+                                               .refin  = FALSE,
+                                               .refout = FALSE,
+                                               .xorout = 0x00,
+                                               .table  = hexin_crc8_table_1D_normal,
+                                               .clmul  = &hexin_crc8_clmul_1D,
+                                               .combine= &hexin_crc8_combine_1D };
+
+static PyObject * _crc8_gsm8_a( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc8 crc8_param_gsm8a = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC8_WIDTH,
-                                                   .poly   = CRC8_POLYNOMIAL_1D,
-                                                   .init   = 0x00,
-                                                   .refin  = FALSE,
-                                                   .refout = FALSE,
-                                                   .xorout = 0x00,
-                                                   .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_gsm8a ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc8_param_gsm8a , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_gsm8a.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_gsm8_b( PyObject *self, PyObject *args )
+static const struct _hexin_crc8 crc8_param_gsm8b = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                               .width  = HEXIN_CRC8_WIDTH,
+                                               .poly   = CRC8_POLYNOMIAL_49,
+                                               .init   = 0x00,
+                                               .refin  = FALSE,
+                                               .refout = FALSE,
+                                               .xorout = 0xFF,
+                                               .table  = hexin_crc8_table_49_normal,
+                                               .clmul  = &hexin_crc8_clmul_49,
+                                               .combine= &hexin_crc8_combine_49 };
+
+static PyObject * _crc8_gsm8_b( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc8 crc8_param_gsm8b = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC8_WIDTH,
-                                                   .poly   = CRC8_POLYNOMIAL_49,
-                                                   .init   = 0x00,
-                                                   .refin  = FALSE,
-                                                   .refout = FALSE,
-                                                   .xorout = 0xFF,
-                                                   .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_gsm8b ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc8_param_gsm8b , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_gsm8b.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_nrsc_5( PyObject *self, PyObject *args )
+static const struct _hexin_crc8 crc8_param_nrsc5 = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                               .width  = HEXIN_CRC8_WIDTH,
+                                               .poly   = CRC8_POLYNOMIAL_31,
+                                               .init   = 0xFF,
+                                               .refin  = FALSE,
+                                               .refout = FALSE,
+                                               .xorout = 0x00,
+                                               .table  = hexin_crc8_table_31_normal,
+                                               .clmul  = &hexin_crc8_clmul_31,
+                                               .combine= &hexin_crc8_combine_31 };
+
+static PyObject * _crc8_nrsc_5( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc8 crc8_param_nrsc5 = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC8_WIDTH,
-                                                   .poly   = CRC8_POLYNOMIAL_31,
-                                                   .init   = 0xFF,
-                                                   .refin  = FALSE,
-                                                   .refout = FALSE,
-                                                   .xorout = 0x00,
-                                                   .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_nrsc5 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc8_param_nrsc5 , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_nrsc5.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_bluetooth( PyObject *self, PyObject *args )
+static const struct _hexin_crc8 crc8_param_bluetooth = { .is_initial=HEXIN_TABLE_IS_REFLECTED,
+                                                   .width  = HEXIN_CRC8_WIDTH,
+                                                   .poly   = CRC8_POLYNOMIAL_A7,
+                                                   .init   = 0x00,
+                                                   .refin  = TRUE,
+                                                   .refout = TRUE,
+                                                   .xorout = 0x00,
+                                                   .table  = hexin_crc8_table_A7_reflected,
+                                                   .clmul  = &hexin_crc8_clmul_A7,
+                                                   .combine= &hexin_crc8_combine_A7 };
+
+static PyObject * _crc8_bluetooth( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc8 crc8_param_bluetooth = { .is_initial=FALSE,
-                                                       .width  = HEXIN_CRC8_WIDTH,
-                                                       .poly   = CRC8_POLYNOMIAL_A7,
-                                                       .init   = 0x00,
-                                                       .refin  = TRUE,
-                                                       .refout = TRUE,
-                                                       .xorout = 0x00,
-                                                       .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_bluetooth ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc8_param_bluetooth , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_bluetooth.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_dvb_s2( PyObject *self, PyObject *args )
+static const struct _hexin_crc8 crc8_param_dvbs2 = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                               .width  = HEXIN_CRC8_WIDTH,
+                                               .poly   = CRC8_POLYNOMIAL_D5,
+                                               .init   = 0x00,
+                                               .refin  = FALSE,
+                                               .refout = FALSE,
+                                               .xorout = 0x00,
+                                               .table  = hexin_crc8_table_D5_normal,
+                                               .clmul  = &hexin_crc8_clmul_D5,
+                                               .combine= &hexin_crc8_combine_D5 };
+
+static PyObject * _crc8_dvb_s2( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc8 crc8_param_dvbs2 = { .is_initial=FALSE,
-                                                   .width  = HEXIN_CRC8_WIDTH,
-                                                   .poly   = CRC8_POLYNOMIAL_D5,
-                                                   .init   = 0x00,
-                                                   .refin  = FALSE,
-                                                   .refout = FALSE,
-                                                   .xorout = 0x00,
-                                                   .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_dvbs2 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc8_param_dvbs2 , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_dvbs2.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_ebu8( PyObject *self, PyObject *args )
+static const struct _hexin_crc8 crc8_param_ebu8 = { .is_initial=HEXIN_TABLE_IS_REFLECTED,
+                                              .width  = HEXIN_CRC8_WIDTH,
+                                              .poly   = CRC8_POLYNOMIAL_1D,
+                                              .init   = 0xFF,
+                                              .refin  = TRUE,
+                                              .refout = TRUE,
+                                              .xorout = 0x00,
+                                              .table  = hexin_crc8_table_1D_reflected,
+                                              .clmul  = &hexin_crc8_clmul_1D,
+                                              .combine= &hexin_crc8_combine_1D };
+
+static PyObject * _crc8_ebu8( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc8 crc8_param_ebu8 = { .is_initial=FALSE,
-                                                  .width  = HEXIN_CRC8_WIDTH,
-                                                  .poly   = CRC8_POLYNOMIAL_1D,
-                                                  .init   = 0xFF,
-                                                  .refin  = TRUE,
-                                                  .refout = TRUE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_ebu8 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc8_param_ebu8 , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_ebu8.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_darc( PyObject *self, PyObject *args )
+static const struct _hexin_crc8 crc8_param_darc = { .is_initial=HEXIN_TABLE_IS_REFLECTED,
+                                              .width  = HEXIN_CRC8_WIDTH,
+                                              .poly   = CRC8_POLYNOMIAL_39,
+                                              .init   = 0x00,
+                                              .refin  = TRUE,
+                                              .refout = TRUE,
+                                              .xorout = 0x00,
+                                              .table  = hexin_crc8_table_39_reflected,
+                                              .clmul  = &hexin_crc8_clmul_39,
+                                              .combine= &hexin_crc8_combine_39 };
+
+static PyObject * _crc8_darc( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc8 crc8_param_darc = { .is_initial=FALSE,
-                                                  .width  = HEXIN_CRC8_WIDTH,
-                                                  .poly   = CRC8_POLYNOMIAL_39,
-                                                  .init   = 0x00,
-                                                  .refin  = TRUE,
-                                                  .refout = TRUE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_darc ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc8_param_darc , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_darc.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_opensafety8( PyObject *self, PyObject *args )
+static const struct _hexin_crc8 crc8_param_opensafety8 = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                     .width  = HEXIN_CRC8_WIDTH,
+                                                     .poly   = CRC8_POLYNOMIAL_2F,
+                                                     .init   = 0x00,
+                                                     .refin  = FALSE,
+                                                     .refout = FALSE,
+                                                     .xorout = 0x00,
+                                                     .table  = hexin_crc8_table_2F_normal,
+                                                     .clmul  = &hexin_crc8_clmul_2F,
+                                                     .combine= &hexin_crc8_combine_2F };
+
+static PyObject * _crc8_opensafety8( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc8 crc8_param_opensafety8 = { .is_initial=FALSE,
-                                                         .width  = HEXIN_CRC8_WIDTH,
-                                                         .poly   = CRC8_POLYNOMIAL_2F,
-                                                         .init   = 0x00,
-                                                         .refin  = FALSE,
-                                                         .refout = FALSE,
-                                                         .xorout = 0x00,
-                                                         .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_opensafety8 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc8_param_opensafety8 , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_opensafety8.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_mifare_mad( PyObject *self, PyObject *args )
+static const struct _hexin_crc8 crc8_param_mifare_mad = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                    .width  = HEXIN_CRC8_WIDTH,
+                                                    .poly   = CRC8_POLYNOMIAL_1D,
+                                                    .init   = 0xC7,
+                                                    .refin  = FALSE,
+                                                    .refout = FALSE,
+                                                    .xorout = 0x00,
+                                                    .table  = hexin_crc8_table_1D_normal,
+                                                    .clmul  = &hexin_crc8_clmul_1D,
+                                                    .combine= &hexin_crc8_combine_1D };
+
+static PyObject * _crc8_mifare_mad( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crc8 crc8_param_mifare_mad = { .is_initial=FALSE,
-                                                        .width  = HEXIN_CRC8_WIDTH,
-                                                        .poly   = CRC8_POLYNOMIAL_1D,
-                                                        .init   = 0xC7,
-                                                        .refin  = FALSE,
-                                                        .refout = FALSE,
-                                                        .xorout = 0x00,
-                                                        .result = 0 };
+    unsigned char result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc8_param_mifare_mad ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc8_param_mifare_mad , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc8_param_mifare_mad.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_lin( PyObject *self, PyObject *args )
+static PyObject * _crc8_lin( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
     unsigned char result = 0x00;
     unsigned char init   = 0x00;
  
-    if ( !hexin_PyArg_ParseTuple( self, args, init, hexin_calc_crc8_lin, ( unsigned char * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( self, HEXIN_FASTCALL_ARGS, init, hexin_calc_crc8_lin, ( unsigned char * )&result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", result );
+    return PyLong_FromUnsignedLong( result );
 }
 
 static PyObject * _crc8_lin2x( PyObject *self, PyObject *args )
@@ -606,12 +701,12 @@ static PyObject * _crc8_lin2x( PyObject *self, PyObject *args )
     }
 #endif /* PY_MAJOR_VERSION */
 
-    crc = hexin_calc_crc8_lin2x( ( const unsigned char * )data.buf, (unsigned int)data.len, 0 );
+    crc = hexin_calc_crc8_lin2x( ( const unsigned char * )data.buf, (size_t)data.len, 0 );
     pid = hexin_crc8_get_lin2x_pid( (( const unsigned char * )data.buf)[0] );
 
     pDict = PyDict_New();
-    PyDict_SetItem( pDict, Py_BuildValue( "s", "crc" ),  Py_BuildValue( "B", crc ) );
-    PyDict_SetItem( pDict, Py_BuildValue( "s", "pid" ),  Py_BuildValue( "B", pid ) );
+    PyDict_SetItem( pDict, Py_BuildValue( "s", "crc" ),  PyLong_FromUnsignedLong( crc ) );
+    PyDict_SetItem( pDict, Py_BuildValue( "s", "pid" ),  PyLong_FromUnsignedLong( pid ) );
     
     if ( data.obj )
        PyBuffer_Release( &data );
@@ -619,12 +714,12 @@ static PyObject * _crc8_lin2x( PyObject *self, PyObject *args )
     return Py_INCREF( pDict ), pDict;
 }
 
-static PyObject * _crc8_id8( PyObject *self, PyObject *args )
+static PyObject * _crc8_id8( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
     unsigned char result = 0x00;
     unsigned char init   = 0x00;
  
-    if ( !hexin_PyArg_ParseTuple( self, args, init, hexin_calc_crc8_id8, ( unsigned char * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( self, HEXIN_FASTCALL_ARGS, init, hexin_calc_crc8_id8, ( unsigned char * )&result ) ) {
         return NULL;
     }
 
@@ -635,25 +730,25 @@ static PyObject * _crc8_id8( PyObject *self, PyObject *args )
     return Py_BuildValue( "z#", &result, 1 );
 }
 
-static PyObject * _crc8_nmea( PyObject *self, PyObject *args )
+static PyObject * _crc8_nmea( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
     unsigned char result = 0x00;
     unsigned char init   = 0x00;
  
-    if ( !hexin_PyArg_ParseTuple( self, args, init, hexin_calc_crc8_nmea, ( unsigned char * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( self, HEXIN_FASTCALL_ARGS, init, hexin_calc_crc8_nmea, ( unsigned char * )&result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc8_modbus_asc( PyObject *self, PyObject *args )
+static PyObject * _crc8_modbus_asc( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
     unsigned char result = 0x00, tmp = 0x00;
     unsigned char init   = 0x00;
     unsigned char crc[2] = { 0x00, 0x00 };
 
-    if ( !hexin_PyArg_ParseTuple( self, args, init, hexin_calc_modbus_ascii, ( unsigned char * )&result ) ) {
+    if ( !hexin_PyArg_ParseTuple( self, HEXIN_FASTCALL_ARGS, init, hexin_calc_modbus_ascii, ( unsigned char * )&result ) ) {
         return NULL;
     }
 
@@ -665,19 +760,332 @@ static PyObject * _crc8_modbus_asc( PyObject *self, PyObject *args )
     return Py_BuildValue( "y#", crc, 2 );
 }
 
+/* Named presets, the method names of the table below */
+static struct {
+    const char          *name;
+    const struct _hexin_crc8 *param;
+} _crc8_presets[] = {
+    { "maxim8",     &crc8_param_maxim },
+    { "rohc",       &crc8_param_rohc },
+    { "itu8",       &crc8_param_itu8 },
+    { "i432_1",     &crc8_param_itu8 },
+    { "crc8",       &crc8_param_crc8 },
+    { "smbus",      &crc8_param_crc8 },
+    { "autosar8",   &crc8_param_autosar8 },
+    { "lte8",       &crc8_param_lte8 },
+    { "sae_j1850",  &crc8_param_j1850 },
+    { "icode8",     &crc8_param_icode },
+    { "gsm8_a",     &crc8_param_gsm8a },
+    { "gsm8_b",     &crc8_param_gsm8b },
+    { "nrsc_5",     &crc8_param_nrsc5 },
+    { "wcdma8",     &crc8_param_wcdma },
+    { "bluetooth",  &crc8_param_bluetooth },
+    { "dvb_s2",     &crc8_param_dvbs2 },
+    { "ebu8",       &crc8_param_ebu8 },
+    { "tech_3250",  &crc8_param_ebu8 },
+    { "aes8",       &crc8_param_ebu8 },
+    { "darc8",      &crc8_param_darc },
+    { "opensafety8",&crc8_param_opensafety8 },
+    { "mifare_mad", &crc8_param_mifare_mad },
+    { NULL, NULL }
+};
+
+static const struct _hexin_crc8 *hexin_crc8_preset( const char *name )
+{
+    unsigned int i = 0;
+
+    for ( i=0; _crc8_presets[i].name != NULL; i++ ) {
+        if ( 0 == strcmp( _crc8_presets[i].name, name ) ) {
+            return _crc8_presets[i].param;
+        }
+    }
+    return NULL;
+}
+
+static PyObject * _crc8_presets_list( PyObject *self, PyObject *args )
+{
+    unsigned int i = 0;
+    PyObject *names = PyList_New( 0 );
+
+    for ( i=0; ( names != NULL ) && ( _crc8_presets[i].name != NULL ); i++ ) {
+        PyObject *name = Py_BuildValue( "s", _crc8_presets[i].name );
+        if ( ( name == NULL ) || ( PyList_Append( names, name ) < 0 ) ) {
+            Py_XDECREF( name );
+            Py_DECREF( names );
+            return NULL;
+        }
+        Py_DECREF( name );
+    }
+    return names;
+}
+
+static PyObject * _crc8_combine( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    unsigned long long crc_a = 0, crc_b = 0, len_b = 0, mask = 0;
+    const struct _hexin_crc8 *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "sO&O&O&", &name, hexin_PyArg_count, &crc_a, hexin_PyArg_count, &crc_b, hexin_PyArg_count, &len_b ) ) {
+        return NULL;
+    }
+
+    param = hexin_crc8_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+
+    mask = ( param->width >= 64 ) ? ~0ULL : ( ( 1ULL << param->width ) - 1 );
+    if ( ( crc_a | crc_b ) & ~mask ) {
+        PyErr_Format( PyExc_ValueError, "%s is a %u-bit CRC", name, ( unsigned int )param->width );
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLongLong( hexin_crc8_combine( param, ( unsigned char )crc_a, ( unsigned char )crc_b, len_b ) );
+}
+
+static PyObject * _crc8_extend_zeros( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    unsigned long long crc = 0, len = 0, mask = 0;
+    const struct _hexin_crc8 *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "sO&O&", &name, hexin_PyArg_count, &crc, hexin_PyArg_count, &len ) ) {
+        return NULL;
+    }
+
+    param = hexin_crc8_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+
+    mask = ( param->width >= 64 ) ? ~0ULL : ( ( 1ULL << param->width ) - 1 );
+    if ( crc & ~mask ) {
+        PyErr_Format( PyExc_ValueError, "%s is a %u-bit CRC", name, ( unsigned int )param->width );
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLongLong( hexin_crc8_extend_zeros( param, ( unsigned char )crc, len ) );
+}
+
+static PyObject * _crc8_extend_repeat( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    unsigned long long crc = 0, count = 0, mask = 0;
+    const struct _hexin_crc8 *param = NULL;
+    Py_buffer data = { NULL, NULL };
+    unsigned char result = 0;
+
+#if PY_MAJOR_VERSION >= 3
+    if ( !PyArg_ParseTuple( args, "sO&y*O&", &name, hexin_PyArg_count, &crc, &data, hexin_PyArg_count, &count ) ) {
+#else
+    if ( !PyArg_ParseTuple( args, "sO&s*O&", &name, hexin_PyArg_count, &crc, &data, hexin_PyArg_count, &count ) ) {
+#endif /* PY_MAJOR_VERSION */
+        return NULL;
+    }
+
+    param = hexin_crc8_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        PyBuffer_Release( &data );
+        return NULL;
+    }
+
+    mask = ( param->width >= 64 ) ? ~0ULL : ( ( 1ULL << param->width ) - 1 );
+    if ( crc & ~mask ) {
+        PyErr_Format( PyExc_ValueError, "%s is a %u-bit CRC", name, ( unsigned int )param->width );
+        PyBuffer_Release( &data );
+        return NULL;
+    }
+
+    if ( ( size_t )data.len < hexin_gil_threshold() ) {
+        result = hexin_crc8_extend_repeat( param, ( unsigned char )crc, ( const unsigned char * )data.buf, ( size_t )data.len, count );
+    } else {
+        Py_BEGIN_ALLOW_THREADS
+        result = hexin_crc8_extend_repeat( param, ( unsigned char )crc, ( const unsigned char * )data.buf, ( size_t )data.len, count );
+        Py_END_ALLOW_THREADS
+    }
+    PyBuffer_Release( &data );
+    return PyLong_FromUnsignedLongLong( result );
+}
+
+static PyObject * _crc8_update_range( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    unsigned long long crc = 0, offset = 0, total = 0, mask = 0;
+    const struct _hexin_crc8 *param = NULL;
+    Py_buffer before = { NULL, NULL }, after = { NULL, NULL };
+    PyObject *result = NULL;
+
+#if PY_MAJOR_VERSION >= 3
+    if ( !PyArg_ParseTuple( args, "sO&O&y*y*O&", &name, hexin_PyArg_count, &crc, hexin_PyArg_count, &offset, &before, &after, hexin_PyArg_count, &total ) ) {
+#else
+    if ( !PyArg_ParseTuple( args, "sO&O&s*s*O&", &name, hexin_PyArg_count, &crc, hexin_PyArg_count, &offset, &before, &after, hexin_PyArg_count, &total ) ) {
+#endif /* PY_MAJOR_VERSION */
+        return NULL;
+    }
+
+    param = hexin_crc8_preset( name );
+    mask  = ( ( param == NULL ) || ( param->width >= 64 ) ) ? ~0ULL : ( ( 1ULL << param->width ) - 1 );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+    } else if ( crc & ~mask ) {
+        PyErr_Format( PyExc_ValueError, "%s is a %u-bit CRC", name, ( unsigned int )param->width );
+    } else if ( before.len != after.len ) {
+        PyErr_SetString( PyExc_ValueError, "old_bytes and new_bytes differ in length" );
+    } else if ( ( offset > total ) || ( ( unsigned long long )before.len > total - offset ) ) {
+        PyErr_SetString( PyExc_ValueError, "the range is out of the message" );
+    } else {
+        result = PyLong_FromUnsignedLongLong( hexin_crc8_update_range( param, ( unsigned char )crc, ( const unsigned char * )before.buf, ( const unsigned char * )after.buf,
+                                                                       ( size_t )before.len, total - offset - ( unsigned long long )before.len ) );
+    }
+    PyBuffer_Release( &before );
+    PyBuffer_Release( &after );
+    return result;
+}
+
+static unsigned long long hexin_crc8_hasher_begin( const void *param )
+{
+    struct _hexin_crc8 local = *( const struct _hexin_crc8 * )param;
+
+    local.is_gradual = FALSE;
+    return hexin_crc8_compute_begin( &local, local.init );
+}
+
+static unsigned long long hexin_crc8_hasher_update( const void *param, unsigned long long crc, const unsigned char *pSrc, size_t len )
+{
+    return hexin_crc8_compute_update( ( const struct _hexin_crc8 * )param, ( unsigned char )crc, pSrc, len );
+}
+
+static unsigned long long hexin_crc8_hasher_end( const void *param, unsigned long long crc )
+{
+    return hexin_crc8_compute_end( ( const struct _hexin_crc8 * )param, ( unsigned char )crc );
+}
+
+static const struct _hexin_hasher_ops crc8_hasher_ops = { hexin_crc8_hasher_begin, hexin_crc8_hasher_update, hexin_crc8_hasher_end };
+
+static PyObject * _crc8_new( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    const struct _hexin_crc8 *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "s", &name ) ) {
+        return NULL;
+    }
+
+    param = hexin_crc8_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+    return hexin_hasher_new( &crc8_hasher_ops, param, name, param->width, NULL );
+}
+
+static PyObject * _crc8_batch( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    PyObject *data = NULL, *out = NULL, *offsets = Py_None, *lengths = Py_None, *expected = Py_None;
+    int rows = 0;
+    const struct _hexin_crc8 *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "sOO|OOOi", &name, &data, &out, &offsets, &lengths, &expected, &rows ) ) {
+        return NULL;
+    }
+
+    param = hexin_crc8_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+    return hexin_batch_compute( &crc8_hasher_ops, param, param->width, data, out,
+                                ( offsets  == Py_None ) ? NULL : offsets,
+                                ( lengths  == Py_None ) ? NULL : lengths,
+                                ( expected == Py_None ) ? NULL : expected, rows );
+}
+
+static PyObject * _crc8_file( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    PyObject *file = NULL;
+    const struct _hexin_crc8 *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "sO", &name, &file ) ) {
+        return NULL;
+    }
+
+    param = hexin_crc8_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+    return hexin_file_compute( &crc8_hasher_ops, param, file );
+}
+
+static PyObject * _crc8_files( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    PyObject *files = NULL;
+    unsigned int threads = 0;
+    const struct _hexin_crc8 *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "sO|O&", &name, &files, hexin_PyArg_threads, &threads ) ) {
+        return NULL;
+    }
+
+    param = hexin_crc8_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+    return hexin_file_compute_many( &crc8_hasher_ops, param, files, threads );
+}
+
+static PyObject * _crc8_capsule( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    const struct _hexin_crc8 *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "s", &name ) ) {
+        return NULL;
+    }
+
+    param = hexin_crc8_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+    return hexin_multi_capsule( &crc8_hasher_ops, param, NULL );
+}
+
+static PyObject * _crc8_kernels( PyObject *self, PyObject *args )
+{
+    return Py_BuildValue( "{s:s}", "crc8", hexin_clmul_kernel() );
+}
+
+static PyObject * _crc8_gil_threshold( PyObject *self, PyObject *args )
+{
+    Py_ssize_t threshold = -1;
+
+    if ( !PyArg_ParseTuple( args, "|n", &threshold ) ) {
+        return NULL;
+    }
+    return PyLong_FromSize_t( hexin_set_gil_threshold( ( threshold < 0 ) ? ( size_t )-1 : ( size_t )threshold ) );
+}
+
 /* method table */
 static PyMethodDef _crc8Methods[] = {
-    { "intel",      (PyCFunction)_crc8_intel,        METH_VARARGS, "Calculate Intel hexadecimal of CRC8 [Initial=0x00]" },
-    { "bcc",        (PyCFunction)_crc8_bcc,          METH_VARARGS, "Calculate BCC(XOR) of CRC8 [Initial=0x00]" },
-    { "lrc",        (PyCFunction)_crc8_lrc,          METH_VARARGS, "Calculate LRC of CRC8 [Initial=0x00]" },
-    { "maxim8",     (PyCFunction)_crc8_maxim,        METH_VARARGS, "Calculate MAXIM(MAXIM-DOM) of CRC8 [Poly=0x31 Initial=0x00 Xorout=0x00 Refin=True Refout=True] e.g. DS18B20" },
-    { "rohc",       (PyCFunction)_crc8_rohc,         METH_VARARGS, "Calculate ROHC of CRC8 [Poly=0x07 Initial=0xFF Xorout=0x00 Refin=True Refout=True]" },
-    { "itu8",       (PyCFunction)_crc8_itu,          METH_VARARGS, "Calculate ITU of CRC8 [Poly=0x07 Initial=0x00 Xorout=0x55 Refin=False Refout=False]" },
-    { "i432_1",     (PyCFunction)_crc8_itu,          METH_VARARGS, "Calculate I-432-1 of CRC8 [Poly=0x07 Initial=0x00 Xorout=0x55 Refin=False Refout=False]" },
-    { "crc8",       (PyCFunction)_crc8_crc8,         METH_VARARGS, "Calculate CRC of CRC8 [Poly=0x07 Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
-    { "sum8",       (PyCFunction)_crc8_sum,          METH_VARARGS, "Calculate SUM of CRC8 [Initial=0x00]" },
+    { "intel",      (PyCFunction)_crc8_intel,        HEXIN_METH_FASTCALL, "Calculate Intel hexadecimal of CRC8 [Initial=0x00]" },
+    { "bcc",        (PyCFunction)_crc8_bcc,          HEXIN_METH_FASTCALL, "Calculate BCC(XOR) of CRC8 [Initial=0x00]" },
+    { "lrc",        (PyCFunction)_crc8_lrc,          HEXIN_METH_FASTCALL, "Calculate LRC of CRC8 [Initial=0x00]" },
+    { "maxim8",     (PyCFunction)_crc8_maxim,        HEXIN_METH_FASTCALL, "Calculate MAXIM(MAXIM-DOM) of CRC8 [Poly=0x31 Initial=0x00 Xorout=0x00 Refin=True Refout=True] e.g. DS18B20" },
+    { "rohc",       (PyCFunction)_crc8_rohc,         HEXIN_METH_FASTCALL, "Calculate ROHC of CRC8 [Poly=0x07 Initial=0xFF Xorout=0x00 Refin=True Refout=True]" },
+    { "itu8",       (PyCFunction)_crc8_itu,          HEXIN_METH_FASTCALL, "Calculate ITU of CRC8 [Poly=0x07 Initial=0x00 Xorout=0x55 Refin=False Refout=False]" },
+    { "i432_1",     (PyCFunction)_crc8_itu,          HEXIN_METH_FASTCALL, "Calculate I-432-1 of CRC8 [Poly=0x07 Initial=0x00 Xorout=0x55 Refin=False Refout=False]" },
+    { "crc8",       (PyCFunction)_crc8_crc8,         HEXIN_METH_FASTCALL, "Calculate CRC of CRC8 [Poly=0x07 Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
+    { "sum8",       (PyCFunction)_crc8_sum,          HEXIN_METH_FASTCALL, "Calculate SUM of CRC8 [Initial=0x00]" },
     { "table8",     (PyCFunction)_crc8_table,        METH_VARARGS, "Print CRC8 table to list. libscrc.table8( polynomial )" },
-    { "hacker8",    (PyCFunction)_crc8_hacker,       METH_KEYWORDS|METH_VARARGS, "User calculation CRC8\n"
+    { "hacker8",    (PyCFunction)_crc8_hacker,       HEXIN_METH_FASTCALL, "User calculation CRC8\n"
                                                                                  "@data   : bytes\n"
                                                                                  "@poly   : default=0x31\n"
                                                                                  "@init   : default=0xFF\n"
@@ -685,29 +1093,42 @@ static PyMethodDef _crc8Methods[] = {
                                                                                  "@refin  : default=False\n"
                                                                                  "@refout : default=False\n"
                                                                                  "@reinit : default=False" },
-    { "fletcher8",  (PyCFunction)_crc8_fletcher,     METH_VARARGS, "Calculate fletcher8" },
-    { "smbus",      (PyCFunction)_crc8_crc8,         METH_VARARGS, "Calculate SMBUS of CRC8 [Poly=0x07 Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
-    { "autosar8",   (PyCFunction)_crc8_autosar8,     METH_VARARGS, "Calculate AUTOSAR of CRC8 [Poly=0x2F Initial=0xFF Xorout=0xFF Refin=False Refout=False]" },
-    { "lte8",       (PyCFunction)_crc8_lte8,         METH_VARARGS, "Calculate LTE of CRC8 [Poly=0x9B Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
-    { "sae_j1850",  (PyCFunction)_crc8_sae_j1850,    METH_VARARGS, "Calculate SAE-J1850 of CRC8 [Poly=0x1D Initial=0xFF Xorout=0xFF Refin=False Refout=False]" },
-    { "icode8",     (PyCFunction)_crc8_icode,        METH_VARARGS, "Calculate I-CODE of CRC8 [Poly=0x1D Initial=0xFD Xorout=0x00 Refin=False Refout=False]" },
-    { "gsm8_a",     (PyCFunction)_crc8_gsm8_a,       METH_VARARGS, "Calculate GSM8-A of CRC8 [Poly=0x1D Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
-    { "gsm8_b",     (PyCFunction)_crc8_gsm8_b,       METH_VARARGS, "Calculate GSM8-B of CRC8 [Poly=0x49 Initial=0x00 Xorout=0xFF Refin=False Refout=False]" },
-    { "nrsc_5",     (PyCFunction)_crc8_nrsc_5,       METH_VARARGS, "Calculate NRSC-5 of CRC8 [Poly=0x31 Initial=0xFF Xorout=0x00 Refin=False Refout=False]" },
-    { "wcdma8",     (PyCFunction)_crc8_wcdma,        METH_VARARGS, "Calculate WCDMA of CRC8 [Poly=0x9B Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
-    { "bluetooth",  (PyCFunction)_crc8_bluetooth,    METH_VARARGS, "Calculate BLUETOOTH of CRC8 [Poly=0xA7 Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
-    { "dvb_s2",     (PyCFunction)_crc8_dvb_s2,       METH_VARARGS, "Calculate DVB-S2 of CRC8 [Poly=0xD5 Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
-    { "ebu8",       (PyCFunction)_crc8_ebu8,         METH_VARARGS, "Calculate EBU of CRC8 [Poly=0x1D Initial=0xFF Xorout=0x00 Refin=True Refout=True]" },
-    { "tech_3250",  (PyCFunction)_crc8_ebu8,         METH_VARARGS, "Calculate TECH-3250 of CRC8 [Poly=0x1D Initial=0xFF Xorout=0x00 Refin=True Refout=True]" },
-    { "aes8",       (PyCFunction)_crc8_ebu8,         METH_VARARGS, "Calculate AES of CRC8 [Poly=0x1D Initial=0xFF Xorout=0x00 Refin=True Refout=True]" },
-    { "darc8",      (PyCFunction)_crc8_darc,         METH_VARARGS, "Calculate DARC of CRC8 [Poly=0x39 Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
-    { "opensafety8",(PyCFunction)_crc8_opensafety8,  METH_VARARGS, "Calculate OPENSAFETY of CRC8 [Poly=0x2F Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
-    { "mifare_mad", (PyCFunction)_crc8_mifare_mad,   METH_VARARGS, "Calculate MIFARE-MAD of CRC8 [Poly=0x1D Initial=0xC7 Xorout=0x00 Refin=False Refout=False]" },
-    { "lin",        (PyCFunction)_crc8_lin,          METH_VARARGS, "Calculate LIN Protocol 1.3 (CLASSIC)"   },
+    { "fletcher8",  (PyCFunction)_crc8_fletcher,     HEXIN_METH_FASTCALL, "Calculate fletcher8" },
+    { "smbus",      (PyCFunction)_crc8_crc8,         HEXIN_METH_FASTCALL, "Calculate SMBUS of CRC8 [Poly=0x07 Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
+    { "autosar8",   (PyCFunction)_crc8_autosar8,     HEXIN_METH_FASTCALL, "Calculate AUTOSAR of CRC8 [Poly=0x2F Initial=0xFF Xorout=0xFF Refin=False Refout=False]" },
+    { "lte8",       (PyCFunction)_crc8_lte8,         HEXIN_METH_FASTCALL, "Calculate LTE of CRC8 [Poly=0x9B Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
+    { "sae_j1850",  (PyCFunction)_crc8_sae_j1850,    HEXIN_METH_FASTCALL, "Calculate SAE-J1850 of CRC8 [Poly=0x1D Initial=0xFF Xorout=0xFF Refin=False Refout=False]" },
+    { "icode8",     (PyCFunction)_crc8_icode,        HEXIN_METH_FASTCALL, "Calculate I-CODE of CRC8 [Poly=0x1D Initial=0xFD Xorout=0x00 Refin=False Refout=False]" },
+    { "gsm8_a",     (PyCFunction)_crc8_gsm8_a,       HEXIN_METH_FASTCALL, "Calculate GSM8-A of CRC8 [Poly=0x1D Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
+    { "gsm8_b",     (PyCFunction)_crc8_gsm8_b,       HEXIN_METH_FASTCALL, "Calculate GSM8-B of CRC8 [Poly=0x49 Initial=0x00 Xorout=0xFF Refin=False Refout=False]" },
+    { "nrsc_5",     (PyCFunction)_crc8_nrsc_5,       HEXIN_METH_FASTCALL, "Calculate NRSC-5 of CRC8 [Poly=0x31 Initial=0xFF Xorout=0x00 Refin=False Refout=False]" },
+    { "wcdma8",     (PyCFunction)_crc8_wcdma,        HEXIN_METH_FASTCALL, "Calculate WCDMA of CRC8 [Poly=0x9B Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
+    { "bluetooth",  (PyCFunction)_crc8_bluetooth,    HEXIN_METH_FASTCALL, "Calculate BLUETOOTH of CRC8 [Poly=0xA7 Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
+    { "dvb_s2",     (PyCFunction)_crc8_dvb_s2,       HEXIN_METH_FASTCALL, "Calculate DVB-S2 of CRC8 [Poly=0xD5 Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
+    { "ebu8",       (PyCFunction)_crc8_ebu8,         HEXIN_METH_FASTCALL, "Calculate EBU of CRC8 [Poly=0x1D Initial=0xFF Xorout=0x00 Refin=True Refout=True]" },
+    { "tech_3250",  (PyCFunction)_crc8_ebu8,         HEXIN_METH_FASTCALL, "Calculate TECH-3250 of CRC8 [Poly=0x1D Initial=0xFF Xorout=0x00 Refin=True Refout=True]" },
+    { "aes8",       (PyCFunction)_crc8_ebu8,         HEXIN_METH_FASTCALL, "Calculate AES of CRC8 [Poly=0x1D Initial=0xFF Xorout=0x00 Refin=True Refout=True]" },
+    { "darc8",      (PyCFunction)_crc8_darc,         HEXIN_METH_FASTCALL, "Calculate DARC of CRC8 [Poly=0x39 Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
+    { "opensafety8",(PyCFunction)_crc8_opensafety8,  HEXIN_METH_FASTCALL, "Calculate OPENSAFETY of CRC8 [Poly=0x2F Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
+    { "mifare_mad", (PyCFunction)_crc8_mifare_mad,   HEXIN_METH_FASTCALL, "Calculate MIFARE-MAD of CRC8 [Poly=0x1D Initial=0xC7 Xorout=0x00 Refin=False Refout=False]" },
+    { "lin",        (PyCFunction)_crc8_lin,          HEXIN_METH_FASTCALL, "Calculate LIN Protocol 1.3 (CLASSIC)"   },
     { "lin2x",      (PyCFunction)_crc8_lin2x,        METH_VARARGS, "Calculate LIN Protocol 2.x (ENHANCED)"  },
-    { "id8",        (PyCFunction)_crc8_id8,          METH_VARARGS, "Calculate identity card of CHINA."      },
-    { "nmea",       (PyCFunction)_crc8_nmea,         METH_VARARGS, "Calculate NMEA Checksum. XOR of all the bytes between the $ and the * (not including the delimiters themselves)" },
-    { "modbus_asc", (PyCFunction)_crc8_modbus_asc,   METH_VARARGS, "Calculate Modbus(ASCII) Checksum."      },
+    { "id8",        (PyCFunction)_crc8_id8,          HEXIN_METH_FASTCALL, "Calculate identity card of CHINA."      },
+    { "nmea",       (PyCFunction)_crc8_nmea,         HEXIN_METH_FASTCALL, "Calculate NMEA Checksum. XOR of all the bytes between the $ and the * (not including the delimiters themselves)" },
+    { "modbus_asc", (PyCFunction)_crc8_modbus_asc,   HEXIN_METH_FASTCALL, "Calculate Modbus(ASCII) Checksum."      },
+    { "_kernels",    (PyCFunction)_crc8_kernels, METH_NOARGS, "The kernel tier every family of this module is bound to." },
+    { "_gil_threshold", (PyCFunction)_crc8_gil_threshold, METH_VARARGS, "Release the GIL for buffers of at least this many bytes, returns the previous value." },
+    { "_presets",    (PyCFunction)_crc8_presets_list, METH_NOARGS, "The names of the presets of this module." },
+    { "_combine",    (PyCFunction)_crc8_combine, METH_VARARGS, "CRC( A || B ) of a preset : _combine( name, crc_a, crc_b, len_b )" },
+    { "_extend_zeros",  (PyCFunction)_crc8_extend_zeros,  METH_VARARGS, "CRC( A || n zero bytes ) : _extend_zeros( name, crc, n )" },
+    { "_extend_repeat", (PyCFunction)_crc8_extend_repeat, METH_VARARGS, "CRC( A || block * count ) : _extend_repeat( name, crc, block, count )" },
+    { "_update_range",  (PyCFunction)_crc8_update_range,  METH_VARARGS, "CRC after a range was rewritten : _update_range( name, crc, offset, old, new, total_len )" },
+    { "_new",        (PyCFunction)_crc8_new, METH_VARARGS, "A hashlib-style hasher of a preset : _new( name )" },
+    { "_batch",      (PyCFunction)_crc8_batch, METH_VARARGS, "CRC of many buffers into an integer array : _batch( name, data, out, offsets, lengths, expected, rows )" },
+    { "_file",       (PyCFunction)_crc8_file, METH_VARARGS, "CRC of a file without the GIL : _file( name, path or fd )" },
+    { "_files",      (PyCFunction)_crc8_files, METH_VARARGS, "( crc, size ) of many files on a thread pool : _files( name, files, threads=0 )" },
+    { "_capsule",    (PyCFunction)_crc8_capsule, METH_VARARGS, "The kernel of a preset for _multi : _capsule( name )" },
+    { "_multi",      (PyCFunction)hexin_multi_compute, METH_VARARGS, "Many CRCs of data in one pass : _multi( data, capsules )" },
     { NULL, NULL, 0, NULL }        /* Sentinel */
 };
 
@@ -772,9 +1193,28 @@ PyInit__crc8( void )
         return NULL;
     }
 
+    if ( ( hexin_hasher_ready( m ) < 0 ) || ( hexin_hacker_ready( &crc8_hacker_cache ) < 0 ) ) {
+        Py_DECREF( m );
+        return NULL;
+    }
+
     PyModule_AddStringConstant( m, "__version__", "1.7"   );
     PyModule_AddStringConstant( m, "__author__",  "Heyn"  );
 
+    /* Probe the CPU once and pick the kernel tier ( AVX-512 / PCLMULQDQ / tables ), LIBSCRC_KERNEL may lower it. */
+    hexin_clmul_level();
+    hexin_gil_threshold();
+
+    if ( !hexin_kernel_is_known() && ( PyErr_WarnEx( PyExc_RuntimeWarning, HEXIN_KERNEL_UNKNOWN, 1 ) < 0 ) ) {
+        Py_DECREF( m );
+        return NULL;
+    }
+
+#ifdef Py_GIL_DISABLED
+    /* The presets are read-only and every call keeps its state on the stack. */
+    PyUnstable_Module_SetGIL( m, Py_MOD_GIL_NOT_USED );
+#endif
+
     return m;
 }
 
@@ -784,7 +1224,12 @@ PyInit__crc8( void )
 PyMODINIT_FUNC
 init_crc8( void )
 {
-    (void) Py_InitModule3( "_crc8", _crc8Methods, _crc8_doc );
+    PyObject *m = Py_InitModule3( "_crc8", _crc8Methods, _crc8_doc );
+
+    if ( m != NULL ) {
+        hexin_hasher_ready( m );
+        hexin_hacker_ready( &crc8_hacker_cache );
+    }
 }
 
 #endif /* PY_MAJOR_VERSION */
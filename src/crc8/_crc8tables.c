@@ -25,12 +25,10 @@
 
 unsigned char hexin_reverse8( unsigned char data )
 {
-    unsigned int  i = 0;
-    unsigned char t = 0;
-    for ( i=0; i<8; i++ ) {
-        t |= ( ( data >> i ) & 0x01 ) << ( 7-i );
-    }
-    return t;
+    unsigned int t = data;
+    t = ( ( t >> 1 ) & 0x55 ) | ( ( t & 0x55 ) << 1 );
+    t = ( ( t >> 2 ) & 0x33 ) | ( ( t & 0x33 ) << 2 );
+    return ( unsigned char )( ( ( t >> 4 ) & 0x0F ) | ( ( t & 0x0F ) << 4 ) );
 }
 
 unsigned int hexin_crc8_init_table_poly_is_high( unsigned char polynomial, unsigned char *table )
@@ -74,9 +72,9 @@ unsigned char hexin_crc8_poly_calc( unsigned char crc8, unsigned char c, const u
     return table[ crc8 ^ c ];
 }
 
-unsigned char hexin_calc_crc8_bcc( const unsigned char *pSrc, unsigned int len, unsigned char crc8 ) 
+unsigned char hexin_calc_crc8_bcc( const unsigned char *pSrc, size_t len, unsigned char crc8 ) 
 {
-    unsigned int i = 0;
+    size_t i = 0;
     unsigned char crc = crc8;
 
 	for ( i=0; i<len; i++ ) {
@@ -86,9 +84,9 @@ unsigned char hexin_calc_crc8_bcc( const unsigned char *pSrc, unsigned int len,
 	return crc;
 }
 
-unsigned char hexin_calc_crc8_lrc( const unsigned char *pSrc, unsigned int len, unsigned char crc8 ) 
+unsigned char hexin_calc_crc8_lrc( const unsigned char *pSrc, size_t len, unsigned char crc8 ) 
 {
-    unsigned int i = 0;
+    size_t i = 0;
     unsigned char crc = crc8;
 
 	for ( i=0; i<len; i++ ) {
@@ -99,9 +97,9 @@ unsigned char hexin_calc_crc8_lrc( const unsigned char *pSrc, unsigned int len,
 	return crc;
 }
 
-unsigned char hexin_calc_crc8_sum( const unsigned char *pSrc, unsigned int len, unsigned char crc8 ) 
+unsigned char hexin_calc_crc8_sum( const unsigned char *pSrc, size_t len, unsigned char crc8 ) 
 {
-    unsigned int i = 0;
+    size_t i = 0;
     unsigned char crc = crc8;
 
 	for ( i=0; i<len; i++ ) {
@@ -110,9 +108,9 @@ unsigned char hexin_calc_crc8_sum( const unsigned char *pSrc, unsigned int len,
 	return crc;
 }
 
-unsigned char hexin_calc_crc8_fletcher( const unsigned char *pSrc, unsigned int len, unsigned char crc8 /*reserved*/ )
+unsigned char hexin_calc_crc8_fletcher( const unsigned char *pSrc, size_t len, unsigned char crc8 /*reserved*/ )
 {
-    unsigned int i = 0;
+    size_t i = 0;
     unsigned char sum1 = 0, sum2 = 0;
 
     for ( i = 0; i < len; i++ ) {
@@ -122,42 +120,94 @@ unsigned char hexin_calc_crc8_fletcher( const unsigned char *pSrc, unsigned int
     return ( sum1 & 0xF ) | ( sum2 << 4 );    
 }
 
-static unsigned int hexin_crc8_compute_init_table( struct _hexin_crc8 *param )
+unsigned int hexin_crc8_compute_init_table( struct _hexin_crc8 *param, unsigned char (*table)[MAX_TABLE_ARRAY], struct _hexin_clmul *clmul )
 {
     unsigned int i = 0, j = 0;
     unsigned char crc = 0, c = 0;
 
+    param->table = ( const unsigned char (*)[MAX_TABLE_ARRAY] )table;
+    param->clmul = clmul;
+
+    /* The folding kernel takes the left-aligned polynomial in either orientation. */
+    hexin_clmul_init( clmul, ( unsigned long long )param->poly << 56 );
+
+    if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
+        hexin_crc8_init_table_poly_is_high( hexin_reverse8( param->poly ), table[0] );
+    } else {
+        for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
+            crc = 0;
+            c   = i;
+            for ( j=0; j<8; j++ ) {
+                if ( (crc ^ c) & 0x80 ) crc = ( crc << 1 ) ^ param->poly;
+                else                    crc =   crc << 1;
+                c = c << 1;
+            }
+            table[0][i] = crc;
+        }
+    }
+
+    /* Slicing tables : table[k][i] is the CRC of byte i followed by k zero bytes, in either orientation. */
     for ( i=0; i<MAX_TABLE_ARRAY; i++ ) {
-        crc = 0;
-        c   = i;
-        for ( j=0; j<8; j++ ) {
-            if ( (crc ^ c) & 0x80 ) crc = ( crc << 1 ) ^ param->poly;
-            else                    crc =   crc << 1;
-            c = c << 1;
+        crc = table[0][i];
+        for ( j=1; j<MAX_SLICING_ARRAY; j++ ) {
+            crc = table[0][ crc ];
+            table[j][i] = crc;
         }
-        param->table[i] = crc;
     }
 
-    return TRUE;
+    return HEXIN_TABLE_TYPE( param );
 }
 
-static unsigned char hexin_crc8_compute_char( unsigned char crc8, unsigned char c, struct _hexin_crc8 *param )
+static unsigned char hexin_crc8_compute_char( unsigned char crc8, unsigned char c, const struct _hexin_crc8 *param )
 {
-    return param->table[ crc8 ^ c ];
+    return param->table[0][ crc8 ^ c ];
 }
 
-unsigned char hexin_crc8_compute( const unsigned char *pSrc, unsigned int len, struct _hexin_crc8 *param, unsigned char init )
+static unsigned char hexin_crc8_compute_slicing8( unsigned char crc, const unsigned char *p, const unsigned char (*table)[MAX_TABLE_ARRAY] )
 {
-    unsigned int i = 0;
-    unsigned char crc = init;
+    return table[7][ crc ^ p[0] ] ^ table[6][ p[1] ] ^ table[5][ p[2] ] ^ table[4][ p[3] ]
+         ^ table[3][ p[4] ]       ^ table[2][ p[5] ] ^ table[1][ p[6] ] ^ table[0][ p[7] ];
+}
 
-    if ( param->is_initial == FALSE ) {
-        param->is_initial = hexin_crc8_compute_init_table( param );
+static unsigned char hexin_crc8_compute_slicing16( unsigned char crc, const unsigned char *p, const unsigned char (*table)[MAX_TABLE_ARRAY] )
+{
+    return table[15][ crc ^ p[0] ] ^ table[14][ p[1]  ] ^ table[13][ p[2]  ] ^ table[12][ p[3]  ]
+         ^ table[11][ p[4]  ]      ^ table[10][ p[5]  ] ^ table[9][  p[6]  ] ^ table[8][  p[7]  ]
+         ^ table[7][  p[8]  ]      ^ table[6][  p[9]  ] ^ table[5][  p[10] ] ^ table[4][  p[11] ]
+         ^ table[3][  p[12] ]      ^ table[2][  p[13] ] ^ table[1][  p[14] ] ^ table[0][  p[15] ];
+}
+
+/*
+ * Slicing-by-16 over the bulk of the buffer, one slicing-by-8 step and the byte loop for the tail.
+ */
+static unsigned char hexin_crc8_compute_slicing( unsigned char crc, const unsigned char *pSrc, size_t len, const struct _hexin_crc8 *param )
+{
+    size_t        i = 0;
+    unsigned char buffer[MAX_SLICING_ARRAY];
+    const unsigned char (*table)[MAX_TABLE_ARRAY] = param->table;
+
+    for ( ; len >= 16; len -= 16, pSrc += 16 ) {
+        if ( HEXIN_REFIN_IS_TRUE( param ) ) {
+            for ( i=0; i<16; i++ ) {
+                buffer[i] = hexin_reverse8( pSrc[i] );
+            }
+            crc = hexin_crc8_compute_slicing16( crc, buffer, table );
+        } else {
+            crc = hexin_crc8_compute_slicing16( crc, pSrc, table );
+        }
     }
 
-    /* Fixed Issues #4 #8 */
-    if ( HEXIN_REFOUT_IS_TRUE( param ) && ( HEXIN_GRADUAL_CALCULATE_IS_TRUE( param ) ) ) {
-        crc = hexin_reverse8( init );
+    if ( len >= 8 ) {
+        if ( HEXIN_REFIN_IS_TRUE( param ) ) {
+            for ( i=0; i<8; i++ ) {
+                buffer[i] = hexin_reverse8( pSrc[i] );
+            }
+            crc = hexin_crc8_compute_slicing8( crc, buffer, table );
+        } else {
+            crc = hexin_crc8_compute_slicing8( crc, pSrc, table );
+        }
+        len  -= 8;
+        pSrc += 8;
     }
 
     /* Fixed Issues #8  */
@@ -171,12 +221,196 @@ unsigned char hexin_crc8_compute( const unsigned char *pSrc, unsigned int len, s
         }
     }
 
+    return crc;
+}
+
+/*
+ * The 8-bit register has no shift direction : the reflected tables take the input bytes as they are.
+ */
+static unsigned char hexin_crc8_compute_slicing_reflected( unsigned char crc, const unsigned char *pSrc, size_t len, const struct _hexin_crc8 *param )
+{
+    size_t i = 0;
+    const unsigned char (*table)[MAX_TABLE_ARRAY] = param->table;
+
+    for ( ; len >= 16; len -= 16, pSrc += 16 ) {
+        crc = hexin_crc8_compute_slicing16( crc, pSrc, table );
+    }
+
+    if ( len >= 8 ) {
+        crc   = hexin_crc8_compute_slicing8( crc, pSrc, table );
+        len  -= 8;
+        pSrc += 8;
+    }
+
+    for ( i=0; i<len; i++ ) {
+        crc = table[0][ crc ^ pSrc[i] ];
+    }
+
+    return crc;
+}
+
+/*
+ * Carry-less multiplication folding over the 16-byte aligned bulk, when the CPU supports PCLMULQDQ.
+ */
+static unsigned char hexin_crc8_compute_clmul( unsigned char crc, const unsigned char *pSrc, size_t len, const struct _hexin_crc8 *param )
+{
+    if ( HEXIN_REFIN_IS_TRUE( param ) ) {
+        return hexin_reverse8( ( unsigned char )hexin_clmul_compute( param->clmul, hexin_reverse8( crc ), pSrc, len, TRUE ) );
+    }
+    return ( unsigned char )( hexin_clmul_compute( param->clmul, ( unsigned long long )crc << 56, pSrc, len, FALSE ) >> 56 );
+}
+
+/*
+ * The register of a new calculation, or of a gradual one ( is_gradual, init = crc ^ xorout ).
+ */
+unsigned char hexin_crc8_compute_begin( const struct _hexin_crc8 *param, unsigned char init )
+{
+    if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
+        return HEXIN_GRADUAL_CALCULATE_IS_TRUE( param ) ? init : hexin_reverse8( init );
+    }
+
+    /* Fixed Issues #4 #8 */
+    if ( HEXIN_REFOUT_IS_TRUE( param ) && ( HEXIN_GRADUAL_CALCULATE_IS_TRUE( param ) ) ) {
+        return hexin_reverse8( init );
+    }
+    return init;
+}
+
+/*
+ * Feed the register, no fix-up between two calls.
+ */
+unsigned char hexin_crc8_compute_update( const struct _hexin_crc8 *param, unsigned char crc, const unsigned char *pSrc, size_t len )
+{
+    if ( HEXIN_REFIN_REFOUT_IS_TRUE( param ) ) {
+        if ( ( len >= HEXIN_CLMUL_MIN_LENGTH ) && hexin_clmul_is_supported() ) {
+            crc   = ( unsigned char )hexin_clmul_compute( param->clmul, crc, pSrc, len & ~( size_t )15, TRUE );
+            pSrc += len & ~( size_t )15;
+            len  &= 15U;
+        }
+        return hexin_crc8_compute_slicing_reflected( crc, pSrc, len, param );
+    }
+
+    if ( ( len >= HEXIN_CLMUL_MIN_LENGTH ) && hexin_clmul_is_supported() ) {
+        crc   = hexin_crc8_compute_clmul( crc, pSrc, len & ~( size_t )15, param );
+        pSrc += len & ~( size_t )15;
+        len  &= 15U;
+    }
+    return hexin_crc8_compute_slicing( crc, pSrc, len, param );
+}
+
+/*
+ * The CRC of the register : refout and xorout.
+ */
+unsigned char hexin_crc8_compute_end( const struct _hexin_crc8 *param, unsigned char crc )
+{
     /* Fixed Issues #8  */
-    if ( HEXIN_REFOUT_IS_TRUE( param ) ) {
+    if ( HEXIN_REFOUT_IS_TRUE( param ) && !HEXIN_REFIN_IS_TRUE( param ) ) {
         crc = hexin_reverse8( crc );
     }
+    return ( crc ^ param->xorout );
+}
+
+unsigned char hexin_crc8_compute( const unsigned char *pSrc, size_t len, const struct _hexin_crc8 *param, unsigned char init )
+{
+    unsigned char crc = hexin_crc8_compute_begin( param, init );
+
+    crc = hexin_crc8_compute_update( param, crc, pSrc, len );
+    return hexin_crc8_compute_end( param, crc );
+}
+
+static unsigned long long hexin_crc8_compute_chunk( const void *param, const unsigned char *pSrc, size_t len, unsigned long long init )
+{
+    return hexin_crc8_compute( pSrc, len, ( const struct _hexin_crc8 * )param, ( unsigned char )init );
+}
+
+/*
+ * Split the buffer over threads ( 0 : every CPU ), the result is the same as hexin_crc8_compute().
+ */
+unsigned char hexin_crc8_compute_parallel( const unsigned char *pSrc, size_t len, const struct _hexin_crc8 *param, unsigned char init, unsigned int threads )
+{
+    struct _hexin_crc8 rest = *param;
+    struct _hexin_parallel job = { .compute = hexin_crc8_compute_chunk,
+                                   .first   = param,
+                                   .rest    = &rest,
+                                   .combine = param->combine,
+                                   .init    = init,
+                                   .reinit  = param->init,
+                                   .width   = param->width,
+                                   .poly    = param->poly,
+                                   .refout  = param->refout };
+
+    rest.is_gradual = FALSE;
+    return ( unsigned char )hexin_parallel_compute( &job, pSrc, len, threads );
+}
+
+/*
+ * CRC( A || B ) from CRC( A ), CRC( B ) and len( B ), O( log( len_b ) ).
+ */
+unsigned char hexin_crc8_combine( const struct _hexin_crc8 *param, unsigned char crc_a, unsigned char crc_b, unsigned long long len_b )
+{
+    struct _hexin_crc8 local = *param;
+    struct _hexin_combine combine;
+    unsigned char empty = 0;
+
+    local.is_gradual = FALSE;
+    empty = hexin_crc8_compute( ( const unsigned char * )"", 0, &local, local.init );
+
+    if ( param->combine == NULL ) {
+        hexin_combine_init( &combine, param->width, param->poly );
+    }
+    return ( unsigned char )hexin_combine( ( param->combine != NULL ) ? param->combine : &combine, param->refout, crc_a, crc_b, len_b, empty );
+}
+
+/*
+ * CRC( A || len zero bytes ) from CRC( A ), O( log( len ) ).
+ */
+unsigned char hexin_crc8_extend_zeros( const struct _hexin_crc8 *param, unsigned char crc, unsigned long long len )
+{
+    struct _hexin_combine combine;
+
+    if ( param->combine == NULL ) {
+        hexin_combine_init( &combine, param->width, param->poly );
+    }
+    return ( unsigned char )hexin_combine_zeros( ( param->combine != NULL ) ? param->combine : &combine, param->refout, crc, len, param->xorout );
+}
 
-	return ( crc ^ param->xorout );
+/*
+ * CRC( A || count copies of block ) from CRC( A ), one pass over the block and O( log( count ) ).
+ */
+unsigned char hexin_crc8_extend_repeat( const struct _hexin_crc8 *param, unsigned char crc, const unsigned char *pBlock, size_t len, unsigned long long count )
+{
+    struct _hexin_crc8 local = *param;
+    struct _hexin_combine combine;
+    unsigned char empty = 0, block = 0;
+
+    local.is_gradual = FALSE;
+    empty = hexin_crc8_compute( ( const unsigned char * )"", 0, &local, local.init );
+    block = hexin_crc8_compute( pBlock, len, &local, local.init );
+
+    if ( param->combine == NULL ) {
+        hexin_combine_init( &combine, param->width, param->poly );
+    }
+    return ( unsigned char )hexin_combine_repeat( ( param->combine != NULL ) ? param->combine : &combine, param->refout, crc, block, len, count, empty );
+}
+
+/*
+ * CRC( A ) after len bytes of A, followed by len_after bytes, were rewritten from pOld to pNew, O( len + log( len_after ) ).
+ */
+unsigned char hexin_crc8_update_range( const struct _hexin_crc8 *param, unsigned char crc, const unsigned char *pOld, const unsigned char *pNew,
+                                      size_t len, unsigned long long len_after )
+{
+    struct _hexin_crc8 local = *param;
+    struct _hexin_combine combine;
+    unsigned char crc_old = 0, crc_new = 0;
+
+    local.is_gradual = FALSE;
+    crc_old = hexin_crc8_compute( pOld, len, &local, local.init );
+    crc_new = hexin_crc8_compute( pNew, len, &local, local.init );
+
+    if ( param->combine == NULL ) {
+        hexin_combine_init( &combine, param->width, param->poly );
+    }
+    return ( unsigned char )hexin_combine_patch( ( param->combine != NULL ) ? param->combine : &combine, param->refout, crc, crc_old, crc_new, len_after );
 }
 
 /*
@@ -189,9 +423,9 @@ const unsigned char LIN2X_PID_TABLE[60] = { 0x80, 0xC1, 0x42, 0x03, 0xC4, 0x85,
                                             0xA8, 0xE9, 0x6A, 0x2B, 0xEC, 0xAD, 0x2E, 0x6F, 0xF0, 0xB1,
                                             0x32, 0x73, 0xB4, 0xF5, 0x76, 0x37, 0x78, 0x39, 0xBA, 0xFB };
 
-unsigned char hexin_calc_crc8_lin( const unsigned char *pSrc, unsigned int len, unsigned char crc8 ) 
+unsigned char hexin_calc_crc8_lin( const unsigned char *pSrc, size_t len, unsigned char crc8 ) 
 {
-    unsigned int   i   = 0;
+    size_t         i   = 0;
     unsigned short sum = ( (unsigned short)crc8 ) & 0x00FF;
 
 	for ( i=1; i<len; i++ ) {
@@ -211,7 +445,7 @@ unsigned char hexin_crc8_get_lin2x_pid( const unsigned char id )
     return ( ( p1 & 0x01 ) << 7 ) | ( ( p0 & 0x01 ) << 6 ) | id;
 }
 
-unsigned char hexin_calc_crc8_lin2x( const unsigned char *pSrc, unsigned int len, unsigned char crc8 ) 
+unsigned char hexin_calc_crc8_lin2x( const unsigned char *pSrc, size_t len, unsigned char crc8 ) 
 {
     unsigned char id  = pSrc[0];
 
@@ -225,12 +459,12 @@ unsigned char hexin_calc_crc8_lin2x( const unsigned char *pSrc, unsigned int len
 	return hexin_calc_crc8_lin( pSrc, len, hexin_crc8_get_lin2x_pid( id ) );
 }
 
-unsigned char hexin_calc_crc8_id8( const unsigned char *pSrc, unsigned int len, unsigned char crc8 ) 
+unsigned char hexin_calc_crc8_id8( const unsigned char *pSrc, size_t len, unsigned char crc8 ) 
 {
     const unsigned char coefficient[17] = { 7, 9, 10, 5, 8, 4, 2, 1, 6, 3, 7, 9, 10, 5, 8, 4, 2   };
     const unsigned char _last_array[11] = { '1', '0', 'X', '9', '8', '7', '6', '5', '4', '3', '2' };
     
-    unsigned int  i   = 0;
+    size_t        i   = 0;
     unsigned int  sum = crc8;
 
     if ( ( len != 17 ) || ( crc8 != 0 ) ) {
@@ -252,7 +486,7 @@ unsigned char hexin_calc_crc8_id8( const unsigned char *pSrc, unsigned int len,
     return _last_array[ sum % 11 ];
 }
 
-unsigned char hexin_calc_crc8_nmea( const unsigned char *pSrc, unsigned int len, unsigned char crc8 ) 
+unsigned char hexin_calc_crc8_nmea( const unsigned char *pSrc, size_t len, unsigned char crc8 ) 
 {
     const unsigned char *ptr = ( const unsigned char * )pSrc;
     unsigned int  crc = crc8;
@@ -286,9 +520,9 @@ const unsigned char ascii2hex[MAX_TABLE_ARRAY] = {
     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 };
 
-unsigned char hexin_calc_modbus_ascii( const unsigned char *pSrc, unsigned int len, unsigned char crc8 )
+unsigned char hexin_calc_modbus_ascii( const unsigned char *pSrc, size_t len, unsigned char crc8 )
 {
-    unsigned int i = 0;
+    size_t i = 0;
     unsigned char crc = 0;
 
     if ( ( i % 2 ) != 0 ) {
@@ -21,6 +21,9 @@
 #ifndef __CRC8_TABLES_H__
 #define __CRC8_TABLES_H__
 
+#include "_clmulfold.h"
+#include "_parallel.h"
+
 #ifndef TRUE
 #define                 TRUE                                    1
 #endif
@@ -33,13 +36,20 @@
 #define                 MAX_TABLE_ARRAY                         256
 #endif
 
-#define                 HEXIN_CRC8_WIDTH                        16
+#ifndef MAX_SLICING_ARRAY
+#define                 MAX_SLICING_ARRAY                       16      /* Slicing-by-16 (table[0] is the classic table) */
+#endif
+
+#define                 HEXIN_CRC8_WIDTH                        8
 #define                 HEXIN_REFIN_IS_TRUE(x)                  ( x->refin  == TRUE )
 #define                 HEXIN_REFOUT_IS_TRUE(x)                 ( x->refout == TRUE )
 #define                 HEXIN_REFIN_REFOUT_IS_TRUE(x)           ( ( x->refin == TRUE ) && ( x->refout == TRUE ) )
 
 #define                 HEXIN_POLYNOMIAL_IS_HIGH(x)             ( x & 0x80 )
 #define                 HEXIN_GRADUAL_CALCULATE_IS_TRUE(x)      ( x->is_gradual == 2 )
+#define                 HEXIN_TABLE_IS_NORMAL                   1       /* is_initial : MSB-first table */
+#define                 HEXIN_TABLE_IS_REFLECTED                2       /* is_initial : LSB-first table ( refin == refout == TRUE ) */
+#define                 HEXIN_TABLE_TYPE(x)                     ( HEXIN_REFIN_REFOUT_IS_TRUE((x)) ? HEXIN_TABLE_IS_REFLECTED : HEXIN_TABLE_IS_NORMAL )
 
 #define CRC8_POLYNOMIAL_07                                      0x07
 #define CRC8_POLYNOMIAL_31                                      0x31
@@ -60,8 +70,9 @@ struct _hexin_crc8 {
     unsigned int   refin;
     unsigned int   refout;
     unsigned char  xorout;
-    unsigned char  result;
-    unsigned char  table[MAX_TABLE_ARRAY];
+    const unsigned char (*table)[MAX_TABLE_ARRAY];        /* static const presets, see _crc8presets.h */
+    const struct _hexin_clmul *clmul;
+    const struct _hexin_combine *combine;                 /* x^( 8 * 2^k ) mod P(x), see _combine.h */
 };
 
 unsigned char hexin_reverse8( unsigned char data );
@@ -69,18 +80,27 @@ unsigned char hexin_reverse8( unsigned char data );
 unsigned int hexin_crc8_init_table_poly_is_high( unsigned char polynomial, unsigned char *table );
 unsigned int hexin_crc8_init_table_poly_is_low(  unsigned char polynomial, unsigned char *table );
 
-unsigned char hexin_calc_crc8_bcc(      const unsigned char *pSrc, unsigned int len, unsigned char crc8 );
-unsigned char hexin_calc_crc8_lrc(      const unsigned char *pSrc, unsigned int len, unsigned char crc8 );
-unsigned char hexin_calc_crc8_sum(      const unsigned char *pSrc, unsigned int len, unsigned char crc8 );
-unsigned char hexin_calc_crc8_fletcher( const unsigned char *pSrc, unsigned int len, unsigned char crc8 /*reserved*/ );
-unsigned char hexin_crc8_compute(       const unsigned char *pSrc, unsigned int len, struct _hexin_crc8 *param, unsigned char init );
+unsigned char hexin_calc_crc8_bcc(      const unsigned char *pSrc, size_t len, unsigned char crc8 );
+unsigned char hexin_calc_crc8_lrc(      const unsigned char *pSrc, size_t len, unsigned char crc8 );
+unsigned char hexin_calc_crc8_sum(      const unsigned char *pSrc, size_t len, unsigned char crc8 );
+unsigned char hexin_calc_crc8_fletcher( const unsigned char *pSrc, size_t len, unsigned char crc8 /*reserved*/ );
+unsigned int hexin_crc8_compute_init_table( struct _hexin_crc8 *param, unsigned char (*table)[MAX_TABLE_ARRAY], struct _hexin_clmul *clmul );
+unsigned char hexin_crc8_compute_begin(  const struct _hexin_crc8 *param, unsigned char init );
+unsigned char hexin_crc8_compute_update( const struct _hexin_crc8 *param, unsigned char crc, const unsigned char *pSrc, size_t len );
+unsigned char hexin_crc8_compute_end(    const struct _hexin_crc8 *param, unsigned char crc );
+unsigned char hexin_crc8_compute(       const unsigned char *pSrc, size_t len, const struct _hexin_crc8 *param, unsigned char init );
+unsigned char hexin_crc8_compute_parallel( const unsigned char *pSrc, size_t len, const struct _hexin_crc8 *param, unsigned char init, unsigned int threads );
+unsigned char hexin_crc8_combine( const struct _hexin_crc8 *param, unsigned char crc_a, unsigned char crc_b, unsigned long long len_b );
+unsigned char hexin_crc8_extend_zeros(  const struct _hexin_crc8 *param, unsigned char crc, unsigned long long len );
+unsigned char hexin_crc8_extend_repeat( const struct _hexin_crc8 *param, unsigned char crc, const unsigned char *pBlock, size_t len, unsigned long long count );
+unsigned char hexin_crc8_update_range(  const struct _hexin_crc8 *param, unsigned char crc, const unsigned char *pOld, const unsigned char *pNew, size_t len, unsigned long long len_after );
 
 unsigned char hexin_crc8_get_lin2x_pid( const unsigned char id );
-unsigned char hexin_calc_crc8_lin(      const unsigned char *pSrc, unsigned int len, unsigned char crc8 );
-unsigned char hexin_calc_crc8_lin2x(    const unsigned char *pSrc, unsigned int len, unsigned char crc8 );
-unsigned char hexin_calc_crc8_id8(      const unsigned char *pSrc, unsigned int len, unsigned char crc8 );
-unsigned char hexin_calc_crc8_nmea(     const unsigned char *pSrc, unsigned int len, unsigned char crc8 );
+unsigned char hexin_calc_crc8_lin(      const unsigned char *pSrc, size_t len, unsigned char crc8 );
+unsigned char hexin_calc_crc8_lin2x(    const unsigned char *pSrc, size_t len, unsigned char crc8 );
+unsigned char hexin_calc_crc8_id8(      const unsigned char *pSrc, size_t len, unsigned char crc8 );
+unsigned char hexin_calc_crc8_nmea(     const unsigned char *pSrc, size_t len, unsigned char crc8 );
 
-unsigned char hexin_calc_modbus_ascii(  const unsigned char *pSrc, unsigned int len, unsigned char crc8 );
+unsigned char hexin_calc_modbus_ascii(  const unsigned char *pSrc, size_t len, unsigned char crc8 );
 
 #endif //__CRC8_TABLES_H__
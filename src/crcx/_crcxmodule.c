@@ -21,549 +21,995 @@
 
 #define PY_SSIZE_T_CLEAN
 #include <Python.h>
+#include <string.h>
 #include "_crcxtables.h"
-
-static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, PyObject *args, struct _hexin_crcx *param )
+#include "_crcxpresets.h"
+#include "_hasher.h"
+#include "_batch.h"
+#include "_file.h"
+#include "_multi.h"
+#include "_fastcall.h"
+
+static unsigned char hexin_PyArg_ParseTuple_Paramete( PyObject *self, HEXIN_FASTCALL_PARAMS, const struct _hexin_crcx *preset, unsigned short *result )
 {
+    struct _hexin_crcx local = *preset;       /* Per-call state, the preset is shared by every thread */
+    struct _hexin_crcx *param = &local;
     Py_buffer data = { NULL, NULL };
-    unsigned short init = param->init;
+    unsigned long long value = param->init;     /* Fixed Issues #4  */
+    unsigned int threads = 1;
+    int is_gradual = hexin_fastcall_preset( HEXIN_FASTCALL_ARGS, &data, &value, &threads );
+    unsigned short init = ( unsigned short )value;
 
-#if PY_MAJOR_VERSION >= 3
-    if ( !PyArg_ParseTuple( args, "y*|H", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
-        return FALSE;
-    }
-#else
-    if ( !PyArg_ParseTuple( args, "s*|H", &data, &init ) ) {
-        if ( data.obj ) {
-            PyBuffer_Release( &data );
-        }
+    if ( is_gradual < 0 ) {
         return FALSE;
     }
-#endif /* PY_MAJOR_VERSION */
 
     /* Fixed Issues #4  */
-    param->is_gradual = ( unsigned int )PyTuple_Size( args );   // Fixed warning C4244
+    param->is_gradual = ( unsigned int )is_gradual;
     if ( HEXIN_GRADUAL_CALCULATE_IS_TRUE( param ) ) {
         init = ( init ^ param->xorout );
     }
 
-    param->result = hexin_crcx_compute( (const unsigned char *)data.buf, (unsigned int)data.len, param, init );
-
-    if ( data.obj )
-       PyBuffer_Release( &data );
+    if ( hexin_parallel_threads( ( size_t )data.len, threads ) > 1 ) {
+        Py_BEGIN_ALLOW_THREADS
+        *result = hexin_crcx_compute_parallel( (const unsigned char *)data.buf, (size_t)data.len, param, init, threads );
+        Py_END_ALLOW_THREADS
+    } else if ( ( size_t )data.len < hexin_gil_threshold() ) {
+        *result = hexin_crcx_compute( (const unsigned char *)data.buf, (size_t)data.len, param, init );
+    } else {
+        Py_BEGIN_ALLOW_THREADS
+        *result = hexin_crcx_compute( (const unsigned char *)data.buf, (size_t)data.len, param, init );
+        Py_END_ALLOW_THREADS
+    }
 
+    PyBuffer_Release( &data );
     return TRUE;
 }
 
-static PyObject * _crc3_gsm( PyObject *self, PyObject *args )
+static const struct _hexin_crcx crc3_param_gsm = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                             .width  = 3,
+                                             .poly   = 0x03,
+                                             .init   = 0x00,
+                                             .refin  = FALSE,
+                                             .refout = FALSE,
+                                             .xorout = 0x07,
+                                             .table  = hexin_crc3_table_3_normal,
+                                             .clmul  = &hexin_crc3_clmul_3,
+                                             .combine= &hexin_crc3_combine_3 };
+
+static PyObject * _crc3_gsm( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc3_param_gsm = { .is_initial=FALSE,
-                                                 .width  = 3,
-                                                 .poly   = 0x03,
-                                                 .init   = 0x00,
-                                                 .refin  = FALSE,
-                                                 .refout = FALSE,
-                                                 .xorout = 0x07,
-                                                 .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc3_param_gsm ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc3_param_gsm , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc3_param_gsm.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc3_rohc( PyObject *self, PyObject *args )
+static const struct _hexin_crcx crc3_param_rohc = { .is_initial=HEXIN_TABLE_IS_REFLECTED,
+                                              .width  = 3,
+                                              .poly   = 0x03,
+                                              .init   = 0x07,
+                                              .refin  = TRUE,
+                                              .refout = TRUE,
+                                              .xorout = 0x00,
+                                              .table  = hexin_crc3_table_3_reflected,
+                                              .clmul  = &hexin_crc3_clmul_3,
+                                              .combine= &hexin_crc3_combine_3 };
+
+static PyObject * _crc3_rohc( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc3_param_rohc = { .is_initial=FALSE,
-                                                  .width  = 3,
-                                                  .poly   = 0x03,
-                                                  .init   = 0x07,
-                                                  .refin  = TRUE,
-                                                  .refout = TRUE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc3_param_rohc ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc3_param_rohc , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc3_param_rohc.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc4_itu( PyObject *self, PyObject *args )
+static const struct _hexin_crcx crc4_param_itu4 = { .is_initial=HEXIN_TABLE_IS_REFLECTED,
+                                              .width  = 4,
+                                              .poly   = 0x03,
+                                              .init   = 0x00,
+                                              .refin  = TRUE,
+                                              .refout = TRUE,
+                                              .xorout = 0x00,
+                                              .table  = hexin_crc4_table_3_reflected,
+                                              .clmul  = &hexin_crc4_clmul_3,
+                                              .combine= &hexin_crc4_combine_3 };
+
+static PyObject * _crc4_itu( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc4_param_itu4 = { .is_initial=FALSE,
-                                                  .width  = 4,
-                                                  .poly   = 0x03,
-                                                  .init   = 0x00,
-                                                  .refin  = TRUE,
-                                                  .refout = TRUE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc4_param_itu4 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc4_param_itu4 , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc4_param_itu4.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc4_interlaken4( PyObject *self, PyObject *args )
+static const struct _hexin_crcx crc4_param_interlaken = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                    .width  = 4,
+                                                    .poly   = 0x03,
+                                                    .init   = 0x0F,
+                                                    .refin  = FALSE,
+                                                    .refout = FALSE,
+                                                    .xorout = 0x0F,
+                                                    .table  = hexin_crc4_table_3_normal,
+                                                    .clmul  = &hexin_crc4_clmul_3,
+                                                    .combine= &hexin_crc4_combine_3 };
+
+static PyObject * _crc4_interlaken4( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc4_param_interlaken = { .is_initial=FALSE,
-                                                        .width  = 4,
-                                                        .poly   = 0x03,
-                                                        .init   = 0x0F,
-                                                        .refin  = FALSE,
-                                                        .refout = FALSE,
-                                                        .xorout = 0x0F,
-                                                        .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc4_param_interlaken ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc4_param_interlaken , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc4_param_interlaken.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc5_itu( PyObject *self, PyObject *args )
+static const struct _hexin_crcx crc5_param_itu5 = { .is_initial=HEXIN_TABLE_IS_REFLECTED,
+                                              .width  = 5,
+                                              .poly   = 0x15,
+                                              .init   = 0x00,
+                                              .refin  = TRUE,
+                                              .refout = TRUE,
+                                              .xorout = 0x00,
+                                              .table  = hexin_crc5_table_15_reflected,
+                                              .clmul  = &hexin_crc5_clmul_15,
+                                              .combine= &hexin_crc5_combine_15 };
+
+static PyObject * _crc5_itu( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc5_param_itu5 = { .is_initial=FALSE,
-                                                  .width  = 5,
-                                                  .poly   = 0x15,
-                                                  .init   = 0x00,
-                                                  .refin  = TRUE,
-                                                  .refout = TRUE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc5_param_itu5 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc5_param_itu5 , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc5_param_itu5.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc5_epc( PyObject *self, PyObject *args )
+static const struct _hexin_crcx crc5_param_epc5 = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                              .width  = 5,
+                                              .poly   = 0x09,
+                                              .init   = 0x09,
+                                              .refin  = FALSE,
+                                              .refout = FALSE,
+                                              .xorout = 0x00,
+                                              .table  = hexin_crc5_table_09_normal,
+                                              .clmul  = &hexin_crc5_clmul_09,
+                                              .combine= &hexin_crc5_combine_09 };
+
+static PyObject * _crc5_epc( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc5_param_epc5 = { .is_initial=FALSE,
-                                                  .width  = 5,
-                                                  .poly   = 0x09,
-                                                  .init   = 0x09,
-                                                  .refin  = FALSE,
-                                                  .refout = FALSE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc5_param_epc5 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc5_param_epc5 , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc5_param_epc5.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc5_usb( PyObject *self, PyObject *args )
+static const struct _hexin_crcx crc5_param_usb5 = { .is_initial=HEXIN_TABLE_IS_REFLECTED,
+                                              .width  = 5,
+                                              .poly   = 0x05,
+                                              .init   = 0x1F,
+                                              .refin  = TRUE,
+                                              .refout = TRUE,
+                                              .xorout = 0x1F,
+                                              .table  = hexin_crc5_table_05_reflected,
+                                              .clmul  = &hexin_crc5_clmul_05,
+                                              .combine= &hexin_crc5_combine_05 };
+
+static PyObject * _crc5_usb( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc5_param_usb5 = { .is_initial=FALSE,
-                                                  .width  = 5,
-                                                  .poly   = 0x05,
-                                                  .init   = 0x1F,
-                                                  .refin  = TRUE,
-                                                  .refout = TRUE,
-                                                  .xorout = 0x1F,
-                                                  .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc5_param_usb5 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc5_param_usb5 , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc5_param_usb5.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc6_itu( PyObject *self, PyObject *args )
+static const struct _hexin_crcx crc6_param_itu6 = { .is_initial=HEXIN_TABLE_IS_REFLECTED,
+                                              .width  = 6,
+                                              .poly   = 0x03,
+                                              .init   = 0x00,
+                                              .refin  = TRUE,
+                                              .refout = TRUE,
+                                              .xorout = 0x00,
+                                              .table  = hexin_crc6_table_03_reflected,
+                                              .clmul  = &hexin_crc6_clmul_03,
+                                              .combine= &hexin_crc6_combine_03 };
+
+static PyObject * _crc6_itu( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc6_param_itu6 = { .is_initial=FALSE,
-                                                  .width  = 6,
-                                                  .poly   = 0x03,
-                                                  .init   = 0x00,
-                                                  .refin  = TRUE,
-                                                  .refout = TRUE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc6_param_itu6 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc6_param_itu6 , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc6_param_itu6.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc6_gsm( PyObject *self, PyObject *args )
+static const struct _hexin_crcx crc6_param_gsm6 = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                              .width  = 6,
+                                              .poly   = 0x2F,
+                                              .init   = 0x00,
+                                              .refin  = FALSE,
+                                              .refout = FALSE,
+                                              .xorout = 0x3F,
+                                              .table  = hexin_crc6_table_2F_normal,
+                                              .clmul  = &hexin_crc6_clmul_2F,
+                                              .combine= &hexin_crc6_combine_2F };
+
+static PyObject * _crc6_gsm( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc6_param_gsm6 = { .is_initial=FALSE,
-                                                  .width  = 6,
-                                                  .poly   = 0x2F,
-                                                  .init   = 0x00,
-                                                  .refin  = FALSE,
-                                                  .refout = FALSE,
-                                                  .xorout = 0x3F,
-                                                  .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc6_param_gsm6 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc6_param_gsm6 , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc6_param_gsm6.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc6_darc6( PyObject *self, PyObject *args )
+static const struct _hexin_crcx crc6_param_darc = { .is_initial=HEXIN_TABLE_IS_REFLECTED,
+                                              .width  = 6,
+                                              .poly   = 0x19,
+                                              .init   = 0x00,
+                                              .refin  = TRUE,
+                                              .refout = TRUE,
+                                              .xorout = 0x00,
+                                              .table  = hexin_crc6_table_19_reflected,
+                                              .clmul  = &hexin_crc6_clmul_19,
+                                              .combine= &hexin_crc6_combine_19 };
+
+static PyObject * _crc6_darc6( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc6_param_darc = { .is_initial=FALSE,
-                                                  .width  = 6,
-                                                  .poly   = 0x19,
-                                                  .init   = 0x00,
-                                                  .refin  = TRUE,
-                                                  .refout = TRUE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc6_param_darc ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc6_param_darc , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc6_param_darc.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc7_mmc( PyObject *self, PyObject *args )
+static const struct _hexin_crcx crc7_param_mmc7 = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                              .width  = 7,
+                                              .poly   = 0x09,
+                                              .init   = 0x00,
+                                              .refin  = FALSE,
+                                              .refout = FALSE,
+                                              .xorout = 0x00,
+                                              .table  = hexin_crc7_table_09_normal,
+                                              .clmul  = &hexin_crc7_clmul_09,
+                                              .combine= &hexin_crc7_combine_09 };
+
+static PyObject * _crc7_mmc( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc7_param_mmc7 = { .is_initial=FALSE,
-                                                  .width  = 7,
-                                                  .poly   = 0x09,
-                                                  .init   = 0x00,
-                                                  .refin  = FALSE,
-                                                  .refout = FALSE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc7_param_mmc7 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc7_param_mmc7 , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc7_param_mmc7.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc7_umts7( PyObject *self, PyObject *args )
+static const struct _hexin_crcx crc7_param_umts = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                              .width  = 7,
+                                              .poly   = 0x45,
+                                              .init   = 0x00,
+                                              .refin  = FALSE,
+                                              .refout = FALSE,
+                                              .xorout = 0x00,
+                                              .table  = hexin_crc7_table_45_normal,
+                                              .clmul  = &hexin_crc7_clmul_45,
+                                              .combine= &hexin_crc7_combine_45 };
+
+static PyObject * _crc7_umts7( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc7_param_umts = { .is_initial=FALSE,
-                                                  .width  = 7,
-                                                  .poly   = 0x45,
-                                                  .init   = 0x00,
-                                                  .refin  = FALSE,
-                                                  .refout = FALSE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc7_param_umts ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc7_param_umts , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc7_param_umts.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc7_rohc7( PyObject *self, PyObject *args )
+static const struct _hexin_crcx crc7_param_rohc = { .is_initial=HEXIN_TABLE_IS_REFLECTED,
+                                              .width  = 7,
+                                              .poly   = 0x4F,
+                                              .init   = 0x7F,
+                                              .refin  = TRUE,
+                                              .refout = TRUE,
+                                              .xorout = 0x00,
+                                              .table  = hexin_crc7_table_4F_reflected,
+                                              .clmul  = &hexin_crc7_clmul_4F,
+                                              .combine= &hexin_crc7_combine_4F };
+
+static PyObject * _crc7_rohc7( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc7_param_rohc = { .is_initial=FALSE,
-                                                  .width  = 7,
-                                                  .poly   = 0x4F,
-                                                  .init   = 0x7F,
-                                                  .refin  = TRUE,
-                                                  .refout = TRUE,
-                                                  .xorout = 0x00,
-                                                  .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc7_param_rohc ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc7_param_rohc , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "B", crc7_param_rohc.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc10_atm10( PyObject *self, PyObject *args )
+static const struct _hexin_crcx crc10_param_atm = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                              .width  = 10,
+                                              .poly   = 0x233,
+                                              .init   = 0x000,
+                                              .refin  = FALSE,
+                                              .refout = FALSE,
+                                              .xorout = 0x000,
+                                              .table  = hexin_crc10_table_233_normal,
+                                              .clmul  = &hexin_crc10_clmul_233,
+                                              .combine= &hexin_crc10_combine_233 };
+
+static PyObject * _crc10_atm10( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc10_param_atm = { .is_initial=FALSE,
-                                                  .width  = 10,
-                                                  .poly   = 0x233,
-                                                  .init   = 0x000,
-                                                  .refin  = FALSE,
-                                                  .refout = FALSE,
-                                                  .xorout = 0x000,
-                                                  .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc10_param_atm ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc10_param_atm , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc10_param_atm.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc10_cdma2000( PyObject *self, PyObject *args )
+static const struct _hexin_crcx crc10_param_cdma2000 = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                   .width  = 10,
+                                                   .poly   = 0x3D9,
+                                                   .init   = 0x3FF,
+                                                   .refin  = FALSE,
+                                                   .refout = FALSE,
+                                                   .xorout = 0x000,
+                                                   .table  = hexin_crc10_table_3D9_normal,
+                                                   .clmul  = &hexin_crc10_clmul_3D9,
+                                                   .combine= &hexin_crc10_combine_3D9 };
+
+static PyObject * _crc10_cdma2000( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc10_param_cdma2000 = { .is_initial=FALSE,
-                                                       .width  = 10,
-                                                       .poly   = 0x3D9,
-                                                       .init   = 0x3FF,
-                                                       .refin  = FALSE,
-                                                       .refout = FALSE,
-                                                       .xorout = 0x000,
-                                                       .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc10_param_cdma2000 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc10_param_cdma2000 , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc10_param_cdma2000.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc10_gsm10( PyObject *self, PyObject *args )
+static const struct _hexin_crcx crc10_param_gsm10 = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                .width  = 10,
+                                                .poly   = 0x175,
+                                                .init   = 0x000,
+                                                .refin  = FALSE,
+                                                .refout = FALSE,
+                                                .xorout = 0x3FF,
+                                                .table  = hexin_crc10_table_175_normal,
+                                                .clmul  = &hexin_crc10_clmul_175,
+                                                .combine= &hexin_crc10_combine_175 };
+
+static PyObject * _crc10_gsm10( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc10_param_gsm10 = { .is_initial=FALSE,
-                                                    .width  = 10,
-                                                    .poly   = 0x175,
-                                                    .init   = 0x000,
-                                                    .refin  = FALSE,
-                                                    .refout = FALSE,
-                                                    .xorout = 0x3FF,
-                                                    .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc10_param_gsm10 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc10_param_gsm10 , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc10_param_gsm10.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc11_flexray11( PyObject *self, PyObject *args )
+static const struct _hexin_crcx crc11_param_flexray = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                  .width  = 11,
+                                                  .poly   = 0x385,
+                                                  .init   = 0x01A,
+                                                  .refin  = FALSE,
+                                                  .refout = FALSE,
+                                                  .xorout = 0x000,
+                                                  .table  = hexin_crc11_table_385_normal,
+                                                  .clmul  = &hexin_crc11_clmul_385,
+                                                  .combine= &hexin_crc11_combine_385 };
+
+static PyObject * _crc11_flexray11( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc11_param_flexray = { .is_initial=FALSE,
-                                                      .width  = 11,
-                                                      .poly   = 0x385,
-                                                      .init   = 0x01A,
-                                                      .refin  = FALSE,
-                                                      .refout = FALSE,
-                                                      .xorout = 0x000,
-                                                      .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc11_param_flexray ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc11_param_flexray , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc11_param_flexray.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc11_umts11( PyObject *self, PyObject *args )
+static const struct _hexin_crcx crc11_param_umts11 = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                 .width  = 11,
+                                                 .poly   = 0x307,
+                                                 .init   = 0x000,
+                                                 .refin  = FALSE,
+                                                 .refout = FALSE,
+                                                 .xorout = 0x000,
+                                                 .table  = hexin_crc11_table_307_normal,
+                                                 .clmul  = &hexin_crc11_clmul_307,
+                                                 .combine= &hexin_crc11_combine_307 };
+
+static PyObject * _crc11_umts11( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc11_param_umts11 = { .is_initial=FALSE,
-                                                     .width  = 11,
-                                                     .poly   = 0x307,
-                                                     .init   = 0x000,
-                                                     .refin  = FALSE,
-                                                     .refout = FALSE,
-                                                     .xorout = 0x000,
-                                                     .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc11_param_umts11 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc11_param_umts11 , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc11_param_umts11.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc12_cdma2000( PyObject *self, PyObject *args )
+static const struct _hexin_crcx crc12_param_cdma2000 = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                   .width  = 12,
+                                                   .poly   = 0xF13,
+                                                   .init   = 0xFFF,
+                                                   .refin  = FALSE,
+                                                   .refout = FALSE,
+                                                   .xorout = 0x000,
+                                                   .table  = hexin_crc12_table_F13_normal,
+                                                   .clmul  = &hexin_crc12_clmul_F13,
+                                                   .combine= &hexin_crc12_combine_F13 };
+
+static PyObject * _crc12_cdma2000( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc12_param_cdma2000 = { .is_initial=FALSE,
-                                                       .width  = 12,
-                                                       .poly   = 0xF13,
-                                                       .init   = 0xFFF,
-                                                       .refin  = FALSE,
-                                                       .refout = FALSE,
-                                                       .xorout = 0x000,
-                                                       .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc12_param_cdma2000 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc12_param_cdma2000 , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc12_param_cdma2000.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc12_dect12( PyObject *self, PyObject *args )
+static const struct _hexin_crcx crc12_param_dect = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                               .width  = 12,
+                                               .poly   = 0x80F,
+                                               .init   = 0x000,
+                                               .refin  = FALSE,
+                                               .refout = FALSE,
+                                               .xorout = 0x000,
+                                               .table  = hexin_crc12_table_80F_normal,
+                                               .clmul  = &hexin_crc12_clmul_80F,
+                                               .combine= &hexin_crc12_combine_80F };
+
+static PyObject * _crc12_dect12( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc12_param_dect = { .is_initial=FALSE,
-                                                   .width  = 12,
-                                                   .poly   = 0x80F,
-                                                   .init   = 0x000,
-                                                   .refin  = FALSE,
-                                                   .refout = FALSE,
-                                                   .xorout = 0x000,
-                                                   .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc12_param_dect ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc12_param_dect , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc12_param_dect.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc12_gsm12( PyObject *self, PyObject *args )
+static const struct _hexin_crcx crc12_param_gsm = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                              .width  = 12,
+                                              .poly   = 0xD31,
+                                              .init   = 0x000,
+                                              .refin  = FALSE,
+                                              .refout = FALSE,
+                                              .xorout = 0xFFF,
+                                              .table  = hexin_crc12_table_D31_normal,
+                                              .clmul  = &hexin_crc12_clmul_D31,
+                                              .combine= &hexin_crc12_combine_D31 };
+
+static PyObject * _crc12_gsm12( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc12_param_gsm = { .is_initial=FALSE,
-                                                  .width  = 12,
-                                                  .poly   = 0xD31,
-                                                  .init   = 0x000,
-                                                  .refin  = FALSE,
-                                                  .refout = FALSE,
-                                                  .xorout = 0xFFF,
-                                                  .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc12_param_gsm ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc12_param_gsm , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc12_param_gsm.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc12_umts12( PyObject *self, PyObject *args )
+static const struct _hexin_crcx crc12_param_umts12 = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                 .width  = 12,
+                                                 .poly   = 0x80F,
+                                                 .init   = 0x000,
+                                                 .refin  = FALSE,
+                                                 .refout = TRUE,
+                                                 .xorout = 0x000,
+                                                 .table  = hexin_crc12_table_80F_normal,
+                                                 .clmul  = &hexin_crc12_clmul_80F,
+                                                 .combine= &hexin_crc12_combine_80F };
+
+static PyObject * _crc12_umts12( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc12_param_umts12 = { .is_initial=FALSE,
-                                                     .width  = 12,
-                                                     .poly   = 0x80F,
-                                                     .init   = 0x000,
-                                                     .refin  = FALSE,
-                                                     .refout = TRUE,
-                                                     .xorout = 0x000,
-                                                     .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc12_param_umts12 ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc12_param_umts12 , &result ) ) {
         return NULL;
     }
 
     /* TODO : refin=False, refout=True
        v1.7 fixed ( removed below code )
     */
-    // crc12_param_umts12.result = hexin_crcx_reverse12( crc12_param_umts12.result );
+    // result = hexin_crcx_reverse12( result );
 
-    return Py_BuildValue( "H", crc12_param_umts12.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc13_bbc( PyObject *self, PyObject *args )
+static const struct _hexin_crcx crc13_param_bbc = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                              .width  = 13,
+                                              .poly   = 0x1CF5,
+                                              .init   = 0x0000,
+                                              .refin  = FALSE,
+                                              .refout = FALSE,
+                                              .xorout = 0x0000,
+                                              .table  = hexin_crc13_table_1CF5_normal,
+                                              .clmul  = &hexin_crc13_clmul_1CF5,
+                                              .combine= &hexin_crc13_combine_1CF5 };
+
+static PyObject * _crc13_bbc( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc13_param_bbc = { .is_initial=FALSE,
-                                                  .width  = 13,
-                                                  .poly   = 0x1CF5,
-                                                  .init   = 0x0000,
-                                                  .refin  = FALSE,
-                                                  .refout = FALSE,
-                                                  .xorout = 0x0000,
-                                                  .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc13_param_bbc ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc13_param_bbc , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc13_param_bbc.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc14_darc( PyObject *self, PyObject *args )
+static const struct _hexin_crcx crc14_param_darc = { .is_initial=HEXIN_TABLE_IS_REFLECTED,
+                                               .width  = 14,
+                                               .poly   = 0x0805,
+                                               .init   = 0x0000,
+                                               .refin  = TRUE,
+                                               .refout = TRUE,
+                                               .xorout = 0x0000,
+                                               .table  = hexin_crc14_table_0805_reflected,
+                                               .clmul  = &hexin_crc14_clmul_0805,
+                                               .combine= &hexin_crc14_combine_0805 };
+
+static PyObject * _crc14_darc( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc14_param_darc = { .is_initial=FALSE,
-                                                   .width  = 14,
-                                                   .poly   = 0x0805,
-                                                   .init   = 0x0000,
-                                                   .refin  = TRUE,
-                                                   .refout = TRUE,
-                                                   .xorout = 0x0000,
-                                                   .result = 0 };
+    unsigned short result = 0;
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc14_param_darc ) ) {
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc14_param_darc , &result ) ) {
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc14_param_darc.result );
+    return PyLong_FromUnsignedLong( result );
 }
 
-static PyObject * _crc14_gsm( PyObject *self, PyObject *args )
+static const struct _hexin_crcx crc14_param_gsm = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                              .width  = 14,
+                                              .poly   = 0x202D,
+                                              .init   = 0x0000,
+                                              .refin  = FALSE,
+                                              .refout = FALSE,
+                                              .xorout = 0x3FFF,
+                                              .table  = hexin_crc14_table_202D_normal,
+                                              .clmul  = &hexin_crc14_clmul_202D,
+                                              .combine= &hexin_crc14_combine_202D };
+
+static PyObject * _crc14_gsm( PyObject *self, HEXIN_FASTCALL_PARAMS )
 {
-    static struct _hexin_crcx crc14_param_gsm = { .is_initial=FALSE,
-                                                  .width  = 14,
-                                                  .poly   = 0x202D,
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc14_param_gsm , &result ) ) {
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLong( result );
+}
+
+static const struct _hexin_crcx crc15_param_mpt1327 = { .is_initial=HEXIN_TABLE_IS_NORMAL,
+                                                  .width  = 15,
+                                                  .poly   = 0x6815,
                                                   .init   = 0x0000,
                                                   .refin  = FALSE,
                                                   .refout = FALSE,
-                                                  .xorout = 0x3FFF,
-                                                  .result = 0 };
+                                                  .xorout = 0x0001,
+                                                  .table  = hexin_crc15_table_6815_normal,
+                                                  .clmul  = &hexin_crc15_clmul_6815,
+                                                  .combine= &hexin_crc15_combine_6815 };
+
+static PyObject * _crc15_mpt1327( PyObject *self, HEXIN_FASTCALL_PARAMS )
+{
+    unsigned short result = 0;
+
+    if ( !hexin_PyArg_ParseTuple_Paramete( self, HEXIN_FASTCALL_ARGS, &crc15_param_mpt1327 , &result ) ) {
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLong( result );
+}
+
+/* Named presets, the method names of the table below */
+static struct {
+    const char          *name;
+    const struct _hexin_crcx *param;
+} _crcx_presets[] = {
+    { "gsm3",          &crc3_param_gsm },
+    { "rohc3",         &crc3_param_rohc },
+    { "itu4",          &crc4_param_itu4 },
+    { "g_704",         &crc4_param_itu4 },
+    { "itu5",          &crc5_param_itu5 },
+    { "epc",           &crc5_param_epc5 },
+    { "usb5",          &crc5_param_usb5 },
+    { "itu6",          &crc6_param_itu6 },
+    { "gsm6",          &crc6_param_gsm6 },
+    { "darc6",         &crc6_param_darc },
+    { "mmc",           &crc7_param_mmc7 },
+    { "crc7",          &crc7_param_mmc7 },
+    { "umts7",         &crc7_param_umts },
+    { "rohc7",         &crc7_param_rohc },
+    { "atm10",         &crc10_param_atm },
+    { "gsm10",         &crc10_param_gsm10 },
+    { "umts11",        &crc11_param_umts11 },
+    { "dect12",        &crc12_param_dect },
+    { "gsm12",         &crc12_param_gsm },
+    { "umts12",        &crc12_param_umts12 },
+    { "crc12",         &crc12_param_dect },
+    { "bbc13",         &crc13_param_bbc },
+    { "darc14",        &crc14_param_darc },
+    { "gsm14",         &crc14_param_gsm },
+    { "crc12_3gpp",    &crc12_param_umts12 },
+    { "mpt1327",       &crc15_param_mpt1327 },
+    { "flexray11",     &crc11_param_flexray },
+    { "crc10_cdma2000",&crc10_param_cdma2000 },
+    { "crc12_cdma2000",&crc12_param_cdma2000 },
+    { "interlaken4",   &crc4_param_interlaken },
+    { NULL, NULL }
+};
+
+static const struct _hexin_crcx *hexin_crcx_preset( const char *name )
+{
+    unsigned int i = 0;
+
+    for ( i=0; _crcx_presets[i].name != NULL; i++ ) {
+        if ( 0 == strcmp( _crcx_presets[i].name, name ) ) {
+            return _crcx_presets[i].param;
+        }
+    }
+    return NULL;
+}
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc14_param_gsm ) ) {
+static PyObject * _crcx_presets_list( PyObject *self, PyObject *args )
+{
+    unsigned int i = 0;
+    PyObject *names = PyList_New( 0 );
+
+    for ( i=0; ( names != NULL ) && ( _crcx_presets[i].name != NULL ); i++ ) {
+        PyObject *name = Py_BuildValue( "s", _crcx_presets[i].name );
+        if ( ( name == NULL ) || ( PyList_Append( names, name ) < 0 ) ) {
+            Py_XDECREF( name );
+            Py_DECREF( names );
+            return NULL;
+        }
+        Py_DECREF( name );
+    }
+    return names;
+}
+
+static PyObject * _crcx_combine( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    unsigned long long crc_a = 0, crc_b = 0, len_b = 0, mask = 0;
+    const struct _hexin_crcx *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "sO&O&O&", &name, hexin_PyArg_count, &crc_a, hexin_PyArg_count, &crc_b, hexin_PyArg_count, &len_b ) ) {
+        return NULL;
+    }
+
+    param = hexin_crcx_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc14_param_gsm.result );
+    mask = ( param->width >= 64 ) ? ~0ULL : ( ( 1ULL << param->width ) - 1 );
+    if ( ( crc_a | crc_b ) & ~mask ) {
+        PyErr_Format( PyExc_ValueError, "%s is a %u-bit CRC", name, ( unsigned int )param->width );
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLongLong( hexin_crcx_combine( param, ( unsigned short )crc_a, ( unsigned short )crc_b, len_b ) );
 }
 
-static PyObject * _crc15_mpt1327( PyObject *self, PyObject *args )
+static PyObject * _crcx_extend_zeros( PyObject *self, PyObject *args )
 {
-    static struct _hexin_crcx crc15_param_mpt1327 = { .is_initial=FALSE,
-                                                      .width  = 15,
-                                                      .poly   = 0x6815,
-                                                      .init   = 0x0000,
-                                                      .refin  = FALSE,
-                                                      .refout = FALSE,
-                                                      .xorout = 0x0001,
-                                                      .result = 0 };
+    const char *name = NULL;
+    unsigned long long crc = 0, len = 0, mask = 0;
+    const struct _hexin_crcx *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "sO&O&", &name, hexin_PyArg_count, &crc, hexin_PyArg_count, &len ) ) {
+        return NULL;
+    }
+
+    param = hexin_crcx_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
 
-    if ( !hexin_PyArg_ParseTuple_Paramete( self, args, &crc15_param_mpt1327 ) ) {
+    mask = ( param->width >= 64 ) ? ~0ULL : ( ( 1ULL << param->width ) - 1 );
+    if ( crc & ~mask ) {
+        PyErr_Format( PyExc_ValueError, "%s is a %u-bit CRC", name, ( unsigned int )param->width );
         return NULL;
     }
 
-    return Py_BuildValue( "H", crc15_param_mpt1327.result );
+    return PyLong_FromUnsignedLongLong( hexin_crcx_extend_zeros( param, ( unsigned short )crc, len ) );
+}
+
+static PyObject * _crcx_extend_repeat( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    unsigned long long crc = 0, count = 0, mask = 0;
+    const struct _hexin_crcx *param = NULL;
+    Py_buffer data = { NULL, NULL };
+    unsigned short result = 0;
+
+#if PY_MAJOR_VERSION >= 3
+    if ( !PyArg_ParseTuple( args, "sO&y*O&", &name, hexin_PyArg_count, &crc, &data, hexin_PyArg_count, &count ) ) {
+#else
+    if ( !PyArg_ParseTuple( args, "sO&s*O&", &name, hexin_PyArg_count, &crc, &data, hexin_PyArg_count, &count ) ) {
+#endif /* PY_MAJOR_VERSION */
+        return NULL;
+    }
+
+    param = hexin_crcx_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        PyBuffer_Release( &data );
+        return NULL;
+    }
+
+    mask = ( param->width >= 64 ) ? ~0ULL : ( ( 1ULL << param->width ) - 1 );
+    if ( crc & ~mask ) {
+        PyErr_Format( PyExc_ValueError, "%s is a %u-bit CRC", name, ( unsigned int )param->width );
+        PyBuffer_Release( &data );
+        return NULL;
+    }
+
+    if ( ( size_t )data.len < hexin_gil_threshold() ) {
+        result = hexin_crcx_extend_repeat( param, ( unsigned short )crc, ( const unsigned char * )data.buf, ( size_t )data.len, count );
+    } else {
+        Py_BEGIN_ALLOW_THREADS
+        result = hexin_crcx_extend_repeat( param, ( unsigned short )crc, ( const unsigned char * )data.buf, ( size_t )data.len, count );
+        Py_END_ALLOW_THREADS
+    }
+    PyBuffer_Release( &data );
+    return PyLong_FromUnsignedLongLong( result );
+}
+
+static PyObject * _crcx_update_range( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    unsigned long long crc = 0, offset = 0, total = 0, mask = 0;
+    const struct _hexin_crcx *param = NULL;
+    Py_buffer before = { NULL, NULL }, after = { NULL, NULL };
+    PyObject *result = NULL;
+
+#if PY_MAJOR_VERSION >= 3
+    if ( !PyArg_ParseTuple( args, "sO&O&y*y*O&", &name, hexin_PyArg_count, &crc, hexin_PyArg_count, &offset, &before, &after, hexin_PyArg_count, &total ) ) {
+#else
+    if ( !PyArg_ParseTuple( args, "sO&O&s*s*O&", &name, hexin_PyArg_count, &crc, hexin_PyArg_count, &offset, &before, &after, hexin_PyArg_count, &total ) ) {
+#endif /* PY_MAJOR_VERSION */
+        return NULL;
+    }
+
+    param = hexin_crcx_preset( name );
+    mask  = ( ( param == NULL ) || ( param->width >= 64 ) ) ? ~0ULL : ( ( 1ULL << param->width ) - 1 );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+    } else if ( crc & ~mask ) {
+        PyErr_Format( PyExc_ValueError, "%s is a %u-bit CRC", name, ( unsigned int )param->width );
+    } else if ( before.len != after.len ) {
+        PyErr_SetString( PyExc_ValueError, "old_bytes and new_bytes differ in length" );
+    } else if ( ( offset > total ) || ( ( unsigned long long )before.len > total - offset ) ) {
+        PyErr_SetString( PyExc_ValueError, "the range is out of the message" );
+    } else {
+        result = PyLong_FromUnsignedLongLong( hexin_crcx_update_range( param, ( unsigned short )crc, ( const unsigned char * )before.buf, ( const unsigned char * )after.buf,
+                                                                       ( size_t )before.len, total - offset - ( unsigned long long )before.len ) );
+    }
+    PyBuffer_Release( &before );
+    PyBuffer_Release( &after );
+    return result;
+}
+
+static unsigned long long hexin_crcx_hasher_begin( const void *param )
+{
+    struct _hexin_crcx local = *( const struct _hexin_crcx * )param;
+
+    local.is_gradual = FALSE;
+    return hexin_crcx_compute_begin( &local, local.init );
+}
+
+static unsigned long long hexin_crcx_hasher_update( const void *param, unsigned long long crc, const unsigned char *pSrc, size_t len )
+{
+    return hexin_crcx_compute_update( ( const struct _hexin_crcx * )param, ( unsigned short )crc, pSrc, len );
+}
+
+static unsigned long long hexin_crcx_hasher_end( const void *param, unsigned long long crc )
+{
+    return hexin_crcx_compute_end( ( const struct _hexin_crcx * )param, ( unsigned short )crc );
+}
+
+static const struct _hexin_hasher_ops crcx_hasher_ops = { hexin_crcx_hasher_begin, hexin_crcx_hasher_update, hexin_crcx_hasher_end };
+
+static PyObject * _crcx_new( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    const struct _hexin_crcx *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "s", &name ) ) {
+        return NULL;
+    }
+
+    param = hexin_crcx_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+    return hexin_hasher_new( &crcx_hasher_ops, param, name, param->width, NULL );
+}
+
+static PyObject * _crcx_batch( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    PyObject *data = NULL, *out = NULL, *offsets = Py_None, *lengths = Py_None, *expected = Py_None;
+    int rows = 0;
+    const struct _hexin_crcx *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "sOO|OOOi", &name, &data, &out, &offsets, &lengths, &expected, &rows ) ) {
+        return NULL;
+    }
+
+    param = hexin_crcx_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+    return hexin_batch_compute( &crcx_hasher_ops, param, param->width, data, out,
+                                ( offsets  == Py_None ) ? NULL : offsets,
+                                ( lengths  == Py_None ) ? NULL : lengths,
+                                ( expected == Py_None ) ? NULL : expected, rows );
+}
+
+static PyObject * _crcx_file( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    PyObject *file = NULL;
+    const struct _hexin_crcx *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "sO", &name, &file ) ) {
+        return NULL;
+    }
+
+    param = hexin_crcx_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+    return hexin_file_compute( &crcx_hasher_ops, param, file );
+}
+
+static PyObject * _crcx_files( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    PyObject *files = NULL;
+    unsigned int threads = 0;
+    const struct _hexin_crcx *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "sO|O&", &name, &files, hexin_PyArg_threads, &threads ) ) {
+        return NULL;
+    }
+
+    param = hexin_crcx_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+    return hexin_file_compute_many( &crcx_hasher_ops, param, files, threads );
+}
+
+static PyObject * _crcx_capsule( PyObject *self, PyObject *args )
+{
+    const char *name = NULL;
+    const struct _hexin_crcx *param = NULL;
+
+    if ( !PyArg_ParseTuple( args, "s", &name ) ) {
+        return NULL;
+    }
+
+    param = hexin_crcx_preset( name );
+    if ( param == NULL ) {
+        PyErr_Format( PyExc_ValueError, "unknown preset '%s'", name );
+        return NULL;
+    }
+    return hexin_multi_capsule( &crcx_hasher_ops, param, NULL );
+}
+
+static PyObject * _crcx_kernels( PyObject *self, PyObject *args )
+{
+    return Py_BuildValue( "{s:s}", "crcx", hexin_clmul_kernel() );
+}
+
+static PyObject * _crcx_gil_threshold( PyObject *self, PyObject *args )
+{
+    Py_ssize_t threshold = -1;
+
+    if ( !PyArg_ParseTuple( args, "|n", &threshold ) ) {
+        return NULL;
+    }
+    return PyLong_FromSize_t( hexin_set_gil_threshold( ( threshold < 0 ) ? ( size_t )-1 : ( size_t )threshold ) );
 }
 
 /* method table */
 static PyMethodDef _crcxMethods[] = {
-    { "gsm3",    _crc3_gsm,          METH_VARARGS, "Calculate GSM  of CRC3 [Poly=0x03 Initial=0x00 Xorout=0x07 Refin=False Refout=False]" },
-    { "rohc3",   _crc3_rohc,         METH_VARARGS, "Calculate ROHC of CRC3 [Poly=0x03 Initial=0x07 Xorout=0x00 Refin=True Refout=True]" },
-    { "itu4",    _crc4_itu,          METH_VARARGS, "Calculate ITU  of CRC4 [Poly=0x03 Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
-    { "g_704",   _crc4_itu,          METH_VARARGS, "Calculate G-704 of CRC4 [Poly=0x03 Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
-    { "itu5",    _crc5_itu,          METH_VARARGS, "Calculate ITU  of CRC5 [Poly=0x15 Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
-    { "epc",     _crc5_epc,          METH_VARARGS, "Calculate EPC  of CRC5 [Poly=0x09 Initial=0x09 Xorout=0x00 Refin=False Refout=False]" },
-    { "usb5",    _crc5_usb,          METH_VARARGS, "Calculate USB  of CRC5 [Poly=0x05 Initial=0x1F Xorout=0x1F Refin=True Refout=True]" },
-    { "itu6",    _crc6_itu,          METH_VARARGS, "Calculate ITU  of CRC6 [Poly=0x03 Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
-    { "gsm6",    _crc6_gsm,          METH_VARARGS, "Calculate GSM  of CRC6 [Poly=0x2F Initial=0x00 Xorout=0x3F Refin=False Refout=False]" },
-    { "darc6",   _crc6_darc6,        METH_VARARGS, "Calculate ROHC of CRC6 [Poly=0x19 Initial=0x00 Xorout=0x00 Refin=True Refout=True]"   },
-    { "mmc",     _crc7_mmc,          METH_VARARGS, "Calculate MMC  of CRC7 [Poly=0x09 Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
-    { "crc7",    _crc7_mmc,          METH_VARARGS, "Calculate CRC  of CRC7 [Poly=0x09 Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
-    { "umts7",   _crc7_umts7,        METH_VARARGS, "Calculate UMTS of CRC7 [Poly=0x45 Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
-    { "rohc7",   _crc7_rohc7,        METH_VARARGS, "Calculate ROHC of CRC7 [Poly=0x4F Initial=0x7F Xorout=0x00 Refin=True Refout=True]"   },
-    { "atm10",   _crc10_atm10,       METH_VARARGS, "Calculate ATM of CRC10 [Poly=0x233 Initial=0x000 Refin=False Refout=False Xorout=0x000]"   },
-    { "gsm10",   _crc10_gsm10,       METH_VARARGS, "Calculate GSM of CRC10 [Poly=0x175 Initial=0x000 Refin=False Refout=False Xorout=0x3FF]"   },
-    { "umts11",  _crc11_umts11,      METH_VARARGS, "Calculate UMTS of CRC11 [Poly=0x307 Initial=0x000 Refin=False Refout=False Xorout=0x000]"   },
-    { "dect12",  _crc12_dect12,      METH_VARARGS, "Calculate DECT of CRC12 [Poly=0x80F Initial=0x000 Refin=False Refout=False Xorout=0x000]"   },
-    { "gsm12",   _crc12_gsm12,       METH_VARARGS, "Calculate GSM of CRC12 [Poly=0xD31 Initial=0x000 Refin=False Refout=False Xorout=0xFFF]"   },
-    { "umts12",  _crc12_umts12,      METH_VARARGS, "Calculate UMTS of CRC12 [Poly=0x80F Initial=0x000 Refin=False Refout=true Xorout=0x000]"   },
-    { "crc12",   _crc12_dect12,      METH_VARARGS, "Calculate X-CRC12 of CRC12 [Poly=0x80F Initial=0x000 Refin=False Refout=False Xorout=0x000]"   },
-    { "bbc13",   _crc13_bbc,         METH_VARARGS, "Calculate BBC of CRC13 [Poly=0x1CF5 Initial=0x0000 Refin=False Refout=False Xorout=0x0000]"   },
-    { "darc14",  _crc14_darc,        METH_VARARGS, "Calculate DARC of CRC14 [Poly=0x0805 Initial=0x0000 Refin=False Refout=true Xorout=0x0000]"   },
-    { "gsm14",   _crc14_gsm,         METH_VARARGS, "Calculate GSM of CRC14 [Poly=0x202D Initial=0x0000 Refin=False Refout=False Xorout=0x3FFF]"   },
+    { "gsm3",    (PyCFunction)_crc3_gsm,          HEXIN_METH_FASTCALL, "Calculate GSM  of CRC3 [Poly=0x03 Initial=0x00 Xorout=0x07 Refin=False Refout=False]" },
+    { "rohc3",   (PyCFunction)_crc3_rohc,         HEXIN_METH_FASTCALL, "Calculate ROHC of CRC3 [Poly=0x03 Initial=0x07 Xorout=0x00 Refin=True Refout=True]" },
+    { "itu4",    (PyCFunction)_crc4_itu,          HEXIN_METH_FASTCALL, "Calculate ITU  of CRC4 [Poly=0x03 Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
+    { "g_704",   (PyCFunction)_crc4_itu,          HEXIN_METH_FASTCALL, "Calculate G-704 of CRC4 [Poly=0x03 Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
+    { "itu5",    (PyCFunction)_crc5_itu,          HEXIN_METH_FASTCALL, "Calculate ITU  of CRC5 [Poly=0x15 Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
+    { "epc",     (PyCFunction)_crc5_epc,          HEXIN_METH_FASTCALL, "Calculate EPC  of CRC5 [Poly=0x09 Initial=0x09 Xorout=0x00 Refin=False Refout=False]" },
+    { "usb5",    (PyCFunction)_crc5_usb,          HEXIN_METH_FASTCALL, "Calculate USB  of CRC5 [Poly=0x05 Initial=0x1F Xorout=0x1F Refin=True Refout=True]" },
+    { "itu6",    (PyCFunction)_crc6_itu,          HEXIN_METH_FASTCALL, "Calculate ITU  of CRC6 [Poly=0x03 Initial=0x00 Xorout=0x00 Refin=True Refout=True]" },
+    { "gsm6",    (PyCFunction)_crc6_gsm,          HEXIN_METH_FASTCALL, "Calculate GSM  of CRC6 [Poly=0x2F Initial=0x00 Xorout=0x3F Refin=False Refout=False]" },
+    { "darc6",   (PyCFunction)_crc6_darc6,        HEXIN_METH_FASTCALL, "Calculate ROHC of CRC6 [Poly=0x19 Initial=0x00 Xorout=0x00 Refin=True Refout=True]"   },
+    { "mmc",     (PyCFunction)_crc7_mmc,          HEXIN_METH_FASTCALL, "Calculate MMC  of CRC7 [Poly=0x09 Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
+    { "crc7",    (PyCFunction)_crc7_mmc,          HEXIN_METH_FASTCALL, "Calculate CRC  of CRC7 [Poly=0x09 Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
+    { "umts7",   (PyCFunction)_crc7_umts7,        HEXIN_METH_FASTCALL, "Calculate UMTS of CRC7 [Poly=0x45 Initial=0x00 Xorout=0x00 Refin=False Refout=False]" },
+    { "rohc7",   (PyCFunction)_crc7_rohc7,        HEXIN_METH_FASTCALL, "Calculate ROHC of CRC7 [Poly=0x4F Initial=0x7F Xorout=0x00 Refin=True Refout=True]"   },
+    { "atm10",   (PyCFunction)_crc10_atm10,       HEXIN_METH_FASTCALL, "Calculate ATM of CRC10 [Poly=0x233 Initial=0x000 Refin=False Refout=False Xorout=0x000]"   },
+    { "gsm10",   (PyCFunction)_crc10_gsm10,       HEXIN_METH_FASTCALL, "Calculate GSM of CRC10 [Poly=0x175 Initial=0x000 Refin=False Refout=False Xorout=0x3FF]"   },
+    { "umts11",  (PyCFunction)_crc11_umts11,      HEXIN_METH_FASTCALL, "Calculate UMTS of CRC11 [Poly=0x307 Initial=0x000 Refin=False Refout=False Xorout=0x000]"   },
+    { "dect12",  (PyCFunction)_crc12_dect12,      HEXIN_METH_FASTCALL, "Calculate DECT of CRC12 [Poly=0x80F Initial=0x000 Refin=False Refout=False Xorout=0x000]"   },
+    { "gsm12",   (PyCFunction)_crc12_gsm12,       HEXIN_METH_FASTCALL, "Calculate GSM of CRC12 [Poly=0xD31 Initial=0x000 Refin=False Refout=False Xorout=0xFFF]"   },
+    { "umts12",  (PyCFunction)_crc12_umts12,      HEXIN_METH_FASTCALL, "Calculate UMTS of CRC12 [Poly=0x80F Initial=0x000 Refin=False Refout=true Xorout=0x000]"   },
+    { "crc12",   (PyCFunction)_crc12_dect12,      HEXIN_METH_FASTCALL, "Calculate X-CRC12 of CRC12 [Poly=0x80F Initial=0x000 Refin=False Refout=False Xorout=0x000]"   },
+    { "bbc13",   (PyCFunction)_crc13_bbc,         HEXIN_METH_FASTCALL, "Calculate BBC of CRC13 [Poly=0x1CF5 Initial=0x0000 Refin=False Refout=False Xorout=0x0000]"   },
+    { "darc14",  (PyCFunction)_crc14_darc,        HEXIN_METH_FASTCALL, "Calculate DARC of CRC14 [Poly=0x0805 Initial=0x0000 Refin=False Refout=true Xorout=0x0000]"   },
+    { "gsm14",   (PyCFunction)_crc14_gsm,         HEXIN_METH_FASTCALL, "Calculate GSM of CRC14 [Poly=0x202D Initial=0x0000 Refin=False Refout=False Xorout=0x3FFF]"   },
     
-    { "crc12_3gpp",         _crc12_umts12,      METH_VARARGS, "Calculate 3GPP of CRC12 [Poly=0x80F Initial=0x000 Refin=False Refout=true Xorout=0x000]"   },
-    { "mpt1327",            _crc15_mpt1327,     METH_VARARGS, "Calculate MPT1327 of CRC15 [Poly=0x6815 Initial=0x0000 Refin=False Refout=False Xorout=0x0001]"   },
-    { "flexray11",          _crc11_flexray11,   METH_VARARGS, "Calculate FLEXRAY of CRC11 [Poly=0x385 Initial=0x01a Refin=False Refout=False Xorout=0x000]"   },
-    { "crc10_cdma2000",     _crc10_cdma2000,    METH_VARARGS, "Calculate CDMA2000 of CRC10  [Poly=0x3D9 Initial=0x3FF Refin=False Refout=False Xorout=0x000]"   },
-    { "crc12_cdma2000",     _crc12_cdma2000,    METH_VARARGS, "Calculate CDMA2000 of CRC12  [Poly=0xF13 Initial=0xFFF Refin=False Refout=False Xorout=0x000]"   },
-    { "interlaken4",        _crc4_interlaken4,  METH_VARARGS, "Calculate INTERLAKEN of CRC4 [Poly=0x03 Initial=0x0F Xorout=0x0F Refin=False Refout=False]" },
+    { "crc12_3gpp",         (PyCFunction)_crc12_umts12,      HEXIN_METH_FASTCALL, "Calculate 3GPP of CRC12 [Poly=0x80F Initial=0x000 Refin=False Refout=true Xorout=0x000]"   },
+    { "mpt1327",            (PyCFunction)_crc15_mpt1327,     HEXIN_METH_FASTCALL, "Calculate MPT1327 of CRC15 [Poly=0x6815 Initial=0x0000 Refin=False Refout=False Xorout=0x0001]"   },
+    { "flexray11",          (PyCFunction)_crc11_flexray11,   HEXIN_METH_FASTCALL, "Calculate FLEXRAY of CRC11 [Poly=0x385 Initial=0x01a Refin=False Refout=False Xorout=0x000]"   },
+    { "crc10_cdma2000",     (PyCFunction)_crc10_cdma2000,    HEXIN_METH_FASTCALL, "Calculate CDMA2000 of CRC10  [Poly=0x3D9 Initial=0x3FF Refin=False Refout=False Xorout=0x000]"   },
+    { "crc12_cdma2000",     (PyCFunction)_crc12_cdma2000,    HEXIN_METH_FASTCALL, "Calculate CDMA2000 of CRC12  [Poly=0xF13 Initial=0xFFF Refin=False Refout=False Xorout=0x000]"   },
+    { "interlaken4",        (PyCFunction)_crc4_interlaken4,  HEXIN_METH_FASTCALL, "Calculate INTERLAKEN of CRC4 [Poly=0x03 Initial=0x0F Xorout=0x0F Refin=False Refout=False]" },
+    { "_kernels",    (PyCFunction)_crcx_kernels, METH_NOARGS, "The kernel tier every family of this module is bound to." },
+    { "_gil_threshold", (PyCFunction)_crcx_gil_threshold, METH_VARARGS, "Release the GIL for buffers of at least this many bytes, returns the previous value." },
+    { "_presets",    (PyCFunction)_crcx_presets_list, METH_NOARGS, "The names of the presets of this module." },
+    { "_combine",    (PyCFunction)_crcx_combine, METH_VARARGS, "CRC( A || B ) of a preset : _combine( name, crc_a, crc_b, len_b )" },
+    { "_extend_zeros",  (PyCFunction)_crcx_extend_zeros,  METH_VARARGS, "CRC( A || n zero bytes ) : _extend_zeros( name, crc, n )" },
+    { "_extend_repeat", (PyCFunction)_crcx_extend_repeat, METH_VARARGS, "CRC( A || block * count ) : _extend_repeat( name, crc, block, count )" },
+    { "_update_range",  (PyCFunction)_crcx_update_range,  METH_VARARGS, "CRC after a range was rewritten : _update_range( name, crc, offset, old, new, total_len )" },
+    { "_new",        (PyCFunction)_crcx_new, METH_VARARGS, "A hashlib-style hasher of a preset : _new( name )" },
+    { "_batch",      (PyCFunction)_crcx_batch, METH_VARARGS, "CRC of many buffers into an integer array : _batch( name, data, out, offsets, lengths, expected, rows )" },
+    { "_file",       (PyCFunction)_crcx_file, METH_VARARGS, "CRC of a file without the GIL : _file( name, path or fd )" },
+    { "_files",      (PyCFunction)_crcx_files, METH_VARARGS, "( crc, size ) of many files on a thread pool : _files( name, files, threads=0 )" },
+    { "_capsule",    (PyCFunction)_crcx_capsule, METH_VARARGS, "The kernel of a preset for _multi : _capsule( name )" },
+    { "_multi",      (PyCFunction)hexin_multi_compute, METH_VARARGS, "Many CRCs of data in one pass : _multi( data, capsules )" },
     { NULL, NULL, 0, NULL }        /* Sentinel */
 };
 
@@ -610,9 +1056,28 @@ PyInit__crcx( void )
         return NULL;
     }
 
+    if ( hexin_hasher_ready( m ) < 0 ) {
+        Py_DECREF( m );
+        return NULL;
+    }
+
     PyModule_AddStringConstant( m, "__version__", "1.7" );
     PyModule_AddStringConstant( m, "__author__",  "Heyn"  );
 
+    /* Probe the CPU once and pick the kernel tier ( AVX-512 / PCLMULQDQ / tables ), LIBSCRC_KERNEL may lower it. */
+    hexin_clmul_level();
+    hexin_gil_threshold();
+
+    if ( !hexin_kernel_is_known() && ( PyErr_WarnEx( PyExc_RuntimeWarning, HEXIN_KERNEL_UNKNOWN, 1 ) < 0 ) ) {
+        Py_DECREF( m );
+        return NULL;
+    }
+
+#ifdef Py_GIL_DISABLED
+    /* The presets are read-only and every call keeps its state on the stack. */
+    PyUnstable_Module_SetGIL( m, Py_MOD_GIL_NOT_USED );
+#endif
+
     return m;
 }
 
@@ -622,7 +1087,11 @@ PyInit__crcx( void )
 PyMODINIT_FUNC
 init_crcx( void )
 {
-    (void) Py_InitModule3( "_crcx", _crcxMethods, _crcx_doc );
+    PyObject *m = Py_InitModule3( "_crcx", _crcxMethods, _crcx_doc );
+
+    if ( m != NULL ) {
+        hexin_hasher_ready( m );
+    }
 }
 
 #endif /* PY_MAJOR_VERSION */